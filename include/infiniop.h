@@ -1,7 +1,10 @@
 #ifndef __INFINIOP_API_H__
 #define __INFINIOP_API_H__
 
+#include "infiniop/gguf.h"
+#include "infiniop/graph.h"
 #include "infiniop/handle.h"
+#include "infiniop/memory_planner.h"
 #include "infiniop/ops/add.h"
 #include "infiniop/ops/and.h"
 #include "infiniop/ops/attention.h"
@@ -12,6 +15,7 @@
 #include "infiniop/ops/clip.h"
 #include "infiniop/ops/conv.h"
 #include "infiniop/ops/cos.h"
+#include "infiniop/ops/cross_entropy.h"
 #include "infiniop/ops/crossentropyloss_backward.h"
 #include "infiniop/ops/div.h"
 #include "infiniop/ops/equal.h"
@@ -28,10 +32,13 @@
 #include "infiniop/ops/linear_backward.h"
 #include "infiniop/ops/index_copy_inplace.h"
 #include "infiniop/ops/logsoftmax.h"
+#include "infiniop/ops/mlp.h"
 #include "infiniop/ops/mul.h"
 #include "infiniop/ops/or.h"
+#include "infiniop/ops/qkv_rope.h"
 #include "infiniop/ops/random_sample.h"
 #include "infiniop/ops/rearrange.h"
+#include "infiniop/ops/reduce.h"
 #include "infiniop/ops/reduce_max.h"
 #include "infiniop/ops/reduce_mean.h"
 #include "infiniop/ops/relu.h"
@@ -39,6 +46,7 @@
 #include "infiniop/ops/rms_norm.h"
 #include "infiniop/ops/rms_norm_backward.h"
 #include "infiniop/ops/rope.h"
+#include "infiniop/ops/rope_theta.h"
 #include "infiniop/ops/scatter.h"
 #include "infiniop/ops/sigmoid_backward.h"
 #include "infiniop/ops/silu.h"
@@ -50,5 +58,6 @@
 #include "infiniop/ops/triu.h"
 #include "infiniop/ops/where.h"
 #include "infiniop/tensor_descriptor.h"
+#include "infiniop/trace.h"
 
 #endif // __INFINIOP_API_H__
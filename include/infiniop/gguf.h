@@ -0,0 +1,52 @@
+#ifndef __INFINIOP_GGUF_API_H__
+#define __INFINIOP_GGUF_API_H__
+
+#include "../infinicore.h"
+#include "tensor_descriptor.h"
+
+typedef struct InfiniopGGUFFile *infiniopGGUFFile_t;
+
+typedef enum {
+    // faults every page of the tensor data in, on a background thread
+    INFINIOP_GGUF_PREFETCH = 1 << 0,
+    // locks the tensor data in memory, on a background thread
+    INFINIOP_GGUF_LOCK = 1 << 1,
+    // maps the file at a 2 MiB aligned address and asks the kernel to back it with huge pages,
+    // which it does where the file system allows it
+    INFINIOP_GGUF_HUGE_PAGES = 1 << 2,
+} infiniopGGUFFlags_t;
+
+// Maps a GGUF file read-only, so processes opening the same file share its pages. Checks that
+// every tensor lies inside the file at the alignment the file declares. `flags` combines
+// `infiniopGGUFFlags_t` values.
+__C __export infiniStatus_t infiniopOpenGGUF(infiniopGGUFFile_t *file_ptr,
+                                             const char *path,
+                                             int flags);
+
+__C __export infiniStatus_t infiniopGetGGUFTensorCount(infiniopGGUFFile_t file, size_t *count);
+
+// Index of the tensor named `name`, INFINI_STATUS_BAD_PARAM when there is none.
+__C __export infiniStatus_t infiniopFindGGUFTensor(infiniopGGUFFile_t file,
+                                                   const char *name,
+                                                   size_t *index);
+
+// Gives the name, the descriptor and the host address of the data of a tensor, in the file's
+// dimension order reversed (outermost dimension first), contiguous. All three are owned by the
+// file and stay valid until it is closed; any of the outputs may be null. Quantized tensors have
+// no descriptor and return INFINI_STATUS_BAD_TENSOR_DTYPE.
+__C __export infiniStatus_t infiniopGetGGUFTensor(infiniopGGUFFile_t file,
+                                                  size_t index,
+                                                  const char **name,
+                                                  infiniopTensorDescriptor_t *desc,
+                                                  const void **data);
+
+// Bytes of the tensor data currently backed by huge pages, see infinirtGetHugePageBytes.
+__C __export infiniStatus_t infiniopGetGGUFHugePageBytes(infiniopGGUFFile_t file, size_t *bytes);
+
+// Waits for the prefetching or locking asked at open to finish, returns its outcome.
+__C __export infiniStatus_t infiniopWaitGGUF(infiniopGGUFFile_t file);
+
+// Stops the background work and unmaps the file.
+__C __export infiniStatus_t infiniopCloseGGUF(infiniopGGUFFile_t file);
+
+#endif // __INFINIOP_GGUF_API_H__
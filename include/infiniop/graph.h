@@ -0,0 +1,34 @@
+#ifndef __INFINIOP_GRAPH_API_H__
+#define __INFINIOP_GRAPH_API_H__
+
+#include "handle.h"
+
+typedef struct InfiniopGraph *infiniopGraph_t;
+
+// Until the capture ends, operator calls made on this thread are recorded instead of run; they
+// return INFINI_STATUS_SUCCESS and their errors surface when the graph is launched. Descriptors
+// and buffers are bound by address and must outlive the graph, their contents are read when the
+// graph is launched.
+__C __export infiniStatus_t infiniopBeginGraphCapture(infiniopHandle_t handle);
+
+// Ends the capture begun on this thread with `handle`. With `parallel` nonzero, nodes that share
+// no buffer run concurrently on CPU; buffers are compared by address, so calls on overlapping
+// views of one allocation must not be captured into a parallel graph.
+__C __export infiniStatus_t infiniopEndGraphCapture(infiniopHandle_t handle,
+                                                    infiniopGraph_t *graph_ptr,
+                                                    int parallel);
+
+__C __export infiniStatus_t infiniopGetGraphNodeCount(infiniopGraph_t graph, size_t *count);
+
+// one workspace shared by all nodes, laid out from the workspace sizes given at capture
+__C __export infiniStatus_t infiniopGetGraphWorkspaceSize(infiniopGraph_t graph, size_t *size);
+
+// runs the recorded calls in order on `stream`, stopping at the first one that fails
+__C __export infiniStatus_t infiniopGraphLaunch(infiniopGraph_t graph,
+                                                void *workspace,
+                                                size_t workspace_size,
+                                                void *stream);
+
+__C __export infiniStatus_t infiniopDestroyGraph(infiniopGraph_t graph);
+
+#endif // __INFINIOP_GRAPH_API_H__
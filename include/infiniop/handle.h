@@ -11,4 +11,26 @@ __C __export infiniStatus_t infiniopCreateHandle(infiniopHandle_t *handle_ptr);
 
 __C __export infiniStatus_t infiniopDestroyHandle(infiniopHandle_t handle);
 
+// CPU only. Binds the calling thread, and the OpenMP threads it runs operators with, to the CPUs of
+// NUMA node `node` (see infinirtGetNumaNodeCount), and sizes that OpenMP team to them; -1 binds
+// them back to every CPU of the process. Call it from the thread that runs the operators of
+// `handle`, before the operators whose memory was placed on `node`.
+__C __export infiniStatus_t infiniopSetHandleNumaNode(infiniopHandle_t handle, int node);
+
+// The node set above, -1 when none is
+__C __export infiniStatus_t infiniopGetHandleNumaNode(infiniopHandle_t handle, int *node);
+
+// With `capacity` nonzero, creating a descriptor on `handle` with the same operator, tensor
+// descriptors and attributes as a descriptor created before returns that descriptor again, and
+// destroying it only releases it. The cache keeps up to `capacity` descriptors and drops the least
+// recently used first. A capacity of zero disables the cache. Must not be called while other
+// threads create descriptors on `handle`.
+__C __export infiniStatus_t infiniopSetDescriptorCacheCapacity(infiniopHandle_t handle, size_t capacity);
+
+// `size` is the number of descriptors currently cached
+__C __export infiniStatus_t infiniopGetDescriptorCacheStats(infiniopHandle_t handle,
+                                                            size_t *hits,
+                                                            size_t *misses,
+                                                            size_t *size);
+
 #endif
@@ -0,0 +1,34 @@
+#ifndef __INFINIOP_MEMORY_PLANNER_API_H__
+#define __INFINIOP_MEMORY_PLANNER_API_H__
+
+#include "../infinicore.h"
+
+typedef struct InfiniopMemoryPlanner *infiniopMemoryPlanner_t;
+
+// `alignment` must be a power of two, every offset the planner returns is a multiple of it
+__C __export infiniStatus_t infiniopCreateMemoryPlanner(infiniopMemoryPlanner_t *planner_ptr,
+                                                        size_t alignment);
+
+// Adds a buffer of `size` bytes live from step `first_step` to step `last_step`, both included.
+// Steps are the positions of the operators in the sequence being planned; the workspace of the
+// operator at step s is a buffer live from s to s. Buffers whose lifetimes overlap never share
+// memory.
+__C __export infiniStatus_t infiniopMemoryPlannerAddBuffer(infiniopMemoryPlanner_t planner,
+                                                           size_t size,
+                                                           size_t first_step,
+                                                           size_t last_step,
+                                                           size_t *buffer_id);
+
+// Assigns an offset in one arena to every buffer and returns the size of the arena, the peak
+// memory of the sequence.
+__C __export infiniStatus_t infiniopMemoryPlannerPlan(infiniopMemoryPlanner_t planner,
+                                                      size_t *arena_size);
+
+// valid once planned, until another buffer is added
+__C __export infiniStatus_t infiniopMemoryPlannerGetOffset(infiniopMemoryPlanner_t planner,
+                                                           size_t buffer_id,
+                                                           size_t *offset);
+
+__C __export infiniStatus_t infiniopDestroyMemoryPlanner(infiniopMemoryPlanner_t planner);
+
+#endif // __INFINIOP_MEMORY_PLANNER_API_H__
@@ -5,6 +5,17 @@
 
 typedef struct InfiniopDescriptor *infiniopConvDescriptor_t;
 
+// weights converted once for a convolution descriptor, owned by the caller
+typedef const struct InfiniopConvPackedWeights *infiniopConvPackedWeights_t;
+
+// algorithm a convolution descriptor runs with, chosen at creation from the shapes and strides
+typedef enum {
+    INFINIOP_CONV_ALGO_IMPLICIT_GEMM = 0,
+    INFINIOP_CONV_ALGO_GEMM_1X1 = 1,
+    INFINIOP_CONV_ALGO_WINOGRAD = 2,
+    INFINIOP_CONV_ALGO_DEPTHWISE = 3,
+} infiniopConvAlgo_t;
+
 __C __export infiniStatus_t infiniopCreateConvDescriptor(infiniopHandle_t handle,
                                                          infiniopConvDescriptor_t *desc_ptr,
                                                          infiniopTensorDescriptor_t y_desc,
@@ -14,12 +25,31 @@ __C __export infiniStatus_t infiniopCreateConvDescriptor(infiniopHandle_t handle
                                                          void *pads,
                                                          void *strides,
                                                          void *dilations,
-                                                         size_t n);
+                                                         size_t n,
+                                                         size_t groups);
 
 __C __export infiniStatus_t infiniopGetConvWorkspaceSize(infiniopConvDescriptor_t desc, size_t *size);
 
+// only implemented by the CPU backend
+__C __export infiniStatus_t infiniopGetConvAlgorithm(infiniopConvDescriptor_t desc, infiniopConvAlgo_t *algo);
+
+/**
+ * Converts `w` once into the layout the algorithm of `desc` multiplies with; only implemented by
+ * the CPU backend. The copy is passed to infiniopConvPacked in place of `w`, which then skips that
+ * step on every call. It is a snapshot: later writes to `w` call for a new one. The descriptor is
+ * left as it is, so the copy may be used by any thread, along with the other calls of `desc`.
+ */
+__C __export infiniStatus_t infiniopCreateConvPackedWeights(infiniopConvDescriptor_t desc,
+                                                            infiniopConvPackedWeights_t *packed_ptr,
+                                                            const void *w);
+
+__C __export infiniStatus_t infiniopDestroyConvPackedWeights(infiniopConvPackedWeights_t packed);
+
 __C __export infiniStatus_t infiniopConv(infiniopConvDescriptor_t desc, void *workspace, size_t workspace_size, void *y, const void *x, const void *w, const void *bias, void *stream);
 
+// infiniopConv with the weights packed for `desc` by infiniopCreateConvPackedWeights
+__C __export infiniStatus_t infiniopConvPacked(infiniopConvDescriptor_t desc, void *workspace, size_t workspace_size, void *y, const void *x, infiniopConvPackedWeights_t packed_w, const void *bias, void *stream);
+
 __C __export infiniStatus_t infiniopDestroyConvDescriptor(infiniopConvDescriptor_t desc);
 
 #endif
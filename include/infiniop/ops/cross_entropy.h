@@ -0,0 +1,48 @@
+#ifndef __INFINIOP_CROSS_ENTROPY_API_H__
+#define __INFINIOP_CROSS_ENTROPY_API_H__
+
+#include "../operator_descriptor.h"
+#include <stdint.h>
+
+typedef struct InfiniopDescriptor *infiniopCrossEntropyDescriptor_t;
+
+// how the per-row losses are combined
+typedef enum {
+    // loss has the shape of target
+    INFINIOP_CROSS_ENTROPY_NONE = 0,
+    // loss has one element, the mean over the rows whose target is not ignore_index
+    INFINIOP_CROSS_ENTROPY_MEAN = 1,
+    // loss has one element
+    INFINIOP_CROSS_ENTROPY_SUM = 2,
+} infiniopCrossEntropyReduction_t;
+
+// Cross entropy of logits (..., C) against i32 or i64 class indices (...), computed from the
+// logits without materializing probabilities. Rows whose target equals ignore_index contribute
+// neither loss nor gradient. With label smoothing e the target distribution is (1 - e) on the
+// target class plus e / C on every class.
+// grad_logits may be NULL; otherwise it receives the gradient of loss (of the sum of the rows
+// for INFINIOP_CROSS_ENTROPY_NONE) with respect to logits. Only implemented by the CPU backend.
+__C __export infiniStatus_t infiniopCreateCrossEntropyDescriptor(infiniopHandle_t handle,
+                                                                 infiniopCrossEntropyDescriptor_t *desc_ptr,
+                                                                 infiniopTensorDescriptor_t loss,
+                                                                 infiniopTensorDescriptor_t grad_logits,
+                                                                 infiniopTensorDescriptor_t logits,
+                                                                 infiniopTensorDescriptor_t target,
+                                                                 infiniopCrossEntropyReduction_t reduction,
+                                                                 int64_t ignore_index,
+                                                                 float label_smoothing);
+
+__C __export infiniStatus_t infiniopGetCrossEntropyWorkspaceSize(infiniopCrossEntropyDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopCrossEntropy(infiniopCrossEntropyDescriptor_t desc,
+                                                 void *workspace,
+                                                 size_t workspace_size,
+                                                 void *loss,
+                                                 void *grad_logits,
+                                                 const void *logits,
+                                                 const void *target,
+                                                 void *stream);
+
+__C __export infiniStatus_t infiniopDestroyCrossEntropyDescriptor(infiniopCrossEntropyDescriptor_t desc);
+
+#endif
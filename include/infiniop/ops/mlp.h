@@ -0,0 +1,38 @@
+#ifndef __INFINIOP_MLP_API_H__
+#define __INFINIOP_MLP_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopMLPDescriptor_t;
+
+/**
+ * Fused SwiGLU MLP block: y = (silu(x @ W_gate) * (x @ W_up)) @ W_down
+ *
+ * - x:         [ntok, hidden]
+ * - w_gate_up: [hidden, 2 * inter], gate weight in columns [0, inter), up weight in [inter, 2 * inter)
+ * - w_down:    [inter, hidden]
+ * - y:         [ntok, hidden]
+ *
+ * The [ntok, inter] gate/up activations are never materialized.
+ */
+__C __export infiniStatus_t infiniopCreateMLPDescriptor(infiniopHandle_t handle,
+                                                        infiniopMLPDescriptor_t *desc_ptr,
+                                                        infiniopTensorDescriptor_t y_desc,
+                                                        infiniopTensorDescriptor_t x_desc,
+                                                        infiniopTensorDescriptor_t w_gate_up_desc,
+                                                        infiniopTensorDescriptor_t w_down_desc);
+
+__C __export infiniStatus_t infiniopGetMLPWorkspaceSize(infiniopMLPDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopMLP(infiniopMLPDescriptor_t desc,
+                                        void *workspace,
+                                        size_t workspace_size,
+                                        void *y,
+                                        const void *x,
+                                        const void *w_gate_up,
+                                        const void *w_down,
+                                        void *stream);
+
+__C __export infiniStatus_t infiniopDestroyMLPDescriptor(infiniopMLPDescriptor_t desc);
+
+#endif
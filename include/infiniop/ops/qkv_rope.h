@@ -0,0 +1,56 @@
+#ifndef __INFINIOP_QKV_ROPE_API_H__
+#define __INFINIOP_QKV_ROPE_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopQKVRoPEDescriptor_t;
+
+/**
+ * Fused QKV projection, rotary embedding and KV-cache append.
+ *
+ * - x:         [ntok, hidden]
+ * - w_qkv:     [hidden, (n_q_head + 2 * n_kv_head) * head_dim], columns ordered as q, k, v
+ * - b_qkv:     [(n_q_head + 2 * n_kv_head) * head_dim], may be null
+ * - pos_ids:   [ntok], any integer type, each in [0, table_len)
+ * - sin_table: [table_len, head_dim / 2]
+ * - cos_table: [table_len, head_dim / 2]
+ * - q:         [ntok, n_q_head, head_dim]
+ * - k_cache:   [n_kv_head, cache_len, head_dim], token i is written to slot `pos + i`
+ * - v_cache:   [n_kv_head, cache_len, head_dim], token i is written to slot `pos + i`
+ *
+ * Rotary embedding is applied to q and k with the same pairing as `infiniopRoPE`.
+ * `pos` is given per call, so one descriptor serves every step of a decode loop;
+ * `pos + ntok` must not exceed cache_len.
+ */
+__C __export infiniStatus_t infiniopCreateQKVRoPEDescriptor(infiniopHandle_t handle,
+                                                            infiniopQKVRoPEDescriptor_t *desc_ptr,
+                                                            infiniopTensorDescriptor_t q_desc,
+                                                            infiniopTensorDescriptor_t k_cache_desc,
+                                                            infiniopTensorDescriptor_t v_cache_desc,
+                                                            infiniopTensorDescriptor_t x_desc,
+                                                            infiniopTensorDescriptor_t w_qkv_desc,
+                                                            infiniopTensorDescriptor_t b_qkv_desc,
+                                                            infiniopTensorDescriptor_t pos_ids_desc,
+                                                            infiniopTensorDescriptor_t sin_table_desc,
+                                                            infiniopTensorDescriptor_t cos_table_desc);
+
+__C __export infiniStatus_t infiniopGetQKVRoPEWorkspaceSize(infiniopQKVRoPEDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopQKVRoPE(infiniopQKVRoPEDescriptor_t desc,
+                                            void *workspace,
+                                            size_t workspace_size,
+                                            void *q,
+                                            void *k_cache,
+                                            void *v_cache,
+                                            const void *x,
+                                            const void *w_qkv,
+                                            const void *b_qkv,
+                                            const void *pos_ids,
+                                            const void *sin_table,
+                                            const void *cos_table,
+                                            size_t pos,
+                                            void *stream);
+
+__C __export infiniStatus_t infiniopDestroyQKVRoPEDescriptor(infiniopQKVRoPEDescriptor_t desc);
+
+#endif
@@ -27,6 +27,32 @@ __C __export infiniStatus_t infiniopRandomSample(
     float temperature,
     void *stream);
 
+/**
+ * Samples every row of a batched descriptor (result [batch], probs [batch, voc])
+ * with its own random value, optionally applying penalties to the logits first.
+ *
+ * - random_val: host array of `batch` values in [0, 1)
+ * - token_counts: host array [batch, voc] with the number of times each token
+ *   already occurs in the row's context, or NULL to disable penalties
+ *
+ * A token with a nonzero count has its logit divided by `repetition_penalty`
+ * (multiplied if the logit is negative) and reduced by `frequency_penalty * count`.
+ */
+__C __export infiniStatus_t infiniopRandomSampleBatch(
+    infiniopRandomSampleDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *result,
+    const void *probs,
+    const float *random_val,
+    float topp,
+    int topk,
+    float temperature,
+    float repetition_penalty,
+    float frequency_penalty,
+    const int *token_counts,
+    void *stream);
+
 __C __export infiniStatus_t infiniopDestroyRandomSampleDescriptor(
     infiniopRandomSampleDescriptor_t desc);
 
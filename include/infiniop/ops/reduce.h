@@ -0,0 +1,43 @@
+#ifndef __INFINIOP_REDUCE_API_H__
+#define __INFINIOP_REDUCE_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef struct InfiniopDescriptor *infiniopReduceDescriptor_t;
+
+// how the elements along the reduced axes are combined
+typedef enum {
+    INFINIOP_REDUCE_SUM = 0,
+    INFINIOP_REDUCE_MEAN = 1,
+    INFINIOP_REDUCE_MAX = 2,
+    INFINIOP_REDUCE_MIN = 3,
+    // i64 index of the first maximum, counted over the reduced axes flattened in row-major order
+    INFINIOP_REDUCE_ARGMAX = 4,
+    INFINIOP_REDUCE_PROD = 5,
+    // square root of the sum of squares
+    INFINIOP_REDUCE_NORM2 = 6,
+} infiniopReduceMode_t;
+
+// reduces input over `axes` (all axes when naxes is 0), the reduced axes are kept with length 1 when
+// keepdim is nonzero and dropped otherwise; only implemented by the CPU backend
+__C __export infiniStatus_t infiniopCreateReduceDescriptor(infiniopHandle_t handle,
+                                                           infiniopReduceDescriptor_t *desc_ptr,
+                                                           infiniopTensorDescriptor_t output,
+                                                           infiniopTensorDescriptor_t input,
+                                                           const size_t *axes,
+                                                           size_t naxes,
+                                                           int keepdim,
+                                                           infiniopReduceMode_t mode);
+
+__C __export infiniStatus_t infiniopGetReduceWorkspaceSize(infiniopReduceDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopReduce(infiniopReduceDescriptor_t desc,
+                                           void *workspace,
+                                           size_t workspace_size,
+                                           void *output,
+                                           const void *input,
+                                           void *stream);
+
+__C __export infiniStatus_t infiniopDestroyReduceDescriptor(infiniopReduceDescriptor_t desc);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef __INFINIOP_ROPE_THETA_API_H__
+#define __INFINIOP_ROPE_THETA_API_H__
+
+#include "../operator_descriptor.h"
+
+typedef enum {
+    // rotate interleaved pairs (2i, 2i + 1), same as `infiniopRoPE`
+    INFINIOP_ROPE_ALGO_GPT_J = 0,
+    // rotate half-split pairs (i, i + rotary_dim / 2)
+    INFINIOP_ROPE_ALGO_GPT_NEOX = 1,
+} infiniopRoPEAlgo_t;
+
+typedef struct InfiniopDescriptor *infiniopRoPEThetaDescriptor_t;
+
+/**
+ * Rotary embedding computed from `theta` and `pos_ids`, without sin/cos tables.
+ *
+ * - x, y:    [ntok, nhead, dhead] or [batch, seqlen, nhead, dhead]
+ * - pos_ids: [ntok] or [batch, seqlen], any integer type
+ *
+ * Only the first `rotary_dim` elements of each head are rotated (0 means `dhead`),
+ * the rest are copied from x to y. Pair i rotates by angle `pos * theta ^ (-2i / rotary_dim)`.
+ */
+__C __export infiniStatus_t infiniopCreateRoPEThetaDescriptor(
+    infiniopHandle_t handle,
+    infiniopRoPEThetaDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y,
+    infiniopTensorDescriptor_t x,
+    infiniopTensorDescriptor_t pos_ids,
+    float theta,
+    size_t rotary_dim,
+    infiniopRoPEAlgo_t algo);
+
+__C __export infiniStatus_t infiniopGetRoPEThetaWorkspaceSize(infiniopRoPEThetaDescriptor_t desc, size_t *size);
+
+__C __export infiniStatus_t infiniopRoPETheta(
+    infiniopRoPEThetaDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    const void *pos_ids,
+    void *stream);
+
+__C __export infiniStatus_t infiniopDestroyRoPEThetaDescriptor(infiniopRoPEThetaDescriptor_t desc);
+
+#endif
@@ -5,6 +5,15 @@
 
 typedef struct InfiniopDescriptor *infiniopScatterDescriptor_t;
 
+// how src values are combined with the output element they are scattered to
+typedef enum {
+    INFINIOP_SCATTER_REDUCE_NONE = 0,
+    INFINIOP_SCATTER_REDUCE_SUM = 1,
+    INFINIOP_SCATTER_REDUCE_PROD = 2,
+    INFINIOP_SCATTER_REDUCE_AMAX = 3,
+    INFINIOP_SCATTER_REDUCE_AMIN = 4,
+} infiniopScatterReduce_t;
+
 __C __export infiniStatus_t infiniopCreateScatterDescriptor(infiniopHandle_t handle,
                                                             infiniopScatterDescriptor_t *desc_ptr,
                                                             infiniopTensorDescriptor_t input,
@@ -13,6 +22,16 @@ __C __export infiniStatus_t infiniopCreateScatterDescriptor(infiniopHandle_t han
                                                             infiniopTensorDescriptor_t src,
                                                             int dim);
 
+// scatter that reduces into the output instead of overwriting it, only implemented by the CPU backend
+__C __export infiniStatus_t infiniopCreateScatterReduceDescriptor(infiniopHandle_t handle,
+                                                                  infiniopScatterDescriptor_t *desc_ptr,
+                                                                  infiniopTensorDescriptor_t input,
+                                                                  infiniopTensorDescriptor_t output,
+                                                                  infiniopTensorDescriptor_t index,
+                                                                  infiniopTensorDescriptor_t src,
+                                                                  int dim,
+                                                                  infiniopScatterReduce_t reduce);
+
 __C __export infiniStatus_t infiniopGetScatterWorkspaceSize(infiniopScatterDescriptor_t desc, size_t *size);
 
 __C __export infiniStatus_t infiniopScatter(infiniopScatterDescriptor_t desc,
@@ -0,0 +1,34 @@
+#ifndef __INFINIOP_TRACE_API_H__
+#define __INFINIOP_TRACE_API_H__
+
+#include "../infinicore.h"
+
+typedef struct {
+    // operator name, such as "Gemm"
+    char op[32];
+    size_t count;
+    double total_us;
+    // bytes of the tensors the calls were made on, each counted once per call
+    size_t bytes;
+} infiniopTraceSummary_t;
+
+// Starts recording every operator call made on any thread, dropping the calls recorded before.
+// Each thread keeps its last `events_per_thread` calls, 0 picks a default. Must not run
+// concurrently with operator calls.
+__C __export infiniStatus_t infiniopStartTrace(size_t events_per_thread);
+
+// stops recording, the calls recorded so far stay available
+__C __export infiniStatus_t infiniopStopTrace();
+
+// Writes the recorded calls to `path` in the Chrome trace event format, readable by
+// chrome://tracing and Perfetto. Times are taken on the host around each call, and the tensor
+// shapes are shown for the descriptors created while tracing. Operators may keep running
+// meanwhile, the calls they overwrite before being read are left out.
+__C __export infiniStatus_t infiniopExportTrace(const char *path);
+
+// With `entries` null, sets `count` to the number of operators called; otherwise fills up to
+// `count` entries, the most time consuming operators first, and sets `count` to the number filled.
+// Like the export, may run while operators are called.
+__C __export infiniStatus_t infiniopGetTraceSummary(infiniopTraceSummary_t *entries, size_t *count);
+
+#endif // __INFINIOP_TRACE_API_H__
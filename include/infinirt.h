@@ -53,4 +53,52 @@ __C __export infiniStatus_t infinirtMemcpyAsync(void *dst, const void *src, size
 __C __export infiniStatus_t infinirtMallocAsync(void **p_ptr, size_t size, infinirtStream_t stream);
 __C __export infiniStatus_t infinirtFreeAsync(void *ptr, infinirtStream_t stream);
 
+// NUMA placement of CPU memory and threads
+typedef enum {
+    // plain allocation, pages land on the node of the thread first writing them
+    INFINIRT_MEM_POLICY_DEFAULT = 0,
+    // pages are allocated at once on the node of the allocating thread
+    INFINIRT_MEM_POLICY_LOCAL = 1,
+    // pages are spread round-robin over the nodes
+    INFINIRT_MEM_POLICY_INTERLEAVE = 2,
+    // pages are allocated on the given node
+    INFINIRT_MEM_POLICY_BIND = 3,
+    // the allocation is cut into one contiguous block per node, in node order, each allocated on
+    // its node, so that the threads of a node working on their share of the rows read local memory
+    INFINIRT_MEM_POLICY_PARTITION = 4,
+} infinirtMemPolicy_t;
+
+// Nodes are numbered from 0; a machine without NUMA support is a single node.
+__C __export infiniStatus_t infinirtGetNumaNodeCount(int *count);
+
+// Number of CPUs of `node` the process may run on, of every node for -1.
+__C __export infiniStatus_t infinirtGetNumaNodeCpuCount(int node, int *count);
+
+// Binds the calling thread to the CPUs of `node`, or back to all those of the process for -1.
+__C __export infiniStatus_t infinirtBindThreadToNumaNode(int node);
+
+// Sets how the CPU allocations of the calling thread are placed from now on; `node` is only read
+// by INFINIRT_MEM_POLICY_BIND. Applies to infinirtMalloc, infinirtMallocHost and
+// infinirtMallocAsync when the current device is the CPU.
+__C __export infiniStatus_t infinirtSetMemPolicy(infinirtMemPolicy_t policy, int node);
+
+// Huge pages for CPU memory
+typedef enum {
+    INFINIRT_HUGE_PAGES_NONE = 0,
+    // allocations of 2 MiB and more are aligned to 2 MiB and offered to transparent huge pages
+    INFINIRT_HUGE_PAGES_TRANSPARENT = 1,
+    // pages from the 2 MiB hugetlbfs pool, transparent huge pages when the pool is exhausted
+    INFINIRT_HUGE_PAGES_2M = 2,
+    // pages from the 1 GiB hugetlbfs pool, 2 MiB ones when the pool is exhausted
+    INFINIRT_HUGE_PAGES_1G = 3,
+} infinirtHugePages_t;
+
+// Sets the pages of the CPU allocations of the calling thread from now on, like the memory
+// policy above. Threads start with the mode INFINIRT_HUGE_PAGES names: none, thp, 2m or 1g.
+__C __export infiniStatus_t infinirtSetHugePages(infinirtHugePages_t mode);
+
+// Bytes of [ptr, ptr + size) the kernel currently backs with huge pages; with `ptr` null, of all
+// the live CPU allocations made with huge pages or a memory policy.
+__C __export infiniStatus_t infinirtGetHugePageBytes(const void *ptr, size_t size, size_t *bytes);
+
 #endif // __INFINIRT_API_H__
@@ -15,12 +15,16 @@ def run_tests(args):
         "add.py",
         "and.py",
         "attention.py",
+        "autotune.py",
         "batch_norm.py",
         "cast.py",
         "causal_softmax.py",
         "clip.py",
         "cos.py",
+        "cpu_isa.py",
+        "cross_entropy.py",
         "crossentropyloss_backward.py",
+        "descriptor_cache.py",
         "div.py",
         "equal.py",
         "exp.py",
@@ -28,22 +32,31 @@ def run_tests(args):
         "gelu.py",
         "gelu_backward.py",
         "gemm.py",
+        "gguf_file.py",
+        "graph.py",
         "hardswish.py",
+        "huge_pages.py",
         "index_copy_inplace.py",
         "layer_norm.py",
         "leaky_relu.py",
         "linear.py",
         "linear_backward.py",
+        "memory_planner.py",
+        "mlp.py",
         "mul.py",
+        "numa.py",
         "or.py",
+        "qkv_rope.py",
         "random_sample.py",
         "rearrange.py",
+        "reduce.py",
         "reduce_max.py",
         "reduce_mean.py",
         "relu_backward.py",
         "rms_norm.py",
         "rms_norm_backward.py",
         "rope.py",
+        "rope_theta.py",
         "scatter.py",
         "sigmoid_backward.py",
         "silu.py",
@@ -51,6 +64,7 @@ def run_tests(args):
         "sub.py",
         "swiglu.py",
         "tanh.py",
+        "trace.py",
         "tril.py",
         "triu.py",
         "where.py",
@@ -58,7 +58,9 @@ private:
     GGML_TYPE _ggml_type;
 
 public:
+    // inputs laid out as in the file view its mapping, the others are copied out of it
     Tensor(const GGUFTensorInfo *info,
+           const std::shared_ptr<FileMapping> &file_mapping,
            const void *ggml_ptr,
            const GGUFKeyValue *shape_meta = nullptr,
            const GGUFKeyValue *strides_meta = nullptr,
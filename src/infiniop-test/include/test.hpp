@@ -42,12 +42,14 @@ public:
 #define TEST_FAILED(reason, msg) std::make_shared<infiniop_test::Result>(infiniop_test::TestStatus::reason, 0., toString(), msg)
 #define TEST_INIT_FAILED(op_name) std::make_shared<infiniop_test::Result>(infiniop_test::TestStatus::TEST_INIT_FAILED, 0., "Invalid " + std::string(op_name), "")
 
-// Run all tests read from a GGUF file
+// Run all tests read from a GGUF file, results are in the order of the tests. On CPU, `jobs` > 1
+// runs that many tests at a time, each on its own share of the cores of the process.
 std::vector<std::shared_ptr<Result>> runAllTests(
     const GGUFFileReader &,
     infiniDevice_t device, int device_id,
     size_t warm_ups, size_t iterations,
-    double rtol, double atol);
+    double rtol, double atol,
+    size_t jobs = 1);
 
 // Run a single test read from a GGUF file
 std::shared_ptr<Result> runTest(
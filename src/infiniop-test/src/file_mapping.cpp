@@ -7,12 +7,13 @@ FileMapping::FileMapping(const std::string &filepath) {
     if (_file_handle == INVALID_HANDLE_VALUE) {
         throw std::runtime_error("Failed to open GGUF file");
     }
-    _file_mapping = CreateFileMapping(_file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    // copy-on-write, so tests may write into tensors viewing the file
+    _file_mapping = CreateFileMapping(_file_handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
     if (!_file_mapping) {
         CloseHandle(_file_handle);
         throw std::runtime_error("Failed to create file mapping");
     }
-    _ptr = MapViewOfFile(_file_mapping, FILE_MAP_READ, 0, 0, 0);
+    _ptr = MapViewOfFile(_file_mapping, FILE_MAP_COPY, 0, 0, 0);
     if (!_ptr) {
         CloseHandle(_file_mapping);
         CloseHandle(_file_handle);
@@ -30,7 +31,8 @@ FileMapping::FileMapping(const std::string &filepath) {
         throw std::runtime_error("Failed to get file size");
     }
     _size = sb.st_size;
-    _ptr = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // copy-on-write, so tests may write into tensors viewing the file
+    _ptr = mmap(NULL, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
     close(fd);
     if (_ptr == MAP_FAILED) {
         throw std::runtime_error("Failed to mmap file");
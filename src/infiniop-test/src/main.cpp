@@ -11,12 +11,13 @@ struct ParsedArgs {
     int iterations = 0;                             // Default to 0 if not given
     double atol = 0.0015;                           // Default absolute tolerance
     double rtol = 0.001;                            // Default relative tolerance
+    int jobs = 1;                                   // Tests run at a time, CPU only
 };
 
 void printUsage() {
     std::cout << "Usage:" << std::endl
               << std::endl;
-    std::cout << "infiniop-test <test.gguf> [--<device>[:id]] [--warmup <warmups>] [--run <iterations>] [--atol <atol>] [--rtol <rtol>]" << std::endl
+    std::cout << "infiniop-test <test.gguf> [--<device>[:id]] [--warmup <warmups>] [--run <iterations>] [--atol <atol>] [--rtol <rtol>] [--jobs <jobs>]" << std::endl
               << std::endl;
     std::cout << "  <test.gguf>>" << std::endl;
     std::cout << "    Path to the test gguf file" << std::endl
@@ -36,6 +37,10 @@ void printUsage() {
     std::cout << "  --rtol <relative_tolerance>" << std::endl;
     std::cout << "    (Optional) Relative tolerance for correctness check. Default to 0.001" << std::endl
               << std::endl;
+    std::cout << "  --jobs <jobs>" << std::endl;
+    std::cout << "    (Optional) Number of CPU tests to run at a time, each on its own share of the cores. Timings" << std::endl;
+    std::cout << "    are only comparable between runs with the same number of jobs. Default to 1." << std::endl
+              << std::endl;
     exit(-1);
 }
 
@@ -91,6 +96,12 @@ ParsedArgs parseArgs(int argc, char *argv[]) {
             else if (arg == "--rtol" && i + 1 < argc) {
                 args.rtol = std::stod(argv[++i]);
             }
+            else if (arg == "--jobs" && i + 1 < argc) {
+                args.jobs = std::stoi(argv[++i]);
+                if (args.jobs < 1) {
+                    printUsage();
+                }
+            }
             else {
                 printUsage();
             }
@@ -119,7 +130,8 @@ int main(int argc, char *argv[]) {
             reader,
             (infiniDevice_t)args.device_type, args.device_id,
             args.warmups, args.iterations,
-            args.rtol, args.atol);
+            args.rtol, args.atol,
+            args.jobs);
 
         std::cout << "=====================================" << std::endl;
         for (auto result : results) {
@@ -95,13 +95,28 @@ inline void calculateTensorMemory(size_t &size, size_t &offset,
 
 namespace infiniop_test {
 
+namespace {
+// Runs a runtime call with the CPU as the current device, then restores the device
+template <typename Call>
+infiniStatus_t onCpu(Call call) {
+    infiniDevice_t device;
+    int device_id;
+    CHECK_OR(infinirtGetDevice(&device, &device_id), return api_result_);
+    CHECK_OR(infinirtSetDevice(INFINI_DEVICE_CPU, 0), return api_result_);
+    auto status = call();
+    CHECK_OR(infinirtSetDevice(device, device_id), return api_result_);
+    return status;
+}
+} // namespace
+
 Memory::Memory(size_t size, infiniDevice_t device, int device_id) {
     _file_mapping = nullptr;
     _device = device;
     _device_id = device_id;
     _size = size;
     if (device == INFINI_DEVICE_CPU) {
-        _ptr = std::malloc(size);
+        // through the runtime, so that host buffers follow its huge page mode (INFINIRT_HUGE_PAGES)
+        CHECK_OR(onCpu([&] { return infinirtMalloc(&_ptr, _size); }), throw std::runtime_error("Error Creating Memory: malloc"));
     } else {
         CHECK_OR(infinirtSetDevice(_device, _device_id), throw std::runtime_error("Error Creating Memory: set device"));
         CHECK_OR(infinirtMalloc(&_ptr, _size), throw std::runtime_error("Error Creating Memory: malloc"));
@@ -120,7 +135,7 @@ Memory::~Memory() {
     // if memory does not map to a file, free it manually
     if (_file_mapping == nullptr) {
         if (_device == INFINI_DEVICE_CPU) {
-            std::free(_ptr);
+            onCpu([&] { return infinirtFree(_ptr); });
         } else {
             infinirtSetDevice(_device, _device_id);
             infinirtFree(_ptr);
@@ -133,6 +148,7 @@ void *Tensor::data() const {
 }
 
 Tensor::Tensor(const GGUFTensorInfo *info,
+               const std::shared_ptr<FileMapping> &file_mapping,
                const void *ggml_ptr,
                const GGUFKeyValue *shape_meta,
                const GGUFKeyValue *strides_meta,
@@ -202,15 +218,21 @@ Tensor::Tensor(const GGUFTensorInfo *info,
     infiniopCreateTensorDescriptor(&_desc, ndim, temp_shape.data(), _strides.data(), ggmlTypeToInfiniType(_ggml_type));
     size_t size;
     calculateTensorMemory(size, _offset, temp_shape, _strides, ggmlTypeSize(_ggml_type));
-    _memory = std::make_shared<Memory>(size, INFINI_DEVICE_CPU, 0);
-    utils::rearrange(
-        (char *)_memory->ptr() + _offset,
-        (char *)ggml_ptr + info->data_offset,
-        temp_shape.data(),
-        _strides.data(),
-        contiguous_strides.data(),
-        ndim,
-        ggmlTypeSize(_ggml_type));
+    if (!isOutput && _strides == contiguous_strides) {
+        // pages of the file are only read once the test touches them
+        _offset = 0;
+        _memory = std::make_shared<Memory>(file_mapping, (char *)ggml_ptr + info->data_offset, size);
+    } else {
+        _memory = std::make_shared<Memory>(size, INFINI_DEVICE_CPU, 0);
+        utils::rearrange(
+            (char *)_memory->ptr() + _offset,
+            (char *)ggml_ptr + info->data_offset,
+            temp_shape.data(),
+            _strides.data(),
+            contiguous_strides.data(),
+            ndim,
+            ggmlTypeSize(_ggml_type));
+    }
 
     if (shape_meta == nullptr) {
         _shape = temp_shape;
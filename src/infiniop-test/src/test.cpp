@@ -1,11 +1,20 @@
 #include "ops.hpp"
 #include "tensor.hpp"
 #include "utils.hpp"
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <infinirt.h>
 #include <iostream>
 #include <numeric>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#ifdef ENABLE_OMP
+#include <omp.h>
+#endif
 
 namespace infiniop_test {
 std::unordered_map<std::string, const TestBuilder> TEST_BUILDERS = TEST_BUILDER_MAPPINGS;
@@ -46,11 +55,68 @@ std::string Result::toString() const {
     return oss.str();
 }
 
+namespace {
+// The CPUs the process may run on, split into `jobs` contiguous slices
+std::vector<std::vector<int>> splitCpus(size_t jobs) {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    auto slices = std::vector<std::vector<int>>(jobs);
+    if (cpus.size() < jobs) {
+        // too few cores to share out, the jobs are left to the scheduler
+        return slices;
+    }
+    for (size_t i = 0; i < cpus.size(); i++) {
+        slices[i * jobs / cpus.size()].push_back(cpus[i]);
+    }
+    return slices;
+}
+
+// Binds the calling thread, and the OpenMP threads it starts, to `cpus`
+void bindToCpus(const std::vector<int> &cpus) {
+    if (cpus.empty()) {
+        return;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+#ifdef ENABLE_OMP
+    omp_set_num_threads((int)cpus.size());
+#endif
+}
+
+std::shared_ptr<Result> runTestOrFail(const GGUFFileReader &gguf_reader,
+                                      infiniDevice_t device, int device_id,
+                                      size_t warm_ups, size_t iterations,
+                                      double rtol, double atol, size_t test_id) {
+    try {
+        return runTest(gguf_reader, device, device_id, warm_ups, iterations, rtol, atol, test_id);
+    } catch (const std::exception &e) {
+        return TEST_INIT_FAILED("test " + std::to_string(test_id) + "\n" + e.what());
+    }
+}
+} // namespace
+
 std::vector<std::shared_ptr<Result>> runAllTests(const GGUFFileReader &gguf_reader,
                                                  infiniDevice_t device, int device_id,
                                                  size_t warm_ups, size_t iterations,
-                                                 double rtol, double atol) {
-    auto meta = gguf_reader.getAttributeMap();
+                                                 double rtol, double atol,
+                                                 size_t jobs) {
+    const auto &meta = gguf_reader.getAttributeMap();
     auto count_meta = meta.find("test_count");
     if (count_meta == meta.end()) {
         throw std::runtime_error("Invalid GGUF file: missing test_count attribute");
@@ -58,12 +124,30 @@ std::vector<std::shared_ptr<Result>> runAllTests(const GGUFFileReader &gguf_read
     size_t count = *(size_t *)(count_meta->second->value.data());
     std::cout << "Found " << count << " tests" << std::endl;
     auto results = std::vector<std::shared_ptr<Result>>(count);
-    try {
+
+    // only CPU tests are spread over workers, a device is shared by every test
+    jobs = device == INFINI_DEVICE_CPU ? std::min(std::max(jobs, (size_t)1), count) : 1;
+    if (jobs <= 1) {
         for (size_t i = 0; i < count; i++) {
-            results[i] = runTest(gguf_reader, device, device_id, warm_ups, iterations, rtol, atol, i);
+            results[i] = runTestOrFail(gguf_reader, device, device_id, warm_ups, iterations, rtol, atol, i);
         }
-    } catch (const std::exception &e) {
-        std::cerr << "Error: " << e.what() << std::endl;
+        return results;
+    }
+
+    // every worker takes the next test until none is left, the results keep the order of the tests
+    auto cpus = splitCpus(jobs);
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < jobs; w++) {
+        workers.emplace_back([&, w] {
+            bindToCpus(cpus[w]);
+            for (size_t i = next++; i < count; i = next++) {
+                results[i] = runTestOrFail(gguf_reader, device, device_id, warm_ups, iterations, rtol, atol, i);
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
     }
 
     return results;
@@ -73,8 +157,8 @@ std::shared_ptr<Result> runTest(const GGUFFileReader &gguf_reader,
                                 infiniDevice_t device, int device_id,
                                 size_t warm_ups, size_t iterations,
                                 double rtol, double atol, size_t test_id) {
-    auto meta = gguf_reader.getAttributeMap();
-    auto tensor_info = gguf_reader.getTensorInfoMap();
+    const auto &meta = gguf_reader.getAttributeMap();
+    const auto &tensor_info = gguf_reader.getTensorInfoMap();
     auto name_meta = meta.find("test." + std::to_string(test_id) + ".op_name");
     if (name_meta != meta.end()) {
         std::string op_name(name_meta->second->value.begin(), name_meta->second->value.end());
@@ -99,6 +183,7 @@ std::shared_ptr<Result> runTest(const GGUFFileReader &gguf_reader,
                 bool is_output = std::find(builder.output_names.begin(), builder.output_names.end(), tensor_name) != builder.output_names.end();
                 tensors[tensor_name] = std::make_shared<Tensor>(
                     info->second.get(),
+                    gguf_reader.getFileMapping(),
                     gguf_reader.getGgmlStart(),
                     shape != meta.end() ? shape->second.get() : nullptr,
                     strides != meta.end() ? strides->second.get() : nullptr,
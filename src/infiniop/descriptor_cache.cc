@@ -0,0 +1,180 @@
+#include "descriptor_cache.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace op::descriptor_cache {
+
+struct Entry {
+    std::string key;
+    void *desc;
+    std::function<infiniStatus_t(void *)> destroy;
+    // creates that returned the descriptor and have not destroyed it yet
+    size_t users;
+    // false once dropped from the cache, the last user destroys it
+    bool cached;
+};
+
+struct Cache {
+    size_t capacity;
+    size_t hits = 0, misses = 0;
+    // most recently used first
+    std::list<Entry *> lru;
+    std::unordered_map<std::string, std::list<Entry *>::iterator> index;
+};
+
+namespace {
+
+// guards every cache and the entries, creates and destroys run outside of it
+std::mutex mutex;
+// every descriptor created through a cache and not destroyed yet
+std::unordered_map<void *, std::unique_ptr<Entry>> entries;
+
+thread_local bool bypass = false;
+
+// drops the least recently used descriptors beyond `capacity`, returns those nobody uses
+std::vector<std::unique_ptr<Entry>> shrink(Cache &cache, size_t capacity) {
+    std::vector<std::unique_ptr<Entry>> unused;
+    while (cache.lru.size() > capacity) {
+        Entry *entry = cache.lru.back();
+        cache.lru.pop_back();
+        cache.index.erase(entry->key);
+        entry->cached = false;
+        if (entry->users == 0) {
+            auto it = entries.find(entry->desc);
+            unused.push_back(std::move(it->second));
+            entries.erase(it);
+        }
+    }
+    return unused;
+}
+
+infiniStatus_t destroyAll(std::vector<std::unique_ptr<Entry>> unused) {
+    infiniStatus_t status = INFINI_STATUS_SUCCESS;
+    for (auto &entry : unused) {
+        auto entry_status = entry->destroy(entry->desc);
+        if (status == INFINI_STATUS_SUCCESS) {
+            status = entry_status;
+        }
+    }
+    return status;
+}
+
+} // namespace
+
+bool bypassed() {
+    bool result = bypass;
+    bypass = false;
+    return result;
+}
+
+void setBypassed() {
+    bypass = true;
+}
+
+void *acquire(infiniopHandle_t handle, const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &cache = *handle->descriptor_cache;
+    auto it = cache.index.find(key);
+    if (it == cache.index.end()) {
+        ++cache.misses;
+        return nullptr;
+    }
+    ++cache.hits;
+    Entry *entry = *it->second;
+    cache.lru.splice(cache.lru.begin(), cache.lru, it->second);
+    ++entry->users;
+    return entry->desc;
+}
+
+void insert(infiniopHandle_t handle, const std::string &key, void *desc, std::function<infiniStatus_t(void *)> destroy) {
+    std::vector<std::unique_ptr<Entry>> unused;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &cache = *handle->descriptor_cache;
+        if (cache.index.count(key) != 0) {
+            return;
+        }
+        auto entry = std::make_unique<Entry>(Entry{key, desc, std::move(destroy), 1, true});
+        cache.lru.push_front(entry.get());
+        cache.index.emplace(key, cache.lru.begin());
+        entries.emplace(desc, std::move(entry));
+        unused = shrink(cache, cache.capacity);
+    }
+    destroyAll(std::move(unused));
+}
+
+bool release(void *desc, infiniStatus_t *status) {
+    std::unique_ptr<Entry> unused;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(desc);
+        if (it == entries.end()) {
+            return false;
+        }
+        Entry *entry = it->second.get();
+        --entry->users;
+        if (entry->cached || entry->users != 0) {
+            *status = INFINI_STATUS_SUCCESS;
+            return true;
+        }
+        unused = std::move(it->second);
+        entries.erase(it);
+    }
+    // the descriptor is unknown to the cache now, its destroy frees it
+    *status = unused->destroy(unused->desc);
+    return true;
+}
+
+} // namespace op::descriptor_cache
+
+__C infiniStatus_t infiniopSetDescriptorCacheCapacity(infiniopHandle_t handle, size_t capacity) {
+    if (handle == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    using namespace op::descriptor_cache;
+    std::vector<std::unique_ptr<Entry>> unused;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto *cache = handle->descriptor_cache;
+        if (cache == nullptr) {
+            if (capacity != 0) {
+                handle->descriptor_cache = new Cache{capacity};
+            }
+            return INFINI_STATUS_SUCCESS;
+        }
+        cache->capacity = capacity;
+        unused = shrink(*cache, capacity);
+        if (capacity == 0) {
+            handle->descriptor_cache = nullptr;
+            delete cache;
+        }
+    }
+    return destroyAll(std::move(unused));
+}
+
+__C infiniStatus_t infiniopGetDescriptorCacheStats(
+    infiniopHandle_t handle,
+    size_t *hits,
+    size_t *misses,
+    size_t *size) {
+
+    if (handle == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    using namespace op::descriptor_cache;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto *cache = handle->descriptor_cache;
+    if (hits != nullptr) {
+        *hits = cache ? cache->hits : 0;
+    }
+    if (misses != nullptr) {
+        *misses = cache ? cache->misses : 0;
+    }
+    if (size != nullptr) {
+        *size = cache ? cache->lru.size() : 0;
+    }
+    return INFINI_STATUS_SUCCESS;
+}
@@ -0,0 +1,159 @@
+#ifndef __INFINIOP_DESCRIPTOR_CACHE_H__
+#define __INFINIOP_DESCRIPTOR_CACHE_H__
+
+#include "handle.h"
+#include "tensor.h"
+#include "trace.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+namespace op::descriptor_cache {
+
+// bytes identifying the arguments a descriptor is created from
+class Key {
+    std::string _bytes;
+
+    void append(const void *data, size_t size) {
+        _bytes.append(reinterpret_cast<const char *>(data), size);
+    }
+
+public:
+    Key &add(infiniopTensorDescriptor_t desc) {
+        if (desc == nullptr) {
+            size_t none = SIZE_MAX;
+            append(&none, sizeof(none));
+            return *this;
+        }
+        size_t ndim = desc->ndim();
+        infiniDtype_t dtype = desc->dtype();
+        append(&ndim, sizeof(ndim));
+        append(&dtype, sizeof(dtype));
+        for (size_t i = 0; i < ndim; ++i) {
+            size_t dim = desc->dim(i);
+            ptrdiff_t stride = desc->stride(i);
+            append(&dim, sizeof(dim));
+            append(&stride, sizeof(stride));
+        }
+        return *this;
+    }
+
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>, int> = 0>
+    Key &add(T value) {
+        append(&value, sizeof(value));
+        return *this;
+    }
+
+    // arrays passed by pointer, keyed by content; a null array differs from an empty one
+    template <typename T>
+    Key &addArray(const T *data, size_t count) {
+        add(data != nullptr);
+        if (data != nullptr) {
+            append(data, count * sizeof(T));
+        }
+        return *this;
+    }
+
+    Key &append(const Key &other) {
+        _bytes += other._bytes;
+        return *this;
+    }
+
+    const std::string &bytes() const { return _bytes; }
+};
+
+// Whether the create running on this thread was called by the cache on a miss; clears the flag.
+bool bypassed();
+void setBypassed();
+
+// the descriptor cached under `key` with one more user, or null
+void *acquire(infiniopHandle_t handle, const std::string &key);
+
+// caches `desc` under `key` with one user, unless another thread did it first
+void insert(infiniopHandle_t handle, const std::string &key, void *desc, std::function<infiniStatus_t(void *)> destroy);
+
+// Takes a user away from `desc` if it is cached, destroying it when it was dropped from the cache
+// and this was its last user. Returns false for descriptors the cache does not know.
+bool release(void *desc, infiniStatus_t *status);
+
+/**
+ * Creates a descriptor through the cache of `handle` when it has one, and gives it the bytes of
+ * its tensors for tracing, and their signature while a trace runs. The key is made of `create_fn` and every argument after
+ * `desc_ptr`; pointers other than tensor descriptors can not be keyed and must be covered by
+ * `extra`.
+ */
+template <bool HasExtra, typename Desc, typename... Params, typename... Args>
+infiniStatus_t create(infiniStatus_t (*create_fn)(infiniopHandle_t, Desc *, Params...),
+                      infiniStatus_t (*destroy_fn)(Desc),
+                      const Key &extra,
+                      infiniopHandle_t handle,
+                      Desc *desc_ptr,
+                      Args... args) {
+    const bool cached = handle->descriptor_cache != nullptr;
+    Key key;
+    if (cached) {
+        key.add(reinterpret_cast<uintptr_t>(create_fn));
+        auto add = [&key](auto arg) {
+            using T = decltype(arg);
+            if constexpr (std::is_same_v<T, infiniopTensorDescriptor_t>) {
+                key.add(arg);
+            } else if constexpr (std::is_pointer_v<T>) {
+                static_assert(HasExtra, "pointer arguments must be keyed by the caller");
+            } else {
+                key.add(arg);
+            }
+        };
+        (add(Params(args)), ...);
+        key.append(extra);
+        if (auto desc = acquire(handle, key.bytes())) {
+            *desc_ptr = reinterpret_cast<Desc>(desc);
+            return INFINI_STATUS_SUCCESS;
+        }
+    }
+
+    setBypassed();
+    CHECK_STATUS(create_fn(handle, desc_ptr, Params(args)...));
+    // the bytes are counted for every descriptor, a trace may start while it lives; the signature
+    // takes a string and a lock, so only descriptors created while tracing show their shapes
+    auto desc = reinterpret_cast<InfiniopDescriptor *>(*desc_ptr);
+    desc->trace_bytes = op::trace::tensorBytes(Params(args)...);
+    if (op::trace::enabled()) {
+        desc->trace_signature = op::trace::describe(Params(args)...);
+    }
+    if (cached) {
+        insert(handle, key.bytes(), *desc_ptr, [destroy_fn](void *desc) { return destroy_fn(reinterpret_cast<Desc>(desc)); });
+    }
+    return INFINI_STATUS_SUCCESS;
+}
+
+} // namespace op::descriptor_cache
+
+// Placed first in a descriptor create entry point, serves the create from the cache of the handle
+// and labels the descriptor for tracing.
+#define INFINIOP_DESCRIPTOR_CACHE(CREATE, DESTROY, HANDLE, DESC_PTR, ...)                                  \
+    do {                                                                                                   \
+        if ((HANDLE) != nullptr && !op::descriptor_cache::bypassed()) {                                    \
+            return op::descriptor_cache::create<false>(CREATE, DESTROY, op::descriptor_cache::Key(),       \
+                                                       HANDLE, DESC_PTR, __VA_ARGS__);                     \
+        }                                                                                                  \
+    } while (0)
+
+// the same for creates taking arrays by pointer, `EXTRA` is a Key holding their contents
+#define INFINIOP_DESCRIPTOR_CACHE_WITH_KEY(EXTRA, CREATE, DESTROY, HANDLE, DESC_PTR, ...)                 \
+    do {                                                                                                   \
+        if ((HANDLE) != nullptr && !op::descriptor_cache::bypassed()) {                                    \
+            return op::descriptor_cache::create<true>(CREATE, DESTROY, EXTRA, HANDLE, DESC_PTR, __VA_ARGS__); \
+        }                                                                                                  \
+    } while (0)
+
+// Placed first in a descriptor destroy entry point, leaves cached descriptors to the cache.
+#define INFINIOP_DESCRIPTOR_CACHE_RELEASE(DESC)                            \
+    do {                                                                   \
+        infiniStatus_t release_status_;                                    \
+        if (op::descriptor_cache::release((void *)(DESC), &release_status_)) { \
+            return release_status_;                                        \
+        }                                                                  \
+    } while (0)
+
+#endif // __INFINIOP_DESCRIPTOR_CACHE_H__
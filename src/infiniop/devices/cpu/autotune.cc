@@ -0,0 +1,155 @@
+#include "autotune.h"
+#include "common_cpu.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace op::common_cpu::autotune {
+
+namespace {
+
+// guards the choices and the file
+std::mutex mutex;
+std::once_flag loaded;
+// "threads\tkernel\tbucket" -> candidate name
+std::unordered_map<std::string, std::string> choices;
+
+std::string cpuModel() {
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.rfind("model name", 0) == 0) {
+            auto colon = line.find(':');
+            if (colon != std::string::npos) {
+                auto model = line.substr(colon + 1);
+                model.erase(0, model.find_first_not_of(' '));
+                // the model is a field of the file
+                std::replace(model.begin(), model.end(), '\t', ' ');
+                return model;
+            }
+        }
+    }
+    return "unknown";
+}
+
+const std::string &model() {
+    static const std::string model = cpuModel();
+    return model;
+}
+
+std::string path() {
+    if (auto path = std::getenv("INFINIOP_TUNING_CACHE")) {
+        return path;
+    }
+    if (auto root = std::getenv("INFINI_ROOT")) {
+        return std::string(root) + "/tuning_cache.tsv";
+    }
+    if (auto home = std::getenv("HOME")) {
+        return std::string(home) + "/.infini/tuning_cache.tsv";
+    }
+    return "tuning_cache.tsv";
+}
+
+std::string choiceKey(const std::string &kernel, const std::string &bucket) {
+    return std::to_string(getMaxThreads()) + '\t' + kernel + '\t' + bucket;
+}
+
+// seconds taken by the fastest of a few runs, after a warm-up run
+double measure(const std::function<void(size_t)> &run, size_t candidate) {
+    using clock = std::chrono::steady_clock;
+    run(candidate);
+    double best = 1e30, total = 0;
+    for (int rep = 0; rep < 50 && (rep < 3 || total < 0.02); ++rep) {
+        auto start = clock::now();
+        run(candidate);
+        double t = std::chrono::duration<double>(clock::now() - start).count();
+        best = std::min(best, t);
+        total += t;
+    }
+    return best;
+}
+
+} // namespace
+
+void load() {
+    std::call_once(loaded, [] {
+        // lines are "model\tthreads\tkernel\tbucket\tcandidate", later lines win
+        std::ifstream file(path());
+        std::string line;
+        std::lock_guard<std::mutex> lock(mutex);
+        while (std::getline(file, line)) {
+            auto tab = line.find('\t');
+            auto last = line.rfind('\t');
+            if (tab == std::string::npos || last == tab || line.compare(0, tab, model()) != 0) {
+                continue;
+            }
+            choices[line.substr(tab + 1, last - tab - 1)] = line.substr(last + 1);
+        }
+    });
+}
+
+bool enabled() {
+    static const bool enabled = [] {
+        auto value = std::getenv("INFINIOP_AUTOTUNE");
+        return value != nullptr && std::string(value) == "1";
+    }();
+    return enabled;
+}
+
+std::string bucket(const std::string &tag, std::initializer_list<size_t> dims) {
+    std::ostringstream out;
+    out << tag;
+    for (size_t dim : dims) {
+        size_t rounded = 1;
+        while (rounded < dim) {
+            rounded *= 2;
+        }
+        out << '_' << rounded;
+    }
+    return out.str();
+}
+
+size_t select(const std::string &kernel,
+              const std::string &bucket,
+              const std::vector<std::string> &candidates,
+              size_t fallback,
+              const std::function<void(size_t)> &run) {
+    load();
+    auto key = choiceKey(kernel, bucket);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = choices.find(key);
+        if (it != choices.end()) {
+            auto found = std::find(candidates.begin(), candidates.end(), it->second);
+            // a choice no longer offered by the kernel is measured again
+            if (found != candidates.end()) {
+                return size_t(found - candidates.begin());
+            }
+        }
+    }
+    if (!enabled()) {
+        return fallback;
+    }
+
+    size_t best = fallback;
+    double best_time = 1e30;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        double t = measure(run, i);
+        if (t < best_time) {
+            best = i;
+            best_time = t;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    choices[key] = candidates[best];
+    std::ofstream file(path(), std::ios::app);
+    file << model() << '\t' << key << '\t' << candidates[best] << '\n';
+    return best;
+}
+
+} // namespace op::common_cpu::autotune
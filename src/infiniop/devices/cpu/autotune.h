@@ -0,0 +1,45 @@
+#ifndef __INFINIOP_CPU_AUTOTUNE_H__
+#define __INFINIOP_CPU_AUTOTUNE_H__
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+/**
+ * Choice among the variants of a CPU kernel, by measurement.
+ *
+ * A kernel names its candidates and, for a new shape class, times each one and keeps the fastest.
+ * Choices are kept per CPU model and thread count in a file, loaded once per process when the
+ * first CPU handle is created, so later processes reuse them without measuring again.
+ *
+ * Measuring only happens with INFINIOP_AUTOTUNE=1 in the environment; otherwise kernels use the
+ * choices found in the file and their defaults elsewhere. The file is INFINIOP_TUNING_CACHE, or
+ * tuning_cache.tsv under INFINI_ROOT (~/.infini by default).
+ */
+namespace op::common_cpu::autotune {
+
+// reads the choices stored for this CPU, once per process
+void load();
+
+// whether kernels may measure their candidates
+bool enabled();
+
+// a shape class: the dims rounded up to powers of two, after a tag such as the dtype
+std::string bucket(const std::string &tag, std::initializer_list<size_t> dims);
+
+/**
+ * Returns the index in `candidates` chosen for `kernel` on `bucket`. When nothing is stored and
+ * tuning is enabled, times `run(i)` for every candidate and stores the fastest; when it is not,
+ * returns `fallback`.
+ */
+size_t select(const std::string &kernel,
+              const std::string &bucket,
+              const std::vector<std::string> &candidates,
+              size_t fallback,
+              const std::function<void(size_t)> &run);
+
+} // namespace op::common_cpu::autotune
+
+#endif // __INFINIOP_CPU_AUTOTUNE_H__
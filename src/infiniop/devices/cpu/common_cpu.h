@@ -30,6 +30,24 @@ size_t getPaddedSize(size_t ndim, size_t *shape, const size_t *pads);
 // calculate the padded shape and store the result in padded_shape
 std::vector<size_t> getPaddedShape(size_t ndim, const size_t *shape, const size_t *pads);
 
+// number of threads a parallel region may use (1 when built without OpenMP)
+inline size_t getMaxThreads() {
+#ifdef ENABLE_OMP
+    return size_t(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+// index of the calling thread inside the current parallel region
+inline size_t getThreadId() {
+#ifdef ENABLE_OMP
+    return size_t(omp_get_thread_num());
+#else
+    return 0;
+#endif
+}
+
 } // namespace op::common_cpu
 
 #endif // __INFINIOP__COMMON_CPU_H__
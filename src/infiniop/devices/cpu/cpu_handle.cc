@@ -1,12 +1,47 @@
 #include "cpu_handle.h"
+#include "autotune.h"
+#include "cpu_isa.h"
+#include "infinirt.h"
+
+#ifdef ENABLE_OMP
+#include <omp.h>
+#endif
 
 namespace device::cpu {
 
 Handle::Handle() : InfiniopHandle{INFINI_DEVICE_CPU, 0} {}
 
 infiniStatus_t Handle::create(InfiniopHandle **handle_ptr, int) {
+    op::common_cpu::isa::init();
+    op::common_cpu::autotune::load();
     *handle_ptr = new Handle{};
     return INFINI_STATUS_SUCCESS;
 }
 
+infiniStatus_t Handle::bindToNumaNode(int node) {
+    int cpus;
+    CHECK_STATUS(infinirtGetNumaNodeCpuCount(node, &cpus));
+    if (cpus == 0) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    CHECK_STATUS(infinirtBindThreadToNumaNode(node));
+#ifdef ENABLE_OMP
+    // the threads of a team are kept for the following regions of the thread, binding them once
+    // binds the operators run from it
+    omp_set_num_threads(cpus);
+    infiniStatus_t status = INFINI_STATUS_SUCCESS;
+#pragma omp parallel num_threads(cpus)
+    {
+        auto thread_status = infinirtBindThreadToNumaNode(node);
+        if (thread_status != INFINI_STATUS_SUCCESS) {
+#pragma omp critical
+            status = thread_status;
+        }
+    }
+    CHECK_STATUS(status);
+#endif
+    numa_node = node;
+    return INFINI_STATUS_SUCCESS;
+}
+
 } // namespace device::cpu
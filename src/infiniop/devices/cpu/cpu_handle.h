@@ -10,6 +10,11 @@ class Handle : public InfiniopHandle {
 
 public:
     static infiniStatus_t create(InfiniopHandle **handle_ptr, int);
+
+    // binds the calling thread and its OpenMP team to `node`, -1 for every CPU of the process
+    infiniStatus_t bindToNumaNode(int node);
+
+    int numa_node = -1;
 };
 
 } // namespace device::cpu
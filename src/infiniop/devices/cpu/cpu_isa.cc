@@ -0,0 +1,247 @@
+// the intrinsics headers come first, they name parameters `__C`, which infinicore.h defines
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define INFINIOP_ISA_X86
+#include <immintrin.h>
+#endif
+
+#include "cpu_isa.h"
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+namespace op::common_cpu::isa {
+
+std::atomic<const Kernels *> active{nullptr};
+
+namespace {
+
+void multiplyPanelBaseline(
+    float *acc, size_t ld_acc,
+    size_t mb, size_t nb, size_t kc,
+    const float *a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+    const float *pack) {
+
+    for (size_t i = 0; i < mb; ++i) {
+        const float *a_row = a + i * a_rs;
+        float *c_row = acc + i * ld_acc;
+        for (size_t p = 0; p < kc; ++p) {
+            const float a_val = a_row[p * a_cs];
+            const float *b_row = pack + p * nb;
+            for (size_t j = 0; j < nb; ++j) {
+                c_row[j] += a_val * b_row[j];
+            }
+        }
+    }
+}
+
+void f16ToF32Baseline(float *dst, const fp16_t *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = _f16_to_f32(src[i]);
+    }
+}
+
+void bf16ToF32Baseline(float *dst, const bf16_t *src, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t bits = uint32_t(src[i]._v) << 16;
+        std::memcpy(dst + i, &bits, sizeof(float));
+    }
+}
+
+/**
+ * The panel kernel of one vector width: each row of C is walked in blocks of four vectors kept in
+ * registers over the whole depth of the panel, then in single vectors, then in scalars.
+ */
+#define DEFINE_MULTIPLY_PANEL(NAME, VEC, WIDTH, LOAD, STORE, SET1, MADD)       \
+    void NAME(                                                                 \
+        float *acc, size_t ld_acc,                                             \
+        size_t mb, size_t nb, size_t kc,                                       \
+        const float *a, ptrdiff_t a_rs, ptrdiff_t a_cs,                        \
+        const float *pack) {                                                   \
+        for (size_t i = 0; i < mb; ++i) {                                      \
+            const float *a_row = a + i * a_rs;                                 \
+            float *c_row = acc + i * ld_acc;                                   \
+            size_t j = 0;                                                      \
+            for (; j + 4 * WIDTH <= nb; j += 4 * WIDTH) {                      \
+                VEC c0 = LOAD(c_row + j), c1 = LOAD(c_row + j + WIDTH),        \
+                    c2 = LOAD(c_row + j + 2 * WIDTH),                          \
+                    c3 = LOAD(c_row + j + 3 * WIDTH);                          \
+                for (size_t p = 0; p < kc; ++p) {                              \
+                    VEC a_val = SET1(a_row[p * a_cs]);                         \
+                    const float *b_row = pack + p * nb + j;                    \
+                    c0 = MADD(a_val, LOAD(b_row), c0);                         \
+                    c1 = MADD(a_val, LOAD(b_row + WIDTH), c1);                 \
+                    c2 = MADD(a_val, LOAD(b_row + 2 * WIDTH), c2);             \
+                    c3 = MADD(a_val, LOAD(b_row + 3 * WIDTH), c3);             \
+                }                                                              \
+                STORE(c_row + j, c0);                                          \
+                STORE(c_row + j + WIDTH, c1);                                  \
+                STORE(c_row + j + 2 * WIDTH, c2);                              \
+                STORE(c_row + j + 3 * WIDTH, c3);                              \
+            }                                                                  \
+            for (; j + WIDTH <= nb; j += WIDTH) {                              \
+                VEC c0 = LOAD(c_row + j);                                      \
+                for (size_t p = 0; p < kc; ++p) {                              \
+                    c0 = MADD(SET1(a_row[p * a_cs]), LOAD(pack + p * nb + j), c0); \
+                }                                                              \
+                STORE(c_row + j, c0);                                          \
+            }                                                                  \
+            for (; j < nb; ++j) {                                              \
+                float sum = c_row[j];                                          \
+                for (size_t p = 0; p < kc; ++p) {                              \
+                    sum += a_row[p * a_cs] * pack[p * nb + j];                 \
+                }                                                              \
+                c_row[j] = sum;                                                \
+            }                                                                  \
+        }                                                                      \
+    }
+
+#ifdef INFINIOP_ISA_X86
+
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+
+inline __m128 madd128(__m128 a, __m128 b, __m128 c) {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+}
+
+DEFINE_MULTIPLY_PANEL(multiplyPanelSse42, __m128, 4, _mm_loadu_ps, _mm_storeu_ps, _mm_set1_ps, madd128)
+
+void bf16ToF32Sse42(float *dst, const bf16_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtepu16_epi32(h), 16)));
+    }
+    bf16ToF32Baseline(dst + i, src + i, n - i);
+}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,fma,f16c")
+
+DEFINE_MULTIPLY_PANEL(multiplyPanelAvx2, __m256, 8, _mm256_loadu_ps, _mm256_storeu_ps, _mm256_set1_ps, _mm256_fmadd_ps)
+
+void f16ToF32Avx2(float *dst, const fp16_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    f16ToF32Baseline(dst + i, src + i, n - i);
+}
+
+void bf16ToF32Avx2(float *dst, const bf16_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16)));
+    }
+    bf16ToF32Baseline(dst + i, src + i, n - i);
+}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,f16c,fma")
+// the AVX-512 intrinsics start from deliberately undefined vectors, which GCC 12 warns about
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+DEFINE_MULTIPLY_PANEL(multiplyPanelAvx512, __m512, 16, _mm512_loadu_ps, _mm512_storeu_ps, _mm512_set1_ps, _mm512_fmadd_ps)
+
+void f16ToF32Avx512(float *dst, const fp16_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+    }
+    f16ToF32Baseline(dst + i, src + i, n - i);
+}
+
+void bf16ToF32Avx512(float *dst, const bf16_t *src, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16)));
+    }
+    bf16ToF32Baseline(dst + i, src + i, n - i);
+}
+
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+
+#endif // INFINIOP_ISA_X86
+
+#undef DEFINE_MULTIPLY_PANEL
+
+const Kernels TABLES[] = {
+    {Level::BASELINE, multiplyPanelBaseline, f16ToF32Baseline, bf16ToF32Baseline},
+#ifdef INFINIOP_ISA_X86
+    {Level::SSE4_2, multiplyPanelSse42, f16ToF32Baseline, bf16ToF32Sse42},
+    {Level::AVX2, multiplyPanelAvx2, f16ToF32Avx2, bf16ToF32Avx2},
+    {Level::AVX512, multiplyPanelAvx512, f16ToF32Avx512, bf16ToF32Avx512},
+#endif
+};
+
+// the highest level the CPU and the operating system support
+Level detect() {
+#if defined(INFINIOP_ISA_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl")
+        && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c")) {
+        return Level::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c")) {
+        return Level::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+        return Level::SSE4_2;
+    }
+#endif
+    return Level::BASELINE;
+}
+
+const Kernels *table(Level level) {
+    for (const auto &kernels : TABLES) {
+        if (kernels.level == level) {
+            return &kernels;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+const char *name(Level level) {
+    switch (level) {
+    case Level::BASELINE:
+        return "baseline";
+    case Level::SSE4_2:
+        return "sse4.2";
+    case Level::AVX2:
+        return "avx2";
+    case Level::AVX512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+void init() {
+    static std::once_flag detected;
+    std::call_once(detected, [] {
+        Level level = detect();
+        // a forced level is only honored below the detected one, on the same architecture
+        if (auto forced = std::getenv("INFINIOP_CPU_ISA")) {
+            for (const auto &kernels : TABLES) {
+                if (name(kernels.level) == std::string(forced) && kernels.level <= level) {
+                    level = kernels.level;
+                }
+            }
+        }
+        active.store(table(level), std::memory_order_release);
+    });
+}
+
+} // namespace op::common_cpu::isa
@@ -0,0 +1,57 @@
+#ifndef __INFINIOP_CPU_ISA_H__
+#define __INFINIOP_CPU_ISA_H__
+
+#include "../../../utils.h"
+#include <atomic>
+#include <cstddef>
+
+/**
+ * Kernels built for several instruction set levels, bound at run time.
+ *
+ * The library is compiled for the baseline of the target architecture so that one binary runs on
+ * every machine. The kernels below are also compiled for higher levels, and the highest level the
+ * CPU supports is picked once, when the first CPU handle is created. INFINIOP_CPU_ISA forces a
+ * lower level: baseline, sse4.2, avx2 or avx512. Only x86 has levels above the baseline so far,
+ * a level is added with the kernels that make it differ from the one below.
+ */
+namespace op::common_cpu::isa {
+
+enum class Level : int {
+    BASELINE,
+    // x86
+    SSE4_2,
+    AVX2,   // with FMA and F16C
+    AVX512, // F, BW and VL
+};
+
+struct Kernels {
+    Level level;
+    // acc[i * ld_acc + j] += sum_p a[i * a_rs + p * a_cs] * pack[p * nb + j]
+    void (*multiply_panel)(
+        float *acc, size_t ld_acc,
+        size_t mb, size_t nb, size_t kc,
+        const float *a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+        const float *pack);
+    void (*f16_to_f32)(float *dst, const fp16_t *src, size_t n);
+    void (*bf16_to_f32)(float *dst, const bf16_t *src, size_t n);
+};
+
+extern std::atomic<const Kernels *> active;
+
+// detects the CPU features and binds the kernels, once per process
+void init();
+
+const char *name(Level level);
+
+inline const Kernels &kernels() {
+    auto kernels = active.load(std::memory_order_acquire);
+    if (kernels == nullptr) {
+        init();
+        kernels = active.load(std::memory_order_acquire);
+    }
+    return *kernels;
+}
+
+} // namespace op::common_cpu::isa
+
+#endif // __INFINIOP_CPU_ISA_H__
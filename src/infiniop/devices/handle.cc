@@ -71,6 +71,8 @@ __C infiniStatus_t infiniopCreateHandle(infiniopHandle_t *handle_ptr) {
 }
 
 __C infiniStatus_t infiniopDestroyHandle(infiniopHandle_t handle) {
+    // descriptors still in use are destroyed by their last user
+    CHECK_STATUS(infiniopSetDescriptorCacheCapacity(handle, 0));
 
 #define DELETE(CASE, NAMESPACE)                                       \
     case CASE:                                                        \
@@ -108,3 +110,32 @@ __C infiniStatus_t infiniopDestroyHandle(infiniopHandle_t handle) {
 
 #undef DELETE
 }
+
+__C infiniStatus_t infiniopSetHandleNumaNode(infiniopHandle_t handle, int node) {
+    if (handle == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    switch (handle->device) {
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        return reinterpret_cast<device::cpu::Handle *>(handle)->bindToNumaNode(node);
+#endif
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+}
+
+__C infiniStatus_t infiniopGetHandleNumaNode(infiniopHandle_t handle, int *node) {
+    if (handle == nullptr || node == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    switch (handle->device) {
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        *node = reinterpret_cast<device::cpu::Handle *>(handle)->numa_node;
+        return INFINI_STATUS_SUCCESS;
+#endif
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+}
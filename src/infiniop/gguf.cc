@@ -0,0 +1,470 @@
+#include "gguf.h"
+#include "infinirt.h"
+#include <cstdint>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// value types of the metadata
+enum GGUFType : uint32_t {
+    GGUF_UINT8 = 0,
+    GGUF_INT8 = 1,
+    GGUF_UINT16 = 2,
+    GGUF_INT16 = 3,
+    GGUF_UINT32 = 4,
+    GGUF_INT32 = 5,
+    GGUF_FLOAT32 = 6,
+    GGUF_BOOL = 7,
+    GGUF_STRING = 8,
+    GGUF_ARRAY = 9,
+    GGUF_UINT64 = 10,
+    GGUF_INT64 = 11,
+    GGUF_FLOAT64 = 12,
+};
+
+constexpr size_t DEFAULT_ALIGNMENT = 32;
+// array nesting accepted in the metadata
+constexpr int MAX_DEPTH = 8;
+
+// the dtype of a ggml tensor type, INVALID for the quantized ones
+infiniDtype_t toDtype(uint32_t ggml_type) {
+    switch (ggml_type) {
+    case 0:
+        return INFINI_DTYPE_F32;
+    case 1:
+        return INFINI_DTYPE_F16;
+    case 24:
+        return INFINI_DTYPE_I8;
+    case 25:
+        return INFINI_DTYPE_I16;
+    case 26:
+        return INFINI_DTYPE_I32;
+    case 27:
+        return INFINI_DTYPE_I64;
+    case 28:
+        return INFINI_DTYPE_F64;
+    case 30:
+        return INFINI_DTYPE_BF16;
+    default:
+        return INFINI_DTYPE_INVALID;
+    }
+}
+
+size_t scalarSize(uint32_t type) {
+    switch (type) {
+    case GGUF_UINT8:
+    case GGUF_INT8:
+    case GGUF_BOOL:
+        return 1;
+    case GGUF_UINT16:
+    case GGUF_INT16:
+        return 2;
+    case GGUF_UINT32:
+    case GGUF_INT32:
+    case GGUF_FLOAT32:
+        return 4;
+    case GGUF_UINT64:
+    case GGUF_INT64:
+    case GGUF_FLOAT64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+// reads the header of the file, failing instead of reading past its end
+class Reader {
+    const uint8_t *_cursor, *_end;
+    bool _ok = true;
+
+public:
+    Reader(const uint8_t *begin, const uint8_t *end) : _cursor(begin), _end(end) {}
+
+    bool ok() const { return _ok; }
+    const uint8_t *cursor() const { return _cursor; }
+
+    bool skip(uint64_t n) {
+        if (!_ok || n > uint64_t(_end - _cursor)) {
+            _ok = false;
+            return false;
+        }
+        _cursor += n;
+        return true;
+    }
+
+    template <typename T>
+    T read() {
+        T value{};
+        auto start = _cursor;
+        if (skip(sizeof(T))) {
+            std::memcpy(&value, start, sizeof(T));
+        }
+        return value;
+    }
+
+    std::string readString() {
+        auto length = read<uint64_t>();
+        auto start = _cursor;
+        return skip(length) ? std::string(reinterpret_cast<const char *>(start), length) : std::string();
+    }
+
+    // skips a metadata value of `type`
+    void skipValue(uint32_t type, int depth = 0) {
+        if (type == GGUF_STRING) {
+            skip(read<uint64_t>());
+        } else if (type == GGUF_ARRAY) {
+            auto element_type = read<uint32_t>();
+            auto count = read<uint64_t>();
+            if (element_type == GGUF_STRING || element_type == GGUF_ARRAY) {
+                _ok = _ok && depth < MAX_DEPTH;
+                for (uint64_t i = 0; _ok && i < count; ++i) {
+                    skipValue(element_type, depth + 1);
+                }
+            } else if (scalarSize(element_type) == 0 || count > UINT64_MAX / scalarSize(element_type)) {
+                _ok = false;
+            } else {
+                skip(count * scalarSize(element_type));
+            }
+        } else if (scalarSize(type) == 0) {
+            _ok = false;
+        } else {
+            skip(scalarSize(type));
+        }
+    }
+};
+
+} // namespace
+
+InfiniopGGUFFile::~InfiniopGGUFFile() {
+    if (worker.joinable()) {
+        stop.store(true, std::memory_order_relaxed);
+        worker.join();
+    }
+    for (auto &tensor : tensors) {
+        delete tensor.desc;
+    }
+#ifdef _WIN32
+    if (base) {
+        UnmapViewOfFile(base);
+    }
+    if (file_mapping) {
+        CloseHandle(file_mapping);
+    }
+    if (file_handle && file_handle != INVALID_HANDLE_VALUE) {
+        CloseHandle(file_handle);
+    }
+#else
+    if (base) {
+        munmap(const_cast<uint8_t *>(base), size);
+    }
+#endif
+}
+
+infiniStatus_t InfiniopGGUFFile::map(const char *path, int flags) {
+#ifdef _WIN32
+    (void)flags;
+    file_handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER file_size;
+    if (file_handle == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_handle, &file_size) || file_size.QuadPart == 0) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    size = size_t(file_size.QuadPart);
+    file_mapping = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!file_mapping) {
+        return INFINI_STATUS_INTERNAL_ERROR;
+    }
+    base = static_cast<const uint8_t *>(MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0));
+    return base ? INFINI_STATUS_SUCCESS : INFINI_STATUS_INTERNAL_ERROR;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) == -1 || sb.st_size == 0) {
+        close(fd);
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    size = size_t(sb.st_size);
+    // shared, so the page cache backs the mapping of every process
+    void *ptr = MAP_FAILED;
+    if (flags & INFINIOP_GGUF_HUGE_PAGES) {
+        // the file is mapped at an address aligned like its offsets to 2 MiB, which huge pages need
+        constexpr size_t HUGE_PAGE = size_t(1) << 21;
+        void *reserved = mmap(nullptr, size + HUGE_PAGE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved != MAP_FAILED) {
+            auto begin = reinterpret_cast<uint8_t *>(reserved);
+            auto aligned = reinterpret_cast<uint8_t *>((reinterpret_cast<uintptr_t>(begin) + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE);
+            ptr = mmap(aligned, size, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0);
+            if (ptr == MAP_FAILED) {
+                munmap(reserved, size + HUGE_PAGE);
+            } else {
+                if (aligned != begin) {
+                    munmap(begin, aligned - begin);
+                }
+                // the file mapping ends at the end of its last page, the slack after it is returned
+                const size_t page = size_t(sysconf(_SC_PAGESIZE));
+                auto mapped_end = aligned + (size + page - 1) / page * page;
+                munmap(mapped_end, begin + size + HUGE_PAGE - mapped_end);
+            }
+        }
+    }
+    if (ptr == MAP_FAILED) {
+        ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        return INFINI_STATUS_INTERNAL_ERROR;
+    }
+    base = static_cast<const uint8_t *>(ptr);
+    return INFINI_STATUS_SUCCESS;
+#endif
+}
+
+infiniStatus_t InfiniopGGUFFile::parse() {
+    Reader reader(base, base + size);
+    if (size < 4 || std::memcmp(base, "GGUF", 4) != 0) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    reader.skip(4);
+    // version 1 counted with 32-bit integers
+    auto version = reader.read<uint32_t>();
+    auto tensor_count = reader.read<uint64_t>();
+    auto kv_count = reader.read<uint64_t>();
+    if (!reader.ok() || version < 2) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    size_t alignment = DEFAULT_ALIGNMENT;
+    for (uint64_t i = 0; reader.ok() && i < kv_count; ++i) {
+        auto key = reader.readString();
+        auto type = reader.read<uint32_t>();
+        if (key == "general.alignment" && type == GGUF_UINT32) {
+            alignment = reader.read<uint32_t>();
+            if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+                return INFINI_STATUS_BAD_PARAM;
+            }
+        } else {
+            reader.skipValue(type);
+        }
+    }
+
+    struct Info {
+        std::vector<size_t> shape;
+        uint32_t ggml_type;
+        uint64_t offset;
+    };
+    std::vector<Info> infos;
+    for (uint64_t i = 0; reader.ok() && i < tensor_count; ++i) {
+        Tensor tensor{reader.readString(), nullptr, nullptr};
+        Info info;
+        auto ndim = reader.read<uint32_t>();
+        if (ndim > 16) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        // the file lists the innermost dimension first
+        info.shape.resize(ndim);
+        for (uint32_t d = 0; d < ndim; ++d) {
+            info.shape[ndim - 1 - d] = size_t(reader.read<uint64_t>());
+        }
+        info.ggml_type = reader.read<uint32_t>();
+        info.offset = reader.read<uint64_t>();
+        if (!index.emplace(tensor.name, tensors.size()).second) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        tensors.push_back(std::move(tensor));
+        infos.push_back(std::move(info));
+    }
+    if (!reader.ok()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    data_begin = utils::align(size_t(reader.cursor() - base), alignment);
+    data_end = data_begin;
+    if (!tensors.empty() && data_begin > size) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        const auto &info = infos[i];
+        if (info.offset % alignment != 0 || info.offset > size - data_begin) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        auto &tensor = tensors[i];
+        tensor.data = base + data_begin + info.offset;
+
+        auto dtype = toDtype(info.ggml_type);
+        if (dtype == INFINI_DTYPE_INVALID) {
+            continue;
+        }
+        size_t bytes = infiniSizeOf(dtype);
+        for (size_t dim : info.shape) {
+            if (dim != 0 && bytes > SIZE_MAX / dim) {
+                return INFINI_STATUS_BAD_TENSOR_SHAPE;
+            }
+            bytes *= dim;
+        }
+        if (bytes > size - data_begin - info.offset) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        data_end = std::max(data_end, size_t(data_begin + info.offset + bytes));
+        std::vector<ptrdiff_t> strides(info.shape.size());
+        ptrdiff_t stride = 1;
+        for (size_t d = strides.size(); d-- > 0;) {
+            strides[d] = stride;
+            stride *= ptrdiff_t(info.shape[d]);
+        }
+        tensor.desc = new InfiniopTensorDescriptor(dtype, info.shape.size(), info.shape.data(), strides.data());
+    }
+    // quantized tensors have no known size, the data runs up to the end of the file then
+    for (const auto &tensor : tensors) {
+        if (tensor.desc == nullptr) {
+            data_end = size;
+        }
+    }
+    return INFINI_STATUS_SUCCESS;
+}
+
+void InfiniopGGUFFile::advise(int flags) {
+    if (data_end == data_begin) {
+        return;
+    }
+#ifndef _WIN32
+    // madvise wants page-aligned addresses, the mapping itself is
+    size_t page = size_t(sysconf(_SC_PAGESIZE));
+    size_t begin = data_begin / page * page;
+    auto addr = const_cast<uint8_t *>(base) + begin;
+    if (flags & INFINIOP_GGUF_PREFETCH) {
+        madvise(addr, data_end - begin, MADV_WILLNEED);
+    }
+#ifdef MADV_HUGEPAGE
+    // only honored by file systems with huge page support for read-only files, harmless elsewhere
+    if (flags & INFINIOP_GGUF_HUGE_PAGES) {
+        madvise(addr, data_end - begin, MADV_HUGEPAGE);
+    }
+#endif
+#endif
+    if (flags & (INFINIOP_GGUF_PREFETCH | INFINIOP_GGUF_LOCK)) {
+        bool lock = (flags & INFINIOP_GGUF_LOCK) != 0;
+        worker = std::thread([this, lock] { touch(lock); });
+    }
+}
+
+void InfiniopGGUFFile::touch(bool lock) {
+    if (lock) {
+        // locking faults the pages in as well
+#ifdef _WIN32
+        bool locked = VirtualLock(const_cast<uint8_t *>(base) + data_begin, data_end - data_begin);
+#else
+        bool locked = mlock(base + data_begin, data_end - data_begin) == 0;
+#endif
+        worker_status = locked ? INFINI_STATUS_SUCCESS : INFINI_STATUS_INTERNAL_ERROR;
+        return;
+    }
+    constexpr size_t STRIDE = 4096;
+    volatile uint8_t sink = 0;
+    // the stop flag is checked every 256 pages, whatever the alignment of data_begin
+    size_t pages = 0;
+    for (size_t offset = data_begin; offset < data_end; offset += STRIDE, ++pages) {
+        if (pages % 256 == 0 && stop.load(std::memory_order_relaxed)) {
+            return;
+        }
+        sink = sink + base[offset];
+    }
+}
+
+__C infiniStatus_t infiniopOpenGGUF(infiniopGGUFFile_t *file_ptr, const char *path, int flags) {
+    if (file_ptr == nullptr || path == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    auto file = new InfiniopGGUFFile;
+    auto status = file->map(path, flags);
+    if (status == INFINI_STATUS_SUCCESS) {
+        status = file->parse();
+    }
+    if (status != INFINI_STATUS_SUCCESS) {
+        delete file;
+        return status;
+    }
+    file->advise(flags);
+    *file_ptr = file;
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopGetGGUFTensorCount(infiniopGGUFFile_t file, size_t *count) {
+    if (file == nullptr || count == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    *count = file->tensors.size();
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopFindGGUFTensor(infiniopGGUFFile_t file, const char *name, size_t *index) {
+    if (file == nullptr || name == nullptr || index == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    auto it = file->index.find(name);
+    if (it == file->index.end()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    *index = it->second;
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopGetGGUFTensor(
+    infiniopGGUFFile_t file,
+    size_t index,
+    const char **name,
+    infiniopTensorDescriptor_t *desc,
+    const void **data) {
+
+    if (file == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (index >= file->tensors.size()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    const auto &tensor = file->tensors[index];
+    if (name) {
+        *name = tensor.name.c_str();
+    }
+    if (desc) {
+        *desc = tensor.desc;
+    }
+    if (data) {
+        *data = tensor.data;
+    }
+    return tensor.desc ? INFINI_STATUS_SUCCESS : INFINI_STATUS_BAD_TENSOR_DTYPE;
+}
+
+__C infiniStatus_t infiniopGetGGUFHugePageBytes(infiniopGGUFFile_t file, size_t *bytes) {
+    if (file == nullptr || bytes == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (file->data_end == file->data_begin) {
+        *bytes = 0;
+        return INFINI_STATUS_SUCCESS;
+    }
+    return infinirtGetHugePageBytes(file->base + file->data_begin, file->data_end - file->data_begin, bytes);
+}
+
+__C infiniStatus_t infiniopWaitGGUF(infiniopGGUFFile_t file) {
+    if (file == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (file->worker.joinable()) {
+        file->worker.join();
+    }
+    return file->worker_status;
+}
+
+__C infiniStatus_t infiniopCloseGGUF(infiniopGGUFFile_t file) {
+    delete file;
+    return INFINI_STATUS_SUCCESS;
+}
@@ -0,0 +1,55 @@
+#ifndef __INFINIOP_GGUF_H__
+#define __INFINIOP_GGUF_H__
+
+#include "infiniop/gguf.h"
+#include "tensor.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+struct InfiniopGGUFFile {
+    struct Tensor {
+        std::string name;
+        // null for the dtypes infiniop has no counterpart of, such as the quantized ones
+        infiniopTensorDescriptor_t desc;
+        const void *data;
+    };
+
+    const uint8_t *base = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file_handle = NULL;
+    HANDLE file_mapping = NULL;
+#endif
+
+    std::vector<Tensor> tensors;
+    std::unordered_map<std::string, size_t> index;
+    // the range holding the data of every tensor
+    size_t data_begin = 0, data_end = 0;
+
+    std::thread worker;
+    std::atomic<bool> stop{false};
+    infiniStatus_t worker_status = INFINI_STATUS_SUCCESS;
+
+    ~InfiniopGGUFFile();
+
+    // with INFINIOP_GGUF_HUGE_PAGES in `flags`, at an address huge pages can back
+    infiniStatus_t map(const char *path, int flags);
+
+    // reads the header and the tensor infos, checking them against the size of the file
+    infiniStatus_t parse();
+
+    // applies the hints of `flags` and starts the background work they ask for
+    void advise(int flags);
+
+    // the background work: touches every page of the data, or locks them
+    void touch(bool lock);
+};
+
+#endif // __INFINIOP_GGUF_H__
@@ -0,0 +1,195 @@
+#include "graph.h"
+#include "../utils.h"
+#include "handle.h"
+#include "trace.h"
+#include <algorithm>
+
+#ifdef ENABLE_OMP
+#include <omp.h>
+#endif
+
+namespace op::graph {
+
+// the handle a capture was begun with on this thread, and the graph it records into
+thread_local infiniopHandle_t capture_handle = nullptr;
+thread_local InfiniopGraph *capture_graph = nullptr;
+
+InfiniopGraph *capturing() {
+    return capture_graph;
+}
+
+// workspaces of nodes that run together are placed at this alignment
+constexpr size_t WORKSPACE_ALIGNMENT = 256;
+
+} // namespace op::graph
+
+void InfiniopGraph::finalize() {
+    // Runs every entry point once with the graph in binding mode, where it returns before reaching
+    // the backend and hands over the backend call instead. The entry point's checks and dispatch
+    // are then left out of the launches, along with its trace, which the launch records itself.
+    op::graph::capture_graph = this;
+    op::trace::suppressed = true;
+    for (auto &node : nodes) {
+        Binding node_binding;
+        binding = &node_binding;
+        infiniStatus_t status = node.run(nullptr, nullptr);
+        if (status == INFINI_STATUS_SUCCESS && node_binding.entries == 1 && node_binding.calls == 1) {
+            node.calculate = std::move(node_binding.calculate);
+        }
+    }
+    binding = nullptr;
+    op::trace::suppressed = false;
+    op::graph::capture_graph = nullptr;
+
+    auto shares_buffer = [](const Node &a, const Node &b) {
+        auto meets = [](const std::vector<const void *> &x, const std::vector<const void *> &y) {
+            for (auto p : x) {
+                if (std::find(y.begin(), y.end(), p) != y.end()) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        // reads of the same buffer do not order two nodes
+        return meets(a.writes, b.reads) || meets(a.writes, b.writes) || meets(a.reads, b.writes);
+    };
+
+    // a node goes one level after the last node it depends on
+    std::vector<size_t> level(nodes.size(), 0);
+    levels.clear();
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        if (!parallel) {
+            level[i] = i;
+        } else {
+            for (size_t j = 0; j < i; ++j) {
+                if (level[j] + 1 > level[i] && shares_buffer(nodes[j], nodes[i])) {
+                    level[i] = level[j] + 1;
+                }
+            }
+        }
+        if (level[i] == levels.size()) {
+            levels.emplace_back();
+        }
+        levels[level[i]].push_back(i);
+    }
+
+    // nodes of one level use disjoint parts of the workspace, levels reuse it
+    workspace_size = 0;
+    for (const auto &nodes_in_level : levels) {
+        size_t offset = 0;
+        for (size_t i : nodes_in_level) {
+            nodes[i].workspace_offset = offset;
+            offset += CEIL_DIV(nodes[i].workspace_size, op::graph::WORKSPACE_ALIGNMENT) * op::graph::WORKSPACE_ALIGNMENT;
+        }
+        workspace_size = std::max(workspace_size, offset);
+    }
+}
+
+infiniStatus_t InfiniopGraph::Node::operator()(void *workspace, void *stream) const {
+    if (!calculate) {
+        return run(workspace, stream);
+    }
+    op::trace::Scope trace_scope(op, desc, workspace_size);
+    return calculate(workspace, stream);
+}
+
+infiniStatus_t InfiniopGraph::launch(void *workspace, size_t workspace_size_, void *stream) const {
+    if (workspace_size_ < workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    auto *ws = reinterpret_cast<char *>(workspace);
+    for (const auto &nodes_in_level : levels) {
+#ifdef ENABLE_OMP
+        const int threads = omp_get_max_threads();
+        if (nodes_in_level.size() > 1 && device == INFINI_DEVICE_CPU && threads > 1) {
+            // The nodes of the level split the thread team: with fewer nodes than threads each
+            // runs its own parallel loops on its share of the threads, with more each gets one
+            // thread and they are dealt out as the threads free up.
+            const int count = int(nodes_in_level.size());
+            const int teams = std::min(count, threads);
+            const int saved_levels = omp_get_max_active_levels();
+            omp_set_max_active_levels(std::max(saved_levels, 2));
+            infiniStatus_t status = INFINI_STATUS_SUCCESS;
+#pragma omp parallel for num_threads(teams) schedule(dynamic, 1)
+            for (int k = 0; k < count; ++k) {
+                const int team = omp_get_thread_num();
+                omp_set_num_threads(count >= threads ? 1 : threads / teams + (team < threads % teams));
+                const Node &node = nodes[nodes_in_level[k]];
+                infiniStatus_t node_status = node(ws + node.workspace_offset, stream);
+                if (node_status != INFINI_STATUS_SUCCESS) {
+#pragma omp critical
+                    status = status == INFINI_STATUS_SUCCESS ? node_status : status;
+                }
+            }
+            omp_set_max_active_levels(saved_levels);
+            CHECK_STATUS(status);
+            continue;
+        }
+#endif
+        for (size_t i : nodes_in_level) {
+            CHECK_STATUS(nodes[i](ws + nodes[i].workspace_offset, stream));
+        }
+    }
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopBeginGraphCapture(infiniopHandle_t handle) {
+    if (handle == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (op::graph::capture_graph != nullptr) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    auto graph = new InfiniopGraph;
+    graph->device = handle->device;
+    graph->device_id = handle->device_id;
+    graph->parallel = false;
+    graph->workspace_size = 0;
+    op::graph::capture_handle = handle;
+    op::graph::capture_graph = graph;
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopEndGraphCapture(
+    infiniopHandle_t handle,
+    infiniopGraph_t *graph_ptr,
+    int parallel) {
+
+    if (handle == nullptr || graph_ptr == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (op::graph::capture_graph == nullptr || op::graph::capture_handle != handle) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    auto graph = op::graph::capture_graph;
+    op::graph::capture_handle = nullptr;
+    op::graph::capture_graph = nullptr;
+
+    graph->parallel = parallel != 0;
+    graph->finalize();
+    *graph_ptr = graph;
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopGetGraphNodeCount(infiniopGraph_t graph, size_t *count) {
+    *count = graph->nodes.size();
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopGetGraphWorkspaceSize(infiniopGraph_t graph, size_t *size) {
+    *size = graph->workspace_size;
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopGraphLaunch(
+    infiniopGraph_t graph,
+    void *workspace,
+    size_t workspace_size,
+    void *stream) {
+    return graph->launch(workspace, workspace_size, stream);
+}
+
+__C infiniStatus_t infiniopDestroyGraph(infiniopGraph_t graph) {
+    delete graph;
+    return INFINI_STATUS_SUCCESS;
+}
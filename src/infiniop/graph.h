@@ -0,0 +1,158 @@
+#ifndef __INFINIOP_GRAPH_H__
+#define __INFINIOP_GRAPH_H__
+
+#include "infiniop/graph.h"
+#include "operator.h"
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+struct InfiniopGraph {
+    using Call = std::function<infiniStatus_t(void *workspace, void *stream)>;
+
+    struct Node {
+        // operator name and descriptor, for the trace of the launches
+        const char *op;
+        const InfiniopDescriptor *desc;
+        // runs the call through the entry point with its workspace and stream replaced
+        Call run;
+        // the backend calculate the entry point dispatches to, bound at finalize; empty when the
+        // entry point makes more than one call, like the composite operators
+        Call calculate;
+        size_t workspace_size;
+        // buffers passed as const pointers and as mutable pointers
+        std::vector<const void *> reads, writes;
+        // position in the workspace of the graph
+        size_t workspace_offset;
+
+        // runs the node in a launch, through `calculate` when bound
+        infiniStatus_t operator()(void *workspace, void *stream) const;
+    };
+
+    infiniDevice_t device;
+    int device_id;
+    bool parallel;
+
+    std::vector<Node> nodes;
+    // nodes of one level share no buffer, levels run in order
+    std::vector<std::vector<size_t>> levels;
+    size_t workspace_size;
+
+    // the calls made while a node is bound at finalize
+    struct Binding {
+        Call calculate;
+        int entries = 0, calls = 0;
+    };
+    Binding *binding = nullptr;
+
+    /**
+     * Records a call of the operator entry point `fn`, named `op`. Its first parameter is the descriptor,
+     * the second and third are the workspace and its size when they are `void *` and `size_t`,
+     * and the last one is the stream. The other pointer parameters are the buffers, read
+     * through when they point to const and written otherwise.
+     */
+    template <typename... Params, typename... Args>
+    infiniStatus_t record(const char *op, infiniStatus_t (*fn)(Params...), Args... args) {
+        static_assert(sizeof...(Params) == sizeof...(Args) && sizeof...(Params) >= 2, "bad operator entry point");
+        using Tuple = std::tuple<Params...>;
+        constexpr size_t count = sizeof...(Params);
+        constexpr bool has_workspace = count >= 4
+                                    && std::is_same_v<std::tuple_element_t<1, Tuple>, void *>
+                                    && std::is_same_v<std::tuple_element_t<2, Tuple>, size_t>;
+
+        Node node;
+        node.op = op;
+        node.workspace_size = 0;
+        node.workspace_offset = 0;
+        Tuple params(args...);
+        node.desc = reinterpret_cast<const InfiniopDescriptor *>(std::get<0>(params));
+        if constexpr (has_workspace) {
+            node.workspace_size = std::get<2>(params);
+        }
+        collectBuffers<has_workspace>(node, params, std::make_index_sequence<count - 1>{});
+
+        node.run = [fn, params](void *workspace, void *stream) {
+            Tuple call = params;
+            if constexpr (has_workspace) {
+                std::get<1>(call) = workspace;
+            }
+            std::get<count - 1>(call) = stream;
+            return std::apply(fn, call);
+        };
+        nodes.push_back(std::move(node));
+        return INFINI_STATUS_SUCCESS;
+    }
+
+    // takes the backend call `fn` of the node being bound
+    infiniStatus_t bind(Call fn) {
+        if (binding->calls++ == 0) {
+            binding->calculate = std::move(fn);
+        }
+        return INFINI_STATUS_SUCCESS;
+    }
+
+    // binds the nodes, groups them into levels and lays out the workspace
+    void finalize();
+
+    infiniStatus_t launch(void *workspace, size_t workspace_size, void *stream) const;
+
+private:
+    template <bool HasWorkspace, typename Tuple, size_t... I>
+    static void collectBuffers(Node &node, const Tuple &params, std::index_sequence<I...>) {
+        // the descriptor, workspace and stream are not buffers
+        auto add = [&node](size_t i, auto value) {
+            using T = decltype(value);
+            if constexpr (std::is_pointer_v<T>) {
+                if (i == 0 || (HasWorkspace && i == 1) || value == nullptr) {
+                    return;
+                }
+                if constexpr (std::is_const_v<std::remove_pointer_t<T>>) {
+                    node.reads.push_back(value);
+                } else {
+                    node.writes.push_back(value);
+                }
+            }
+        };
+        (add(I, std::get<I>(params)), ...);
+    }
+};
+
+namespace op::graph {
+
+// the graph being captured or finalized on the calling thread, if any
+InfiniopGraph *capturing();
+
+// runs the backend call `fn`, or hands it to the node being bound
+template <typename Fn>
+infiniStatus_t call(Fn fn, void *workspace, void *stream) {
+    if (auto graph = capturing()) {
+        return graph->bind(std::move(fn));
+    }
+    return fn(workspace, stream);
+}
+
+} // namespace op::graph
+
+// Placed first in an operator entry point, records the call when a graph is being captured.
+#define INFINIOP_GRAPH_CAPTURE(FN, ...)                                               \
+    do {                                                                              \
+        if (auto graph_ = op::graph::capturing()) {                                   \
+            if (graph_->binding == nullptr) {                                         \
+                return graph_->record(#FN + sizeof("infiniop") - 1, FN, __VA_ARGS__); \
+            }                                                                         \
+            ++graph_->binding->entries;                                               \
+        }                                                                             \
+    } while (0)
+
+// Wraps the backend calculate an operator entry point dispatches to, so that graph launches call
+// it directly. The expression takes `workspace` and `stream` from the launch.
+#define INFINIOP_GRAPH_CALL(...) \
+    op::graph::call([=](void *workspace, void *stream) { return __VA_ARGS__; }, workspace, stream)
+
+// INFINIOP_GRAPH_CALL for the operators without a workspace
+#define INFINIOP_GRAPH_CALL_NO_WORKSPACE(...) \
+    op::graph::call([=](void *, void *stream) { return __VA_ARGS__; }, nullptr, stream)
+
+#endif // __INFINIOP_GRAPH_H__
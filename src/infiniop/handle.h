@@ -3,9 +3,15 @@
 
 #include "infiniop/handle.h"
 
+namespace op::descriptor_cache {
+struct Cache;
+} // namespace op::descriptor_cache
+
 struct InfiniopHandle {
     infiniDevice_t device;
     int device_id;
+    // descriptors shared between creates with the same arguments, null unless enabled
+    op::descriptor_cache::Cache *descriptor_cache = nullptr;
 };
 
 #endif //__INFINIOP_HANDLE_H__
@@ -0,0 +1,111 @@
+#include "memory_planner.h"
+#include "../utils.h"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+size_t InfiniopMemoryPlanner::add(size_t size, size_t first, size_t last) {
+    buffers.push_back({utils::align(size, alignment), first, last, 0});
+    planned = false;
+    return buffers.size() - 1;
+}
+
+size_t InfiniopMemoryPlanner::plan() {
+    std::vector<size_t> order(buffers.size());
+    std::iota(order.begin(), order.end(), 0);
+    // large buffers first, the small ones fill the gaps they leave
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return buffers[a].size > buffers[b].size;
+    });
+
+    arena_size = 0;
+    std::vector<size_t> placed;
+    std::vector<std::pair<size_t, size_t>> taken;
+    for (size_t i : order) {
+        auto &buffer = buffers[i];
+        buffer.offset = 0;
+        if (buffer.size == 0) {
+            continue;
+        }
+
+        // ranges of the arena held by the buffers live at the same time
+        taken.clear();
+        for (size_t j : placed) {
+            const auto &other = buffers[j];
+            if (other.first <= buffer.last && buffer.first <= other.last) {
+                taken.emplace_back(other.offset, other.offset + other.size);
+            }
+        }
+        std::sort(taken.begin(), taken.end());
+
+        size_t best = SIZE_MAX, best_gap = SIZE_MAX, top = 0;
+        for (const auto &[begin, end] : taken) {
+            if (begin >= top + buffer.size && begin - top < best_gap) {
+                best = top;
+                best_gap = begin - top;
+            }
+            top = std::max(top, end);
+        }
+        buffer.offset = best != SIZE_MAX ? best : top;
+        arena_size = std::max(arena_size, buffer.offset + buffer.size);
+        placed.push_back(i);
+    }
+    planned = true;
+    return arena_size;
+}
+
+__C infiniStatus_t infiniopCreateMemoryPlanner(infiniopMemoryPlanner_t *planner_ptr, size_t alignment) {
+    if (planner_ptr == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    *planner_ptr = new InfiniopMemoryPlanner(alignment);
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopMemoryPlannerAddBuffer(
+    infiniopMemoryPlanner_t planner,
+    size_t size,
+    size_t first_step,
+    size_t last_step,
+    size_t *buffer_id) {
+
+    if (planner == nullptr || buffer_id == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (first_step > last_step) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    *buffer_id = planner->add(size, first_step, last_step);
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopMemoryPlannerPlan(infiniopMemoryPlanner_t planner, size_t *arena_size) {
+    if (planner == nullptr || arena_size == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    *arena_size = planner->plan();
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopMemoryPlannerGetOffset(
+    infiniopMemoryPlanner_t planner,
+    size_t buffer_id,
+    size_t *offset) {
+
+    if (planner == nullptr || offset == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (!planner->planned || buffer_id >= planner->buffers.size()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    *offset = planner->offset(buffer_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopDestroyMemoryPlanner(infiniopMemoryPlanner_t planner) {
+    delete planner;
+    return INFINI_STATUS_SUCCESS;
+}
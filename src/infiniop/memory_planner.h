@@ -0,0 +1,35 @@
+#ifndef __INFINIOP_MEMORY_PLANNER_H__
+#define __INFINIOP_MEMORY_PLANNER_H__
+
+#include "infiniop/memory_planner.h"
+#include <vector>
+
+struct InfiniopMemoryPlanner {
+    struct Buffer {
+        size_t size;
+        // live from step `first` to step `last`, both included
+        size_t first, last;
+        size_t offset;
+    };
+
+    size_t alignment;
+    std::vector<Buffer> buffers;
+    bool planned = false;
+    size_t arena_size = 0;
+
+    explicit InfiniopMemoryPlanner(size_t alignment_) : alignment(alignment_) {}
+
+    // returns the id of the buffer, its offset is known once planned
+    size_t add(size_t size, size_t first, size_t last);
+
+    /**
+     * Places the buffers from the largest to the smallest. Each one goes into the smallest gap
+     * left between the buffers already placed that are live at the same time, or above all of
+     * them when no gap is large enough. Returns the size of the arena.
+     */
+    size_t plan();
+
+    size_t offset(size_t id) const { return buffers[id].offset; }
+};
+
+#endif // __INFINIOP_MEMORY_PLANNER_H__
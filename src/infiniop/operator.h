@@ -3,9 +3,17 @@
 
 #include "infiniop/operator_descriptor.h"
 
+namespace op::trace {
+struct Signature;
+} // namespace op::trace
+
 struct InfiniopDescriptor {
     infiniDevice_t device_type;
     int device_id;
+    // the tensors the descriptor was created for, known when created while tracing
+    const op::trace::Signature *trace_signature = nullptr;
+    // bytes of those tensors, known for every descriptor
+    size_t trace_bytes = 0;
 };
 
 #endif
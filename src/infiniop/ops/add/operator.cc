@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/add.h"
 
 #ifdef ENABLE_CPU_API
@@ -24,6 +27,7 @@ __C infiniStatus_t infiniopCreateAddDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateAddDescriptor, infiniopDestroyAddDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -104,11 +108,13 @@ __C infiniStatus_t infiniopAdd(
     const void *a,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopAdd, desc, workspace, workspace_size, c, a, b, stream);
+    INFINIOP_TRACE(infiniopAdd, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                            \
-    case CASE:                                                                \
-        return reinterpret_cast<const op::add::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, c, {a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                \
+    case CASE:                                                                                    \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::add::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, c, {a, b}, stream))
 
     switch (desc->device_type) {
 
@@ -140,6 +146,7 @@ __C infiniStatus_t infiniopAdd(
 
 __C infiniStatus_t
 infiniopDestroyAddDescriptor(infiniopAddDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                \
     case CASE:                                                                 \
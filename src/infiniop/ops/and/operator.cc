@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/and.h"
 
 #ifdef ENABLE_CPU_API
@@ -20,6 +23,7 @@ __C infiniStatus_t infiniopCreateAndDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateAndDescriptor, infiniopDestroyAndDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -94,11 +98,13 @@ __C infiniStatus_t infiniopAnd(
     const void *a,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopAnd, desc, workspace, workspace_size, c, a, b, stream);
+    INFINIOP_TRACE(infiniopAnd, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                          \
-    case CASE:                                                              \
-        return reinterpret_cast<op::and_op::NAMESPACE::Descriptor *>(desc)  \
-            ->calculate(workspace, workspace_size, {c}, {a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                             \
+    case CASE:                                                                                 \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::and_op::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, {c}, {a, b}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -127,6 +133,8 @@ __C infiniStatus_t infiniopAnd(
 
 __C infiniStatus_t
 infiniopDestroyAndDescriptor(infiniopAndDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DESTROY(CASE, NAMESPACE)                                            \
     case CASE:                                                              \
         delete reinterpret_cast<op::and_op::NAMESPACE::Descriptor *>(desc); \
@@ -2,6 +2,10 @@
 #include "../../../utils.h"
 #include "../../../utils/check.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
+#include "../../memory_planner.h"
 #include "../../tensor.h"
 #include "infiniop/ops/attention.h"
 #include "infiniop/ops/causal_softmax.h"
@@ -21,8 +25,12 @@ struct InfiniopAttentionDescriptor {
     infiniopGemmDescriptor_t matmul_desc2;
     infiniopCausalSoftmaxDescriptor_t softmax_desc;
     size_t workspace_size;
-    size_t op_workspace_offset;
-    size_t op_workspace_size;
+    size_t matmul1_workspace_offset;
+    size_t matmul1_workspace_size;
+    size_t softmax_workspace_offset;
+    size_t softmax_workspace_size;
+    size_t matmul2_workspace_offset;
+    size_t matmul2_workspace_size;
     size_t q_cont_offset;
     size_t att_score_offset;
     size_t att_val_offset;
@@ -40,6 +48,8 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
                                                               infiniopTensorDescriptor_t k_cache_desc,
                                                               infiniopTensorDescriptor_t v_cache_desc,
                                                               size_t pos) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateAttentionDescriptor, infiniopDestroyAttentionDescriptor, handle, desc_ptr, out_desc, q_desc, k_desc, v_desc, k_cache_desc, v_cache_desc, pos);
+
     if (out_desc->ndim() != 3 || q_desc->ndim() != 3 || k_desc->ndim() != 3 || v_desc->ndim() != 3 || k_cache_desc->ndim() != 3 || v_cache_desc->ndim() != 3) {
         return INFINI_STATUS_BAD_TENSOR_SHAPE;
     }
@@ -103,7 +113,7 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
     // Rearrange q into contiguous
     if (!q_desc->isContiguous(0, 1)) {
         CHECK_STATUS(infiniopCreateTensorDescriptor(&rearranged_q_desc, 3, q_desc->shape().data(), nullptr, q_desc->dtype()));
-        q_cont_size = utils::align(rearranged_q_desc->numel() * infiniSizeOf(rearranged_q_desc->dtype()), alignment);
+        q_cont_size = rearranged_q_desc->numel() * infiniSizeOf(rearranged_q_desc->dtype());
         rearrange_desc_q = new InfiniopDescriptor;
         CHECK_STATUS(infiniopCreateRearrangeDescriptor(handle, &rearrange_desc_q, rearranged_q_desc, q_desc));
     }
@@ -131,9 +141,8 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
     //      matmul1 workspace size
     size_t matmul1_workspace_size;
     CHECK_STATUS(infiniopGetGemmWorkspaceSize(matmul1_desc, &matmul1_workspace_size));
-    matmul1_workspace_size = utils::align(matmul1_workspace_size, alignment);
     //      attention score tensor size
-    size_t attn_score_size = utils::align(qk_desc->numel() * infiniSizeOf(qk_desc->dtype()), alignment);
+    size_t attn_score_size = qk_desc->numel() * infiniSizeOf(qk_desc->dtype());
 
     // CausalSoftmax: softmax(qk)
     //      qk: [n_kv_head, n_group * seq_len, total_seq_len] -> [n_q_head, seq_len, total_seq_len]
@@ -144,7 +153,6 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
     //      softmax workspace size
     size_t softmax_workspace_size;
     CHECK_STATUS(infiniopGetCausalSoftmaxWorkspaceSize(softmax_desc, &softmax_workspace_size));
-    softmax_workspace_size = utils::align(softmax_workspace_size, alignment);
 
     // Matmul2: softmax(qk) * full_v
     //      softmax(qk): [n_q_head, seq_len, total_seq_len] -> [n_kv_head, n_group * seq_len, total_seq_len]
@@ -164,9 +172,8 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
     //      matmul2 workspace size
     size_t matmul2_workspace_size;
     CHECK_STATUS(infiniopGetGemmWorkspaceSize(matmul2_desc, &matmul2_workspace_size));
-    matmul2_workspace_size = utils::align(matmul2_workspace_size, alignment);
     //      attention value tensor size
-    size_t att_val_size = utils::align(att_val_desc->numel() * infiniSizeOf(att_val_desc->dtype()), alignment);
+    size_t att_val_size = att_val_desc->numel() * infiniSizeOf(att_val_desc->dtype());
 
     // Rearrange temp_out into out
     //      out: [seq_len, n_q_head, head_dim]
@@ -177,10 +184,15 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
     infiniopRearrangeDescriptor_t rearrange_desc_out;
     CHECK_STATUS(infiniopCreateRearrangeDescriptor(handle, &rearrange_desc_out, out_desc, att_val_desc));
 
-    // workspace size
-    size_t op_workspace_size = utils::align(std::max(std::max(matmul1_workspace_size, matmul2_workspace_size), softmax_workspace_size), alignment);
-    size_t temp_tensors_size = attn_score_size + std::max(q_cont_size, att_val_size);
-    size_t workspace_size = temp_tensors_size + op_workspace_size;
+    // workspace layout, steps: 0 rearrange q, 1 matmul1, 2 softmax, 3 matmul2, 4 rearrange out
+    InfiniopMemoryPlanner planner(alignment);
+    size_t q_cont_id = planner.add(q_cont_size, 0, 1);
+    size_t att_score_id = planner.add(attn_score_size, 1, 3);
+    size_t att_val_id = planner.add(att_val_size, 3, 4);
+    size_t matmul1_workspace_id = planner.add(matmul1_workspace_size, 1, 1);
+    size_t softmax_workspace_id = planner.add(softmax_workspace_size, 2, 2);
+    size_t matmul2_workspace_id = planner.add(matmul2_workspace_size, 3, 3);
+    size_t workspace_size = planner.plan();
 
     // k_cache_offset
     size_t k_cache_offset = 0;
@@ -205,11 +217,15 @@ __C __export infiniStatus_t infiniopCreateAttentionDescriptor(infiniopHandle_t h
         matmul2_desc,
         softmax_desc,
         workspace_size,
-        temp_tensors_size,
-        op_workspace_size,
-        attn_score_size,
-        0,
-        attn_score_size,
+        planner.offset(matmul1_workspace_id),
+        matmul1_workspace_size,
+        planner.offset(softmax_workspace_id),
+        softmax_workspace_size,
+        planner.offset(matmul2_workspace_id),
+        matmul2_workspace_size,
+        planner.offset(q_cont_id),
+        planner.offset(att_score_id),
+        planner.offset(att_val_id),
         k_cache_offset,
         v_cache_offset,
         1.f / std::sqrt(float(head_dim)),
@@ -233,12 +249,13 @@ __C __export infiniStatus_t infiniopAttention(infiniopAttentionDescriptor_t desc
                                               void *k_cache,
                                               void *v_cache,
                                               void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopAttention, desc_, workspace_, workspace_size_, out, q, k, v, k_cache, v_cache, stream);
+    INFINIOP_TRACE(infiniopAttention, desc_, workspace_size_);
+
     auto desc = (InfiniopAttentionDescriptor *)desc_;
     if (workspace_size_ < desc->workspace_size) {
         return INFINI_STATUS_INSUFFICIENT_WORKSPACE; // STATUS_MEMORY_NOT_ALLOCATED
     }
-    void *workspace = (char *)workspace_ + desc->op_workspace_offset;
-    size_t workspace_size = desc->op_workspace_size;
     void *att_score = (char *)workspace_ + desc->att_score_offset;
     void *att_val = (char *)workspace_ + desc->att_val_offset;
     void const *q_ = q;
@@ -258,15 +275,15 @@ __C __export infiniStatus_t infiniopAttention(infiniopAttentionDescriptor_t desc
 
     // matmul1: q * full_k
     CHECK_STATUS(infiniopGemm(desc->matmul_desc1,
-                              workspace, workspace_size,
+                              (char *)workspace_ + desc->matmul1_workspace_offset, desc->matmul1_workspace_size,
                               att_score, q_, k_cache, desc->qk_alpha, 0.0, stream));
     // softmax(qk)
     CHECK_STATUS(infiniopCausalSoftmax(desc->softmax_desc,
-                                       workspace, workspace_size,
+                                       (char *)workspace_ + desc->softmax_workspace_offset, desc->softmax_workspace_size,
                                        att_score, att_score, stream));
     // matmul2: softmax(qk) * full_v
     CHECK_STATUS(infiniopGemm(desc->matmul_desc2,
-                              workspace, workspace_size,
+                              (char *)workspace_ + desc->matmul2_workspace_offset, desc->matmul2_workspace_size,
                               att_val, att_score, v_cache, 1.0, 0.0, stream));
     // rearrange out
     CHECK_STATUS(infiniopRearrange(desc->rearrange_desc_out, out, att_val, stream));
@@ -275,6 +292,8 @@ __C __export infiniStatus_t infiniopAttention(infiniopAttentionDescriptor_t desc
 }
 
 __C __export infiniStatus_t infiniopDestroyAttentionDescriptor(infiniopAttentionDescriptor_t desc_) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc_);
+
     auto desc = (InfiniopAttentionDescriptor *)desc_;
     if (desc->rearrange_desc_q) {
         CHECK_STATUS(infiniopDestroyRearrangeDescriptor(desc->rearrange_desc_q));
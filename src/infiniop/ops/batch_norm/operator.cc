@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/batch_norm.h"
 
 #ifdef ENABLE_CPU_API
@@ -32,6 +35,8 @@ __C infiniStatus_t infiniopCreateBatchNormDescriptor(
     infiniopTensorDescriptor_t running_var_desc,
     float momentum,
     float eps) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateBatchNormDescriptor, infiniopDestroyBatchNormDescriptor, handle, desc_ptr, output_desc, input_desc, weight_desc, bias_desc, running_mean_desc, running_var_desc, momentum, eps);
+
     
     if (!handle || !desc_ptr || !output_desc || !input_desc || 
         !weight_desc || !bias_desc || !running_mean_desc || !running_var_desc) {
@@ -122,14 +127,17 @@ __C infiniStatus_t infiniopBatchNorm(infiniopBatchNormDescriptor_t desc,
                                      void *running_mean,
                                      void *running_var,
                                      void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopBatchNorm, desc, workspace, workspace_size, output, input, weight, bias, running_mean, running_var, stream);
+    INFINIOP_TRACE(infiniopBatchNorm, desc, workspace_size);
+
     if (!desc || !output || !input || !weight || !bias || !running_mean || !running_var) {
         return INFINI_STATUS_BAD_PARAM;
     }
 
-#define CALCULATE(CASE, NAMESPACE) \
-    case CASE: \
-        return reinterpret_cast<op::batch_norm::NAMESPACE::Descriptor*>(desc)->calculate( \
-            workspace, workspace_size, output, input, weight, bias, running_mean, running_var, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                            \
+    case CASE:                                                                                                \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::batch_norm::NAMESPACE::Descriptor*>(desc)->calculate( \
+            workspace, workspace_size, output, input, weight, bias, running_mean, running_var, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -161,6 +169,8 @@ __C infiniStatus_t infiniopBatchNorm(infiniopBatchNormDescriptor_t desc,
 }
 
 __C infiniStatus_t infiniopDestroyBatchNormDescriptor(infiniopBatchNormDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
     if (!desc) {
         return INFINI_STATUS_BAD_PARAM;
     }
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/batch_norm_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -33,6 +36,8 @@ __C infiniStatus_t infiniopCreateBatchNormBackwardDescriptor(
     infiniopTensorDescriptor_t running_mean_desc,
     infiniopTensorDescriptor_t running_var_desc,
     float eps) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateBatchNormBackwardDescriptor, infiniopDestroyBatchNormBackwardDescriptor, handle, desc_ptr, input_grad_desc, weight_grad_desc, bias_grad_desc, output_grad_desc, input_desc, weight_desc, running_mean_desc, running_var_desc, eps);
+
     
     if (!handle || !desc_ptr || !input_grad_desc || !output_grad_desc || !input_desc || 
         !weight_desc || !running_mean_desc || !running_var_desc) {
@@ -159,6 +164,9 @@ __C infiniStatus_t infiniopBatchNormBackward(
     const void *running_mean,
     const void *running_var,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopBatchNormBackward, desc, workspace, workspace_size, input_grad, weight_grad, bias_grad, output_grad, input, weight, running_mean, running_var, stream);
+    INFINIOP_TRACE(infiniopBatchNormBackward, desc, workspace_size);
+
     
     if (!desc || !input_grad || !output_grad || !input || !weight || 
         !running_mean || !running_var) {
@@ -167,11 +175,11 @@ __C infiniStatus_t infiniopBatchNormBackward(
     
     auto descriptor = reinterpret_cast<InfiniopDescriptor*>(desc);
     
-#define CALCULATE(CASE, NAMESPACE) \
-    case CASE: \
-        return reinterpret_cast<op::batch_norm_backward::NAMESPACE::Descriptor*>(desc)->calculate( \
-            workspace, workspace_size, input_grad, weight_grad, bias_grad, \
-            output_grad, input, weight, running_mean, running_var, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                     \
+    case CASE:                                                                                                         \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::batch_norm_backward::NAMESPACE::Descriptor*>(desc)->calculate( \
+            workspace, workspace_size, input_grad, weight_grad, bias_grad,                                             \
+            output_grad, input, weight, running_mean, running_var, stream))
 
     switch (descriptor->device_type) {
 #ifdef ENABLE_CPU_API
@@ -204,6 +212,8 @@ __C infiniStatus_t infiniopBatchNormBackward(
 
 __C infiniStatus_t infiniopDestroyBatchNormBackwardDescriptor(
     infiniopBatchNormBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
     
     if (!desc) {
         return INFINI_STATUS_BAD_PARAM;
@@ -1,93 +1,259 @@
 #include "cast_cpu.h"
-#include "../../../devices/cpu/cpu_handle.h"
-#include "../../../../utils/custom_types.h"
+#include "../../../devices/cpu/autotune.h"
+#include <array>
+#include <cmath>
+#include <limits>
 
 namespace op::cast::cpu {
 
-struct Descriptor::Opaque {
-    size_t numel;
+/**
+ * Conversions are inlined and written without data-dependent branches, so the
+ * contiguous loop below vectorizes for every dtype pair. Half and bfloat16 values
+ * are handled as their bit patterns and go through f32; they give the same bits
+ * as `utils::cast`.
+ */
+
+template <typename T>
+constexpr bool is_half_v = std::is_same_v<T, fp16_t> || std::is_same_v<T, bf16_t>;
+
+// representation a value is converted in, the vectorizer cannot load or store the half structs
+template <typename T>
+using bits_t = std::conditional_t<is_half_v<T>, uint16_t, T>;
+
+// all ones when `cond` holds, the selects below are written with masks so they if-convert
+inline uint32_t mask(bool cond) {
+    return 0u - uint32_t(cond);
+}
+
+inline uint32_t select(uint32_t m, uint32_t a, uint32_t b) {
+    return (a & m) | (b & ~m);
+}
+
+inline float halfToFloat(uint16_t h) {
+    uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1F;
+    uint32_t mantissa = h & 0x3FF;
+    // subnormals are exactly mantissa * 2^-24
+    float subnormal = float(mantissa) * 5.9604644775390625e-8f;
+    uint32_t subnormal_bits;
+    std::memcpy(&subnormal_bits, &subnormal, sizeof(subnormal_bits));
+    uint32_t bits = select(mask(exponent == 31), 0x7F800000 | (mantissa << 13),
+                           select(mask(exponent == 0), subnormal_bits,
+                                  ((exponent + 112) << 23) | (mantissa << 13)));
+    bits |= sign;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// truncating, like `_f32_to_f16`
+inline uint16_t floatToHalf(float val) {
+    uint32_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    int32_t exponent = int32_t((bits >> 23) & 0xFF) - 127;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    uint32_t special = select(mask(exponent == 128) & mask(mantissa != 0), 0x7E00, 0x7C00);
+    uint32_t normal = (uint32_t(exponent + 15) << 10) | (mantissa >> 13);
+    // |val| * 2^24 truncated is the subnormal mantissa, clamped so the conversion is defined
+    uint32_t subnormal = uint32_t(std::min(1024.0f, std::fabs(val) * 16777216.0f));
+    uint32_t half = select(mask(exponent >= 16), special,
+                           select(mask(exponent >= -14), normal,
+                                  select(mask(exponent >= -24), subnormal, 0)));
+    return uint16_t(sign | half);
+}
+
+inline float bfloatToFloat(uint16_t b) {
+    uint32_t bits = uint32_t(b) << 16;
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// round to nearest even, like `_f32_to_bf16`
+inline uint16_t floatToBfloat(float val) {
+    uint32_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    uint32_t rounding_bias = 0x7FFF + ((bits >> 16) & 1);
+    return uint16_t((bits + rounding_bias) >> 16);
+}
+
+template <typename Tout, typename Tin>
+inline bits_t<Tout> convert(bits_t<Tin> val) {
+    if constexpr (std::is_same_v<Tout, Tin>) {
+        return val;
+    } else if constexpr (std::is_same_v<Tin, fp16_t>) {
+        return convert<Tout, float>(halfToFloat(val));
+    } else if constexpr (std::is_same_v<Tin, bf16_t>) {
+        return convert<Tout, float>(bfloatToFloat(val));
+    } else if constexpr (std::is_same_v<Tout, fp16_t>) {
+        return floatToHalf(float(val));
+    } else if constexpr (std::is_same_v<Tout, bf16_t>) {
+        return floatToBfloat(float(val));
+    } else if constexpr (std::is_integral_v<Tout> && std::is_floating_point_v<Tin>) {
+        // saturate instead of the undefined out-of-range conversion, NaN becomes 0
+        constexpr Tin lo = Tin(std::numeric_limits<Tout>::min());
+        constexpr Tin hi = Tin(std::numeric_limits<Tout>::max());
+        return val != val  ? Tout(0)
+             : val <= lo ? std::numeric_limits<Tout>::min()
+             : val >= hi ? std::numeric_limits<Tout>::max()
+                         : Tout(val);
+    } else {
+        // integer narrowing wraps around, as in PyTorch
+        return static_cast<Tout>(val);
+    }
+}
+
+struct CastOp {
+    static constexpr size_t num_inputs = 1;
+    template <typename Tout, typename Tin>
+    Tout operator()(const Tin &val) const {
+        if constexpr (is_half_v<Tin> && is_half_v<Tout>) {
+            return Tout{convert<Tout, Tin>(val._v)};
+        } else if constexpr (is_half_v<Tin>) {
+            return convert<Tout, Tin>(val._v);
+        } else if constexpr (is_half_v<Tout>) {
+            return Tout{convert<Tout, Tin>(val)};
+        } else {
+            return convert<Tout, Tin>(val);
+        }
+    }
 };
 
-Descriptor::Descriptor(infiniDtype_t input_dtype, infiniDtype_t output_dtype)
-    : InfiniopDescriptor{INFINI_DEVICE_CPU, 0}, _input_dtype(input_dtype), _output_dtype(output_dtype) {
-    _opaque = new Opaque();
+// elements converted by one thread between scheduling decisions, tried by the autotuner; the
+// first one is the default
+constexpr ptrdiff_t CAST_CHUNKS[] = {16384, 4096, 65536, 262144};
+
+// tensors larger than this are not timed and keep the default chunk
+constexpr size_t TUNING_MAX_SIZE = size_t(1) << 24;
+
+template <typename Tout, typename Tin>
+void castTensor(const op::elementwise::ElementwiseInfo &info, void *output, const void *input, ptrdiff_t chunk) {
+    if (!info.isOutputContiguous() || !info.getInputContiguous()[0]) {
+        op::elementwise::cpu::calculate_impl<CastOp, Tout, Tin>(
+            info, output, {input}, std::index_sequence<0>{});
+        return;
+    }
+
+    bits_t<Tout> *out = reinterpret_cast<bits_t<Tout> *>(output);
+    const bits_t<Tin> *in = reinterpret_cast<const bits_t<Tin> *>(input);
+    const ptrdiff_t size = ptrdiff_t(info.getOutputSize());
+
+#pragma omp parallel for schedule(static) if (size > chunk)
+    for (ptrdiff_t begin = 0; begin < size; begin += chunk) {
+        const ptrdiff_t end = std::min(size, begin + chunk);
+#pragma omp simd
+        for (ptrdiff_t i = begin; i < end; ++i) {
+            out[i] = convert<Tout, Tin>(in[i]);
+        }
+    }
+}
+
+// dtypes Cast converts between, in the order of the rows and columns of the dispatch table
+template <typename... T>
+struct TypeList {};
+
+using CastTypes = TypeList<uint8_t, int8_t, int16_t, int32_t, int64_t, uint16_t, uint32_t, uint64_t,
+                           fp16_t, bf16_t, float, double>;
+
+constexpr infiniDtype_t CAST_DTYPES[] = {
+    INFINI_DTYPE_U8, INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
+    INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
+    INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32, INFINI_DTYPE_F64};
+
+template <typename Tin, typename... Tout>
+constexpr std::array<CastFn, sizeof...(Tout)> castRow(TypeList<Tout...>) {
+    return {&castTensor<Tout, Tin>...};
+}
+
+template <typename... Tin>
+constexpr std::array<std::array<CastFn, sizeof...(Tin)>, sizeof...(Tin)> castTable(TypeList<Tin...> types) {
+    return {castRow<Tin>(types)...};
+}
+
+// CAST_TABLE[input][output]
+constexpr auto CAST_TABLE = castTable(CastTypes{});
+
+static_assert(CAST_TABLE.size() == sizeof(CAST_DTYPES) / sizeof(CAST_DTYPES[0]),
+              "CastTypes and CAST_DTYPES must list the same dtypes");
+
+inline int castIndex(infiniDtype_t dtype) {
+    for (size_t i = 0; i < CAST_TABLE.size(); ++i) {
+        if (CAST_DTYPES[i] == dtype) {
+            return int(i);
+        }
+    }
+    return -1;
 }
 
-Descriptor::~Descriptor() {
-    if (_opaque) {
-        delete _opaque;
+/**
+ * Picks the chunk among `CAST_CHUNKS` for contiguous tensors, timing `cast` on zeroed buffers of
+ * the size of the tensors when tuning is enabled. Tensors within the smallest chunk are converted
+ * by one thread whatever the chunk, and are not timed.
+ */
+static ptrdiff_t selectChunk(const op::elementwise::ElementwiseInfo &info, CastFn cast,
+                             infiniDtype_t input_dtype, infiniDtype_t output_dtype) {
+    const size_t size = info.getOutputSize();
+    if (!info.isOutputContiguous() || !info.getInputContiguous()[0]
+        || size <= size_t(*std::min_element(std::begin(CAST_CHUNKS), std::end(CAST_CHUNKS)))
+        || size > TUNING_MAX_SIZE) {
+        return CAST_CHUNKS[0];
     }
+    std::vector<std::string> names;
+    for (ptrdiff_t chunk : CAST_CHUNKS) {
+        names.push_back(std::to_string(chunk));
+    }
+    auto bucket = common_cpu::autotune::bucket(
+        infiniDtypeToString(input_dtype) + '_' + infiniDtypeToString(output_dtype), {size});
+
+    // allocated once tuning actually runs
+    std::vector<char> input, output;
+    size_t index = common_cpu::autotune::select("cast", bucket, names, 0, [&](size_t i) {
+        if (output.empty()) {
+            input.assign(size * infiniSizeOf(input_dtype), 0);
+            output.assign(size * infiniSizeOf(output_dtype), 0);
+        }
+        cast(info, output.data(), input.data(), CAST_CHUNKS[i]);
+    });
+    return CAST_CHUNKS[index];
 }
 
+Descriptor::~Descriptor() = default;
+
 infiniStatus_t Descriptor::create(
     infiniopHandle_t handle_,
     Descriptor **desc_ptr,
     infiniopTensorDescriptor_t output_desc,
     std::vector<infiniopTensorDescriptor_t> input_desc_vec) {
 
-    // auto handle = reinterpret_cast<device::cpu::Handle *>(handle_); // 暂时注释掉未使用的变量
-    auto input_dtype = input_desc_vec[0]->dtype();
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+    auto input_dtype = input_desc_vec.at(0)->dtype();
     auto output_dtype = output_desc->dtype();
 
-    // 检查支持的类型转换
-    bool valid_cast = false;
-    
-    // 整数类型之间的转换（包括uint8）
-    if ((input_dtype == INFINI_DTYPE_I32 || input_dtype == INFINI_DTYPE_I64 || 
-         input_dtype == INFINI_DTYPE_U32 || input_dtype == INFINI_DTYPE_U64 || input_dtype == INFINI_DTYPE_U8) &&
-        (output_dtype == INFINI_DTYPE_I32 || output_dtype == INFINI_DTYPE_I64 || 
-         output_dtype == INFINI_DTYPE_U32 || output_dtype == INFINI_DTYPE_U64 || output_dtype == INFINI_DTYPE_U8)) {
-        valid_cast = true;
-    }
-    
-    // 浮点类型之间的转换
-    if ((input_dtype == INFINI_DTYPE_F64 || input_dtype == INFINI_DTYPE_F32 || input_dtype == INFINI_DTYPE_F16) &&
-        (output_dtype == INFINI_DTYPE_F64 || output_dtype == INFINI_DTYPE_F32 || output_dtype == INFINI_DTYPE_F16)) {
-        valid_cast = true;
-    }
-    
-    // 整数类型转浮点类型（包括uint8）
-    if ((input_dtype == INFINI_DTYPE_I32 || input_dtype == INFINI_DTYPE_I64 || 
-         input_dtype == INFINI_DTYPE_U32 || input_dtype == INFINI_DTYPE_U64 || input_dtype == INFINI_DTYPE_U8) &&
-        (output_dtype == INFINI_DTYPE_F64 || output_dtype == INFINI_DTYPE_F32 || output_dtype == INFINI_DTYPE_F16)) {
-        valid_cast = true;
-    }
-    
-    // 浮点类型转整数类型（包括uint8）
-    if ((input_dtype == INFINI_DTYPE_F64 || input_dtype == INFINI_DTYPE_F32 || input_dtype == INFINI_DTYPE_F16) &&
-        (output_dtype == INFINI_DTYPE_I32 || output_dtype == INFINI_DTYPE_I64 || 
-         output_dtype == INFINI_DTYPE_U32 || output_dtype == INFINI_DTYPE_U64 || output_dtype == INFINI_DTYPE_U8)) {
-        valid_cast = true;
-    }
-    
-    if (!valid_cast) {
+    int in_index = castIndex(input_dtype), out_index = castIndex(output_dtype);
+    if (in_index < 0 || out_index < 0) {
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
 
-    // 检查形状一致性
-    const auto &input_shape = input_desc_vec[0]->shape();
-    const auto &output_shape = output_desc->shape();
-    if (input_shape != output_shape) {
-        return INFINI_STATUS_BAD_TENSOR_SHAPE;
-    }
+    CHECK_SAME_SHAPE(output_desc->shape(), input_desc_vec.at(0)->shape());
 
-    auto desc = new Descriptor(input_dtype, output_dtype);
-    desc->_opaque->numel = output_desc->numel();
-    
-    *desc_ptr = desc;
-    return INFINI_STATUS_SUCCESS;
-}
+    auto info_result = op::elementwise::ElementwiseInfo::create(output_desc, input_desc_vec);
+    CHECK_RESULT(info_result);
 
-size_t Descriptor::workspaceSize() const {
-    return 0;
-}
+    auto info = info_result.take();
+    CastFn cast = CAST_TABLE[in_index][out_index];
+    ptrdiff_t chunk = selectChunk(info, cast, input_dtype, output_dtype);
 
-// 类型转换辅助函数模板
-template<typename InputType, typename OutputType>
-void cast_elements(const InputType* input, OutputType* output, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        output[i] = utils::cast<OutputType>(input[i]);
-    }
+    *desc_ptr = new Descriptor(
+        input_dtype,
+        output_dtype,
+        std::move(info),
+        cast,
+        chunk,
+        handle->device,
+        handle->device_id);
+    return INFINI_STATUS_SUCCESS;
 }
 
 infiniStatus_t Descriptor::calculate(
@@ -97,129 +263,8 @@ infiniStatus_t Descriptor::calculate(
     std::vector<const void *> inputs,
     void *stream) const {
 
-    const void *input = inputs[0];
-    size_t numel = _opaque->numel;
-
-    // 根据输入和输出数据类型进行转换
-    if (_input_dtype == INFINI_DTYPE_I32 && _output_dtype == INFINI_DTYPE_I64) {
-        cast_elements<int32_t, int64_t>(static_cast<const int32_t*>(input), static_cast<int64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I64 && _output_dtype == INFINI_DTYPE_I32) {
-        cast_elements<int64_t, int32_t>(static_cast<const int64_t*>(input), static_cast<int32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<float, double>(static_cast<const float*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<double, float>(static_cast<const double*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<fp16_t, float>(static_cast<const fp16_t*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<float, fp16_t>(static_cast<const float*>(input), static_cast<fp16_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<fp16_t, double>(static_cast<const fp16_t*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<double, fp16_t>(static_cast<const double*>(input), static_cast<fp16_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I32 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<int32_t, float>(static_cast<const int32_t*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I32 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<int32_t, double>(static_cast<const int32_t*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I32 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<int32_t, fp16_t>(static_cast<const int32_t*>(input), static_cast<fp16_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I64 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<int64_t, float>(static_cast<const int64_t*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I64 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<int64_t, double>(static_cast<const int64_t*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I64 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<int64_t, fp16_t>(static_cast<const int64_t*>(input), static_cast<fp16_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_I32) {
-        cast_elements<float, int32_t>(static_cast<const float*>(input), static_cast<int32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_I64) {
-        cast_elements<float, int64_t>(static_cast<const float*>(input), static_cast<int64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_I32) {
-        cast_elements<double, int32_t>(static_cast<const double*>(input), static_cast<int32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_I64) {
-        cast_elements<double, int64_t>(static_cast<const double*>(input), static_cast<int64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_I32) {
-        cast_elements<fp16_t, int32_t>(static_cast<const fp16_t*>(input), static_cast<int32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_I64) {
-        cast_elements<fp16_t, int64_t>(static_cast<const fp16_t*>(input), static_cast<int64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U32 && _output_dtype == INFINI_DTYPE_U64) {
-        cast_elements<uint32_t, uint64_t>(static_cast<const uint32_t*>(input), static_cast<uint64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U64 && _output_dtype == INFINI_DTYPE_U32) {
-        cast_elements<uint64_t, uint32_t>(static_cast<const uint64_t*>(input), static_cast<uint32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I32 && _output_dtype == INFINI_DTYPE_U32) {
-        cast_elements<int32_t, uint32_t>(static_cast<const int32_t*>(input), static_cast<uint32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U32 && _output_dtype == INFINI_DTYPE_I32) {
-        cast_elements<uint32_t, int32_t>(static_cast<const uint32_t*>(input), static_cast<int32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I64 && _output_dtype == INFINI_DTYPE_U64) {
-        cast_elements<int64_t, uint64_t>(static_cast<const int64_t*>(input), static_cast<uint64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U64 && _output_dtype == INFINI_DTYPE_I64) {
-        cast_elements<uint64_t, int64_t>(static_cast<const uint64_t*>(input), static_cast<int64_t*>(output), numel);
-    }
-    // 无符号整数到浮点类型的转换
-    else if (_input_dtype == INFINI_DTYPE_U32 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<uint32_t, float>(static_cast<const uint32_t*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U32 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<uint32_t, double>(static_cast<const uint32_t*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U32 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<uint32_t, fp16_t>(static_cast<const uint32_t*>(input), static_cast<fp16_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U64 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<uint64_t, float>(static_cast<const uint64_t*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U64 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<uint64_t, double>(static_cast<const uint64_t*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U64 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<uint64_t, fp16_t>(static_cast<const uint64_t*>(input), static_cast<fp16_t*>(output), numel);
-    }
-    // 浮点类型到无符号整数类型的转换
-    else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_U32) {
-        cast_elements<float, uint32_t>(static_cast<const float*>(input), static_cast<uint32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_U64) {
-        cast_elements<float, uint64_t>(static_cast<const float*>(input), static_cast<uint64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_U32) {
-        cast_elements<double, uint32_t>(static_cast<const double*>(input), static_cast<uint32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_U64) {
-        cast_elements<double, uint64_t>(static_cast<const double*>(input), static_cast<uint64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_U32) {
-        cast_elements<fp16_t, uint32_t>(static_cast<const fp16_t*>(input), static_cast<uint32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_U64) {
-        cast_elements<fp16_t, uint64_t>(static_cast<const fp16_t*>(input), static_cast<uint64_t*>(output), numel);
-    }
-    // uint8类型的转换支持
-    else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_U32) {
-        cast_elements<uint8_t, uint32_t>(static_cast<const uint8_t*>(input), static_cast<uint32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_U64) {
-        cast_elements<uint8_t, uint64_t>(static_cast<const uint8_t*>(input), static_cast<uint64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_I32) {
-        cast_elements<uint8_t, int32_t>(static_cast<const uint8_t*>(input), static_cast<int32_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_I64) {
-        cast_elements<uint8_t, int64_t>(static_cast<const uint8_t*>(input), static_cast<int64_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_F32) {
-        cast_elements<uint8_t, float>(static_cast<const uint8_t*>(input), static_cast<float*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_F64) {
-        cast_elements<uint8_t, double>(static_cast<const uint8_t*>(input), static_cast<double*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U8 && _output_dtype == INFINI_DTYPE_F16) {
-        cast_elements<uint8_t, fp16_t>(static_cast<const uint8_t*>(input), static_cast<fp16_t*>(output), numel);
-    }
-    // 其他类型到uint8的转换
-    else if (_input_dtype == INFINI_DTYPE_U32 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<uint32_t, uint8_t>(static_cast<const uint32_t*>(input), static_cast<uint8_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_U64 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<uint64_t, uint8_t>(static_cast<const uint64_t*>(input), static_cast<uint8_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I32 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<int32_t, uint8_t>(static_cast<const int32_t*>(input), static_cast<uint8_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_I64 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<int64_t, uint8_t>(static_cast<const int64_t*>(input), static_cast<uint8_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F32 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<float, uint8_t>(static_cast<const float*>(input), static_cast<uint8_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F64 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<double, uint8_t>(static_cast<const double*>(input), static_cast<uint8_t*>(output), numel);
-    } else if (_input_dtype == INFINI_DTYPE_F16 && _output_dtype == INFINI_DTYPE_U8) {
-        cast_elements<fp16_t, uint8_t>(static_cast<const fp16_t*>(input), static_cast<uint8_t*>(output), numel);
-    } else {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
-    }
-
+    _cast(_info, output, inputs[0], _chunk);
     return INFINI_STATUS_SUCCESS;
 }
 
-
-
-} // namespace op::cast::cpu
\ No newline at end of file
+} // namespace op::cast::cpu
@@ -1,33 +1,47 @@
 #ifndef __CAST_CPU_H__
 #define __CAST_CPU_H__
 
-#include "../../../operator.h"
-#include "../../../tensor.h"
-#include "../../../handle.h"
-#include <vector>
+#include "../../../elementwise/cpu/elementwise_cpu.h"
 
 namespace op::cast::cpu {
 
+// Converts the input described by an ElementwiseInfo into the output, one instance per dtype pair.
+// Contiguous tensors are shared out among the threads in chunks of `chunk` elements.
+typedef void (*CastFn)(const op::elementwise::ElementwiseInfo &info, void *output, const void *input, ptrdiff_t chunk);
+
 class Descriptor final : public InfiniopDescriptor {
-private:
     infiniDtype_t _input_dtype;
     infiniDtype_t _output_dtype;
-    struct Opaque;
-    Opaque *_opaque;
-
-    Descriptor(infiniDtype_t input_dtype, infiniDtype_t output_dtype);
+    op::elementwise::ElementwiseInfo _info;
+    CastFn _cast;
+    ptrdiff_t _chunk;
+
+    Descriptor(
+        infiniDtype_t input_dtype,
+        infiniDtype_t output_dtype,
+        op::elementwise::ElementwiseInfo info,
+        CastFn cast,
+        ptrdiff_t chunk,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _input_dtype(input_dtype),
+          _output_dtype(output_dtype),
+          _info(std::move(info)),
+          _cast(cast),
+          _chunk(chunk) {}
 
 public:
     ~Descriptor();
 
+    size_t workspaceSize() const { return 0; }
+
     static infiniStatus_t create(
         infiniopHandle_t handle,
         Descriptor **desc_ptr,
         infiniopTensorDescriptor_t output_desc,
         std::vector<infiniopTensorDescriptor_t> input_desc_vec);
 
-    size_t workspaceSize() const;
-
     infiniStatus_t calculate(
         void *workspace,
         size_t workspace_size,
@@ -36,10 +50,6 @@ public:
         void *stream) const;
 };
 
-// 模板辅助函数声明
-template<typename InputType, typename OutputType>
-void cast_elements(const InputType* input, OutputType* output, size_t numel);
-
 } // namespace op::cast::cpu
 
-#endif // __CAST_CPU_H__
\ No newline at end of file
+#endif // __CAST_CPU_H__
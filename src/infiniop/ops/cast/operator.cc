@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/cast.h"
 
 #ifdef ENABLE_CPU_API
@@ -17,6 +20,7 @@ __C infiniStatus_t infiniopCreateCastDescriptor(
     infiniopCastDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t output_desc,
     infiniopTensorDescriptor_t input_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateCastDescriptor, infiniopDestroyCastDescriptor, handle, desc_ptr, output_desc, input_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -83,11 +87,13 @@ __C infiniStatus_t infiniopCast(
     void *output,
     const void *input,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopCast, desc, workspace, workspace_size, output, input, stream);
+    INFINIOP_TRACE(infiniopCast, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::cast::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, output, {input}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::cast::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, output, {input}, stream))
 
     switch (desc->device_type) {
 
@@ -113,6 +119,7 @@ __C infiniStatus_t infiniopCast(
 
 __C infiniStatus_t
 infiniopDestroyCastDescriptor(infiniopCastDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
@@ -1,10 +1,19 @@
 #include "causal_softmax_cpu.h"
 #include "../../../devices/cpu/common_cpu.h"
-#include "../../../reduce/cpu/reduce.h"
+#include "../../../reduce/cpu/softmax.h"
 
 namespace op::causal_softmax::cpu {
 
-Descriptor::~Descriptor() {}
+using namespace op::common_cpu::softmax_op;
+
+struct Descriptor::Opaque {
+    // number of ranges each row is split into
+    size_t parts;
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
 
 infiniStatus_t Descriptor::create(
     infiniopHandle_t handle,
@@ -13,47 +22,51 @@ infiniStatus_t Descriptor::create(
     infiniopTensorDescriptor_t x_desc) {
     auto result = CausalSoftmaxInfo::create(y_desc, x_desc);
     CHECK_RESULT(result);
-    *desc_ptr = new Descriptor(nullptr, result.take(), 0, handle->device, handle->device_id);
+    auto info = result.take();
+
+    size_t rows = info.batch_size * info.seq_len;
+    size_t parts = splitCount(rows, info.total_seq_len);
+    size_t workspace_size = parts > 1 ? rows * parts * sizeof(Stats) : 0;
+
+    *desc_ptr = new Descriptor(new Opaque{parts}, info, workspace_size, handle->device, handle->device_id);
     return INFINI_STATUS_SUCCESS;
 }
 
 template <typename T>
-infiniStatus_t causal_softmax(const CausalSoftmaxInfo *info, T *y, const T *x) {
-#pragma omp parallel for
-    for (ptrdiff_t index = 0; index < ptrdiff_t(info->batch_size * info->seq_len); index++) {
-        size_t batch = index / info->seq_len;
-        size_t i = (index % info->seq_len);
-        ptrdiff_t y_offset = batch * info->y_stride_b + i * info->y_stride_i;
-        ptrdiff_t x_offset = batch * info->x_stride_b + i * info->x_stride_i;
-        T *y_ = y + y_offset;
-        const T *x_ = x + x_offset;
+void causal_softmax(const CausalSoftmaxInfo *info, size_t parts, Stats *partial, T *y, const T *x) {
+    size_t rows = info->batch_size * info->seq_len;
+    bool parallel = rows * info->total_seq_len >= SOFTMAX_PARALLEL_MIN;
 
-        for (size_t j = info->total_seq_len - info->seq_len + i + 1; j < info->total_seq_len; j++) {
-            if constexpr (std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value) {
-                y_[j * info->y_stride_j] = utils::cast<T>(0.0f);
-            } else {
-                y_[j * info->y_stride_j] = 0.0f;
-            }
-        }
-        float val = op::common_cpu::reduce_op::max(x_, info->total_seq_len - info->seq_len + i + 1, info->x_stride_j);
-        for (size_t j = 0; j <= info->total_seq_len - info->seq_len + i; j++) {
-            if constexpr (std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value) {
-                y_[j * info->y_stride_j] = utils::cast<T>(std::exp(utils::cast<float>(x_[j * info->x_stride_j]) - val));
-            } else {
-                y_[j * info->y_stride_j] = std::exp(x_[j * info->x_stride_j] - val);
-            }
-        }
-        float sum = op::common_cpu::reduce_op::sum(y_, info->total_seq_len - info->seq_len + i + 1, info->y_stride_j);
-        for (size_t j = 0; j <= info->total_seq_len - info->seq_len + i; j++) {
-            if constexpr (std::is_same<T, fp16_t>::value || std::is_same<T, bf16_t>::value) {
-                y_[j * info->y_stride_j] = utils::cast<T>(utils::cast<float>(y_[j * info->y_stride_j]) / sum);
-            } else {
-                y_[j * info->y_stride_j] = y_[j * info->y_stride_j] / sum;
-            }
-        }
-    }
+    // row i of a batch attends to the first total_seq_len - seq_len + i + 1 positions
+    auto row_len = [info](size_t row) {
+        return info->total_seq_len - info->seq_len + row % info->seq_len + 1;
+    };
+    auto x_row = [info, x](size_t row) {
+        return x + ptrdiff_t(row / info->seq_len) * info->x_stride_b + ptrdiff_t(row % info->seq_len) * info->x_stride_i;
+    };
+    auto y_row = [info, y](size_t row) {
+        return y + ptrdiff_t(row / info->seq_len) * info->y_stride_b + ptrdiff_t(row % info->seq_len) * info->y_stride_i;
+    };
 
-    return INFINI_STATUS_SUCCESS;
+    rowwise(
+        rows, parts, parallel, partial,
+        [&](size_t row, size_t part) {
+            auto [begin, end] = partRange(row_len(row), part, parts);
+            return stats(x_row(row) + ptrdiff_t(begin) * info->x_stride_j, end - begin, info->x_stride_j);
+        },
+        [&](size_t row, size_t part, Stats s) {
+            size_t len = row_len(row);
+            auto [begin, end] = partRange(len, part, parts);
+            T *y_ = y_row(row);
+            writeSoftmax(y_ + ptrdiff_t(begin) * info->y_stride_j, info->y_stride_j,
+                         x_row(row) + ptrdiff_t(begin) * info->x_stride_j, info->x_stride_j, end - begin, s);
+            // the masked positions are written by the last part
+            if (part + 1 == parts) {
+                for (size_t j = len; j < info->total_seq_len; ++j) {
+                    y_[ptrdiff_t(j) * info->y_stride_j] = utils::cast<T>(0.0f);
+                }
+            }
+        });
 }
 
 infiniStatus_t Descriptor::calculate(
@@ -62,12 +75,17 @@ infiniStatus_t Descriptor::calculate(
     const void *x,
     void *stream) const {
 
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    auto partial = reinterpret_cast<Stats *>(workspace);
+
     if (_info.dtype == INFINI_DTYPE_F16) {
-        CHECK_STATUS(causal_softmax<fp16_t>(&_info, (fp16_t *)y, (const fp16_t *)x));
+        causal_softmax<fp16_t>(&_info, _opaque->parts, partial, (fp16_t *)y, (const fp16_t *)x);
     } else if (_info.dtype == INFINI_DTYPE_BF16) {
-        CHECK_STATUS(causal_softmax<bf16_t>(&_info, (bf16_t *)y, (const bf16_t *)x));
+        causal_softmax<bf16_t>(&_info, _opaque->parts, partial, (bf16_t *)y, (const bf16_t *)x);
     } else if (_info.dtype == INFINI_DTYPE_F32) {
-        CHECK_STATUS(causal_softmax<float>(&_info, (float *)y, (const float *)x));
+        causal_softmax<float>(&_info, _opaque->parts, partial, (float *)y, (const float *)x);
     } else {
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/causal_softmax.h"
 
 #ifdef ENABLE_CPU_API
@@ -26,6 +29,7 @@ __C infiniStatus_t infiniopCreateCausalSoftmaxDescriptor(
     infiniopCausalSoftmaxDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t y_desc,
     infiniopTensorDescriptor_t x_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateCausalSoftmaxDescriptor, infiniopDestroyCausalSoftmaxDescriptor, handle, desc_ptr, y_desc, x_desc);
 
 #define CREATE(CASE, NAMESPACE)                                                       \
     case CASE:                                                                        \
@@ -100,11 +104,13 @@ __C infiniStatus_t infiniopCausalSoftmax(
     void *y,
     const void *x,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopCausalSoftmax, desc, workspace, workspace_size, y, x, stream);
+    INFINIOP_TRACE(infiniopCausalSoftmax, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                             \
-    case CASE:                                                                                 \
-        return reinterpret_cast<op::causal_softmax::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, y, x, stream);
+#define CALCULATE(CASE, NAMESPACE)                                                                                 \
+    case CASE:                                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::causal_softmax::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, y, x, stream));
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -133,6 +139,7 @@ __C infiniStatus_t infiniopCausalSoftmax(
 }
 
 __C infiniStatus_t infiniopDestroyCausalSoftmaxDescriptor(infiniopCausalSoftmaxDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                                    \
     case CASE:                                                                      \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/clip.h"
 
 #ifdef ENABLE_CPU_API
@@ -22,6 +25,7 @@ __C infiniStatus_t infiniopCreateClipDescriptor(
     infiniopTensorDescriptor_t x,
     infiniopTensorDescriptor_t min_val,
     infiniopTensorDescriptor_t max_val) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateClipDescriptor, infiniopDestroyClipDescriptor, handle, desc_ptr, y, x, min_val, max_val);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -95,11 +99,13 @@ __C infiniStatus_t infiniopClip(
     const void *min_val,
     const void *max_val,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopClip, desc, workspace, workspace_size, y, x, min_val, max_val, stream);
+    INFINIOP_TRACE(infiniopClip, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::clip::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, y, {x, min_val, max_val}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::clip::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, {x, min_val, max_val}, stream))
 
     switch (desc->device_type) {
 
@@ -128,6 +134,7 @@ __C infiniStatus_t infiniopClip(
 
 __C infiniStatus_t
 infiniopDestroyClipDescriptor(infiniopClipDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
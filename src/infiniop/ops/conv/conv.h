@@ -3,6 +3,14 @@
 
 #include "../../operator.h"
 #include "info.h"
+#include "infiniop/ops/conv.h"
+#include <vector>
+
+// weights converted for one descriptor, see infiniopCreateConvPackedWeights
+struct InfiniopConvPackedWeights {
+    const InfiniopDescriptor *desc;
+    std::vector<float> data;
+};
 
 #define DESCRIPTOR(NAMESPACE)                                    \
                                                                  \
@@ -42,7 +50,21 @@
             const void *pads,                                    \
             const void *strides,                                 \
             const void *dilations,                               \
-            size_t n);                                           \
+            size_t n,                                            \
+            size_t groups);                                      \
+                                                                 \
+        /* only implemented by the CPU backend */                \
+        infiniopConvAlgo_t algorithm() const;                    \
+        infiniStatus_t packWeights(                              \
+            std::vector<float> &packed,                          \
+            const void *w) const;                                \
+        infiniStatus_t calculatePacked(                          \
+            void *workspace, size_t workspace_size,              \
+            void *y,                                             \
+            const void *x,                                       \
+            const float *packed_w,                               \
+            const void *bias,                                    \
+            void *stream) const;                                 \
                                                                  \
         infiniStatus_t calculate(                                \
             void *workspace, size_t workspace_size,              \
@@ -1,39 +1,156 @@
 #include "conv_cpu.h"
 #include "../../../devices/cpu/common_cpu.h"
+#include "../../gemm/cpu/kernel.h"
 #include <algorithm>
 
 namespace op::conv::cpu {
 
-inline size_t calculatePaddedInputSize(const ConvInfo &info) {
-    std::vector<size_t> shape(info.ndim() + 2);
-    shape[0] = info.batch();
-    shape[1] = info.in_channels();
+using op::gemm::cpu::multiplyPanel;
+using op::gemm::cpu::packPanel;
+using op::gemm::cpu::packSize;
+using op::gemm::cpu::TILE_K;
+using op::gemm::cpu::TILE_M;
+using op::gemm::cpu::TILE_N;
+using op::gemm::cpu::toFloat;
+
+/**
+ * The algorithm is picked once at `Descriptor::create`:
+ *
+ * - DEPTHWISE (groups == in_channels): direct kernel, one tap at a time over a row of output
+ *   positions (channels-first) or over all channels of one position (channels-last);
+ * - WINOGRAD (2D, 3x3, stride 1, dilation 1, one group): F(2x2, 3x3), the 16 transformed
+ *   planes are each one GEMM over the input channels, see `convWinograd`;
+ * - GEMM_1X1 (1x1 kernel, stride 1, no padding, spatial dims that flatten to one stride):
+ *   x is already the GEMM operand and is read as a plain strided matrix;
+ * - IMPLICIT_GEMM otherwise.
+ *
+ * The two GEMM algorithms run per batch item and group, in one of two orientations:
+ *
+ * - channels-first: y[co, p] = sum_k w[co, k] * col[k, p], k = (in_channel, kernel offset),
+ *   panels of `col` are gathered from x by `packColPanel`;
+ * - channels-last (x and y with unit channel stride):
+ *   y[p, co] = sum_k col[p, k] * w[k, co], k = (kernel offset, in_channel),
+ *   rows of `col` are runs of contiguous channels gathered by `packRowPanel`.
+ *
+ * `col` is never materialized and taps that land in the padding read as zeros. The weights
+ * are converted to f32 in the layout the algorithm multiplies with, see `packWeights`, either
+ * per call into the workspace or once by `Descriptor::packWeights` into a copy of the caller.
+ */
+enum class ConvLayout {
+    CHANNELS_FIRST,
+    CHANNELS_LAST,
+};
+
+struct ConvPlan {
+    infiniopConvAlgo_t algo;
+    ConvLayout layout;
+    // parts the output channels are split into when there are few position tiles
+    size_t co_splits;
+    // number of threads the workspace is sized for
+    size_t num_threads;
+    // element strides of x, y and w (batch/out channel, channel, spatial...) and of the bias
+    std::vector<ptrdiff_t> x_strides, y_strides, w_strides;
+    ptrdiff_t b_stride;
+};
+
+struct Descriptor::Opaque {
+    ConvPlan plan;
+};
+
+// elements of one transformed F(2x2, 3x3) tile
+constexpr size_t WINOGRAD_TILE = 16;
+
+inline size_t kernelSize(const ConvInfo &info) {
+    size_t size = 1;
     for (size_t i = 0; i < info.ndim(); ++i) {
-        shape[i + 2] = info.input_dim(i);
+        size *= info.kernel_dim(i);
     }
+    return size;
+}
 
-    return op::common_cpu::getPaddedSize(info.ndim() + 2, shape.data(), info.getPadsInfo());
+inline size_t winogradTiles(const ConvInfo &info) {
+    return CEIL_DIV(info.output_dim(0), 2) * CEIL_DIV(info.output_dim(1), 2);
 }
 
-inline size_t calculateOutputSize(const ConvInfo &info) {
-    size_t size = info.batch() * info.out_channels();
-    for (size_t i = 0; i < info.ndim(); ++i) {
-        size *= info.output_dim(i);
+// output channels accumulated by one work item, counted inside one group
+inline size_t coPerSplit(const ConvInfo &info, const ConvPlan &plan) {
+    size_t tile = plan.layout == ConvLayout::CHANNELS_FIRST || plan.algo == INFINIOP_CONV_ALGO_WINOGRAD ? TILE_M : TILE_N;
+    return CEIL_DIV(CEIL_DIV(info.out_channels() / info.groups(), tile), plan.co_splits) * tile;
+}
+
+// floats of private scratch used by one thread
+inline size_t threadScratchSize(const ConvInfo &info, const ConvPlan &plan) {
+    switch (plan.algo) {
+    case INFINIOP_CONV_ALGO_DEPTHWISE:
+        // one row of outputs, or all channels of one position
+        return plan.layout == ConvLayout::CHANNELS_FIRST ? info.output_dim(info.ndim() - 1) : info.out_channels();
+    case INFINIOP_CONV_ALGO_WINOGRAD:
+        // transformed input tiles and the transformed accumulators of one channel tile
+        return WINOGRAD_TILE * (info.in_channels() + TILE_M) * TILE_N;
+    default:
+        // accumulators of one work item and one packed panel
+        if (plan.layout == ConvLayout::CHANNELS_FIRST) {
+            return coPerSplit(info, plan) * TILE_N + packSize(TILE_N);
+        }
+        return TILE_M * coPerSplit(info, plan) + TILE_M * TILE_K;
     }
-    return size;
 }
 
-inline bool needsPadding(const ConvInfo &info) {
-    const size_t *pads = info.getPadsInfo();
-    for (size_t i = 0; i < info.ndim(); ++i) {
-        if (pads[i] > 0) {
-            return true;
+// threads of a parallel region: the workspace holds scratch for plan.num_threads, and a graph
+// launch may give this call a smaller share of the team
+inline int teamSize(const ConvPlan &plan) {
+    return int(std::min(plan.num_threads, op::common_cpu::getMaxThreads()));
+}
+
+// floats of the f32 copy of the weights
+inline size_t packedWeightsSize(const ConvInfo &info, const ConvPlan &plan) {
+    if (plan.algo == INFINIOP_CONV_ALGO_WINOGRAD) {
+        return WINOGRAD_TILE * info.out_channels() * info.in_channels();
+    }
+    return info.out_channels() * info.in_channels() / info.groups() * kernelSize(info);
+}
+
+// whether the spatial dims of a tensor can be walked as one dim with the stride of the last one
+inline bool spatialFlattens(const ConvInfo &info, const std::vector<ptrdiff_t> &strides, const size_t *dims) {
+    for (size_t d = 0; d + 1 < info.ndim(); ++d) {
+        if (strides[d + 2] != strides[d + 3] * ptrdiff_t(dims[d + 1])) {
+            return false;
         }
     }
-    return false;
+    return true;
+}
+
+inline infiniopConvAlgo_t chooseAlgorithm(const ConvInfo &info,
+                                          const std::vector<ptrdiff_t> &x_strides,
+                                          const std::vector<ptrdiff_t> &y_strides) {
+    bool unit_stride = true, unit_dilation = true, no_padding = true;
+    for (size_t d = 0; d < info.ndim(); ++d) {
+        unit_stride &= info.stride_info(d) == 1;
+        unit_dilation &= info.dilation_info(d) == 1;
+        no_padding &= info.pad_info(d) == 0;
+    }
+
+    if (info.groups() > 1 && info.groups() == info.in_channels()) {
+        return INFINIOP_CONV_ALGO_DEPTHWISE;
+    }
+    // below a few channels the transforms cost more than the multiplications they save
+    if (info.groups() == 1 && info.ndim() == 2
+        && info.kernel_dim(0) == 3 && info.kernel_dim(1) == 3
+        && unit_stride && unit_dilation
+        && info.in_channels() >= 8 && info.out_channels() >= 8) {
+        return INFINIOP_CONV_ALGO_WINOGRAD;
+    }
+    if (kernelSize(info) == 1 && unit_stride && no_padding
+        && spatialFlattens(info, x_strides, info.getInputDims())
+        && spatialFlattens(info, y_strides, info.getOutputDims())) {
+        return INFINIOP_CONV_ALGO_GEMM_1X1;
+    }
+    return INFINIOP_CONV_ALGO_IMPLICIT_GEMM;
 }
 
-Descriptor::~Descriptor() = default;
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
 
 infiniStatus_t Descriptor::create(
     infiniopHandle_t handle_,
@@ -45,319 +162,816 @@ infiniStatus_t Descriptor::create(
     const void *pads,
     const void *strides,
     const void *dilations,
-    size_t n) {
+    size_t n,
+    size_t groups) {
     auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
     auto dtype = y_desc->dtype();
 
     CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_BF16);
+    CHECK_OR_RETURN(!y_desc->hasBroadcastDim(), INFINI_STATUS_BAD_TENSOR_STRIDES);
 
     auto result = ConvInfo::create(handle_, y_desc, x_desc, w_desc, b_desc,
-                                   pads, strides, dilations, n);
+                                   pads, strides, dilations, n, groups);
     CHECK_RESULT(result);
-
-    size_t WorkSpaceSize = 0;
-    const ConvInfo &info = result.take();
-
-    if (needsPadding(info)) {
-        WorkSpaceSize += calculatePaddedInputSize(info) * infiniSizeOf(dtype);
+    auto info = result.take();
+
+    ConvPlan plan{
+        chooseAlgorithm(info, x_desc->strides(), y_desc->strides()),
+        ConvLayout::CHANNELS_FIRST, 1, op::common_cpu::getMaxThreads(),
+        x_desc->strides(), y_desc->strides(), w_desc->strides(),
+        b_desc ? b_desc->stride(0) : 0};
+
+    // channels-last inputs are processed channel-contiguous, anything else takes the strided channels-first path
+    if (x_desc->stride(1) == 1 && y_desc->stride(1) == 1
+        && (info.in_channels() > 1 || plan.algo == INFINIOP_CONV_ALGO_DEPTHWISE)) {
+        plan.layout = ConvLayout::CHANNELS_LAST;
     }
 
-    if (dtype == INFINI_DTYPE_F16 || dtype == INFINI_DTYPE_BF16) {
-        WorkSpaceSize += calculateOutputSize(info) * sizeof(float);
+    // With few position tiles (small images, batch 1), split the output channels so all threads get work
+    if (plan.algo != INFINIOP_CONV_ALGO_DEPTHWISE) {
+        bool co_rows = plan.layout == ConvLayout::CHANNELS_FIRST || plan.algo == INFINIOP_CONV_ALGO_WINOGRAD;
+        size_t position_tile = co_rows ? TILE_N : TILE_M;
+        size_t co_tile = co_rows ? TILE_M : TILE_N;
+        size_t positions = plan.algo == INFINIOP_CONV_ALGO_WINOGRAD ? winogradTiles(info) : info.spatial_sizes();
+        size_t items = info.batch() * info.groups() * CEIL_DIV(positions, position_tile);
+        size_t co_tiles = CEIL_DIV(info.out_channels() / info.groups(), co_tile);
+        plan.co_splits = std::max<size_t>(1, std::min(plan.num_threads / std::max<size_t>(items, 1), co_tiles));
     }
 
+    size_t workspace_size = (packedWeightsSize(info, plan) + plan.num_threads * threadScratchSize(info, plan)) * sizeof(float);
+
     *desc_ptr = new Descriptor(
-        dtype, std::move(info), WorkSpaceSize,
-        nullptr,
+        dtype, std::move(info), workspace_size,
+        new Opaque{std::move(plan)},
         handle->device, handle->device_id);
     return INFINI_STATUS_SUCCESS;
 }
 
-template <typename Tdata>
-void fillPaddedInput(
-    const ConvInfo &info,
-    const Tdata *x,
-    const size_t *padded_x_shape,
-    Tdata *padded_x,
-    size_t x_index,
-    size_t padded_x_index,
-    size_t ndim) {
-    size_t x_shape_val;
-    if (ndim == 0) {
-        x_shape_val = info.batch();
-    } else if (ndim == 1) {
-        x_shape_val = info.in_channels();
-    } else {
-        x_shape_val = info.input_dim(ndim - 2);
+infiniopConvAlgo_t Descriptor::algorithm() const {
+    return _opaque->plan.algo;
+}
+
+// offset of a kernel position in w
+inline ptrdiff_t kernelOffset(const ConvInfo &info, const ptrdiff_t *w_strides, size_t kpos) {
+    ptrdiff_t offset = 0;
+    for (size_t d = info.ndim(); d-- > 0;) {
+        offset += ptrdiff_t(kpos % info.kernel_dim(d)) * w_strides[d + 2];
+        kpos /= info.kernel_dim(d);
     }
+    return offset;
+}
+
+// U = G g G^T of one 3x3 filter, G = [1 0 0; 1/2 1/2 1/2; 1/2 -1/2 1/2; 0 0 1]
+inline void winogradFilter(const float g[9], float u[WINOGRAD_TILE]) {
+    float t[4][3];
+    for (size_t j = 0; j < 3; ++j) {
+        t[0][j] = g[j];
+        t[1][j] = 0.5f * (g[j] + g[3 + j] + g[6 + j]);
+        t[2][j] = 0.5f * (g[j] - g[3 + j] + g[6 + j]);
+        t[3][j] = g[6 + j];
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        u[i * 4 + 0] = t[i][0];
+        u[i * 4 + 1] = 0.5f * (t[i][0] + t[i][1] + t[i][2]);
+        u[i * 4 + 2] = 0.5f * (t[i][0] - t[i][1] + t[i][2]);
+        u[i * 4 + 3] = t[i][2];
+    }
+}
 
-    const auto padded_x_shape_val = padded_x_shape[ndim];
-    const auto x_base_index = x_index * x_shape_val;
+// V = B^T d B of one 4x4 input tile, B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1]
+inline void winogradInput(const float d[WINOGRAD_TILE], float v[WINOGRAD_TILE]) {
+    float t[4][4];
+    for (size_t j = 0; j < 4; ++j) {
+        t[0][j] = d[j] - d[8 + j];
+        t[1][j] = d[4 + j] + d[8 + j];
+        t[2][j] = d[8 + j] - d[4 + j];
+        t[3][j] = d[4 + j] - d[12 + j];
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        v[i * 4 + 0] = t[i][0] - t[i][2];
+        v[i * 4 + 1] = t[i][1] + t[i][2];
+        v[i * 4 + 2] = t[i][2] - t[i][1];
+        v[i * 4 + 3] = t[i][1] - t[i][3];
+    }
+}
 
-    size_t pad_offset = 0;
-    if (ndim >= 2 && x_shape_val != padded_x_shape_val) {
-        pad_offset = info.pad_info(ndim - 2);
+// Y = A^T m A of one 4x4 transformed tile, A^T = [1 1 1 0; 0 1 -1 -1]
+inline void winogradOutput(const float m[WINOGRAD_TILE], float y[4]) {
+    float t[2][4];
+    for (size_t j = 0; j < 4; ++j) {
+        t[0][j] = m[j] + m[4 + j] + m[8 + j];
+        t[1][j] = m[4 + j] - m[8 + j] - m[12 + j];
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        y[i * 2 + 0] = t[i][0] + t[i][1] + t[i][2];
+        y[i * 2 + 1] = t[i][1] - t[i][2] - t[i][3];
     }
+}
 
-    const auto padded_x_base_index = padded_x_index * padded_x_shape_val + pad_offset;
+/**
+ * Converts w to f32 in the layout of the algorithm's operand:
+ *
+ * - channels-first GEMM: [co, k] row-major, k = (in_channel of the group, kernel offset);
+ * - channels-last GEMM: per group, column blocks of TILE_N output channels, each [k, block width]
+ *   row-major, k = (kernel offset, in_channel of the group), so a panel of a block is directly
+ *   usable by `multiplyPanel`;
+ * - WINOGRAD: [tile element, co, ci], the transformed filters;
+ * - DEPTHWISE: [kernel offset, co].
+ *
+ * The weights are only bound at `calculate`, so unless they were packed beforehand this runs once per
+ * call, not once per tile.
+ */
+template <typename Tdata>
+void packWeights(const ConvInfo &info, const ConvPlan &plan, float *dst, const Tdata *w) {
+    const ptrdiff_t *w_strides = plan.w_strides.data();
+    const size_t ci_count = info.in_channels() / info.groups();
+    const size_t kernel_size = kernelSize(info);
+    const size_t k = ci_count * kernel_size;
+    const size_t co_count = info.out_channels();
+    const size_t co_group = co_count / info.groups();
 
-    for (size_t i = 0; i < x_shape_val; ++i) {
-        if (ndim == info.ndim() + 2 - 1) {
-            padded_x[padded_x_base_index + i] = x[x_base_index + i];
-        } else {
-            fillPaddedInput(info, x, padded_x_shape, padded_x,
-                            x_base_index + i, padded_x_base_index + i, ndim + 1);
+#pragma omp parallel for
+    for (ptrdiff_t co = 0; co < ptrdiff_t(co_count); ++co) {
+        const Tdata *w_co = w + co * w_strides[0];
+
+        if (plan.algo == INFINIOP_CONV_ALGO_WINOGRAD) {
+            for (size_t ci = 0; ci < ci_count; ++ci) {
+                float g[9], u[WINOGRAD_TILE];
+                for (size_t kpos = 0; kpos < 9; ++kpos) {
+                    g[kpos] = toFloat(w_co[ci * w_strides[1] + kernelOffset(info, w_strides, kpos)]);
+                }
+                winogradFilter(g, u);
+                for (size_t e = 0; e < WINOGRAD_TILE; ++e) {
+                    dst[(e * co_count + co) * ci_count + ci] = u[e];
+                }
+            }
+            continue;
+        }
+        if (plan.algo == INFINIOP_CONV_ALGO_DEPTHWISE) {
+            for (size_t kpos = 0; kpos < kernel_size; ++kpos) {
+                dst[kpos * co_count + co] = toFloat(w_co[kernelOffset(info, w_strides, kpos)]);
+            }
+            continue;
         }
+
+        size_t local = size_t(co) % co_group;
+        size_t block = local / TILE_N, j = local % TILE_N;
+        size_t nb = std::min(TILE_N, co_group - block * TILE_N);
+        float *block_dst = dst + (size_t(co) - local + block * TILE_N) * k;
+        for (size_t kpos = 0; kpos < kernel_size; ++kpos) {
+            const Tdata *src = w_co + kernelOffset(info, w_strides, kpos);
+            for (size_t ci = 0; ci < ci_count; ++ci) {
+                float val = toFloat(src[ci * w_strides[1]]);
+                if (plan.layout == ConvLayout::CHANNELS_FIRST) {
+                    dst[co * k + ci * kernel_size + kpos] = val;
+                } else {
+                    block_dst[(kpos * ci_count + ci) * nb + j] = val;
+                }
+            }
+        }
+    }
+}
+
+// output coordinates of positions [p0, p0 + count), ndim per position
+inline void outputCoords(const ConvInfo &info, ptrdiff_t *coords, size_t p0, size_t count) {
+    const size_t ndim = info.ndim();
+    for (size_t j = 0; j < count; ++j) {
+        size_t p = p0 + j;
+        for (size_t d = ndim; d-- > 0;) {
+            coords[j * ndim + d] = ptrdiff_t(p % info.output_dim(d));
+            p /= info.output_dim(d);
+        }
+    }
+}
+
+// offset into x of the tap `kpos` of an output position, false if it lies in the padding
+inline bool inputOffset(const ConvInfo &info, const ptrdiff_t *x_strides,
+                        const ptrdiff_t *out_coords, size_t kpos, ptrdiff_t &offset) {
+    offset = 0;
+    bool inside = true;
+    for (size_t d = info.ndim(); d-- > 0;) {
+        ptrdiff_t c = out_coords[d] * info.stride_info(d)
+                    + ptrdiff_t(kpos % info.kernel_dim(d) * info.dilation_info(d))
+                    - ptrdiff_t(info.pad_info(d));
+        kpos /= info.kernel_dim(d);
+        inside &= c >= 0 && c < ptrdiff_t(info.input_dim(d));
+        offset += c * x_strides[d + 2];
     }
+    return inside;
 }
 
-template <typename Xdata, typename Ydata>
-void _applyConv(
+// pack[kk * nb + j] = col[k0 + kk, j] for the nb positions of `out_coords`, k = (in_channel, kernel offset)
+template <typename Tdata>
+void packColPanel(
     const ConvInfo &info,
-    Ydata *y,
-    const Xdata *x,
-    const Xdata *w,
-    const size_t *x_shape,
-    size_t x_index,
-    size_t w_index,
-    size_t y_index,
-    size_t ndim) {
-
-    size_t dim_size, kernel_size;
-    size_t dilation, stride;
-
-    if (ndim < 2) {
-        return;
-    } else {
-        dim_size = x_shape[ndim];
-        kernel_size = info.kernel_dim(ndim - 2);
-        dilation = info.dilation_info(ndim - 2);
-        stride = info.stride_info(ndim - 2);
-    }
-    if (stride == 0) {
-        std::cerr << "Error: stride cannot be zero." << std::endl;
-    }
-    const auto steps = (dim_size - dilation * (kernel_size - 1) - 1) / stride + 1;
-    x_index *= dim_size;
-    w_index *= kernel_size;
-    size_t y_stride;
-    if (ndim == 0) {
-        y_stride = info.out_channels();
-    } else if (ndim == 1) {
-        y_stride = 1;
-    } else {
-        y_stride = info.output_dim(ndim - 2);
-    }
-    y_index *= y_stride;
-    for (size_t i = 0; i < steps; ++i, ++y_index) {
-        for (size_t k = 0; k < kernel_size; ++k) {
-            const auto curr_x_index = x_index + i * stride + k * dilation;
-            const auto curr_w_index = w_index + k;
-            if (ndim == info.ndim() + 1) {
-                if constexpr (std::is_same<Xdata, fp16_t>::value || std::is_same<Xdata, bf16_t>::value) {
-                    y[y_index] += utils::cast<float>(x[curr_x_index]) * utils::cast<float>(w[curr_w_index]);
-                } else {
-                    y[y_index] += x[curr_x_index] * w[curr_w_index];
+    const ptrdiff_t *x_strides,
+    float *pack,
+    const Tdata *x,
+    const ptrdiff_t *out_coords,
+    size_t k0, size_t kc, size_t nb) {
+
+    const size_t kernel_size = kernelSize(info);
+    for (size_t kk = 0; kk < kc; ++kk) {
+        size_t ci = (k0 + kk) / kernel_size, kpos = (k0 + kk) % kernel_size;
+        const Tdata *x_c = x + ci * x_strides[1];
+        float *out = pack + kk * nb;
+        for (size_t j = 0; j < nb; ++j) {
+            ptrdiff_t offset;
+            out[j] = inputOffset(info, x_strides, out_coords + j * info.ndim(), kpos, offset)
+                       ? toFloat(x_c[offset])
+                       : 0.0f;
+        }
+    }
+}
+
+// pack[i * kc + kk] = col[i, k0 + kk] for the mb positions of `out_coords`, k = (kernel offset, in_channel)
+template <typename Tdata>
+void packRowPanel(
+    const ConvInfo &info,
+    const ptrdiff_t *x_strides,
+    float *pack,
+    const Tdata *x,
+    const ptrdiff_t *out_coords,
+    size_t k0, size_t kc, size_t mb) {
+
+    const size_t ci_count = info.in_channels() / info.groups();
+    for (size_t i = 0; i < mb; ++i) {
+        float *out = pack + i * kc;
+        // walk the panel in runs of contiguous channels of one kernel offset
+        for (size_t kk = 0; kk < kc;) {
+            size_t kpos = (k0 + kk) / ci_count, ci = (k0 + kk) % ci_count;
+            size_t len = std::min(ci_count - ci, kc - kk);
+            ptrdiff_t offset;
+            if (inputOffset(info, x_strides, out_coords + i * info.ndim(), kpos, offset)) {
+                const Tdata *src = x + offset + ci;
+                for (size_t t = 0; t < len; ++t) {
+                    out[kk + t] = toFloat(src[t]);
                 }
             } else {
-                _applyConv(info, y, x, w, x_shape, curr_x_index, curr_w_index,
-                           y_index, ndim + 1);
+                std::fill(out + kk, out + kk + len, 0.0f);
             }
+            kk += len;
         }
     }
 }
 
-template <typename Xdata, typename Ydata>
-void applyConv(
+template <typename Tdata>
+void convChannelsFirst(
     const ConvInfo &info,
-    Ydata *y,
-    const Xdata *x,
-    const Xdata *w,
-    const size_t *x_shape) {
-    const ptrdiff_t batch_size = static_cast<ptrdiff_t>(info.batch());
-    const ptrdiff_t out_channels = static_cast<ptrdiff_t>(info.out_channels());
-    const ptrdiff_t total_iterations = batch_size * out_channels;
-
-#pragma omp parallel for schedule(dynamic)
-    for (ptrdiff_t iter = 0; iter < total_iterations; ++iter) {
-        const ptrdiff_t i = iter / out_channels; // batch index
-        const ptrdiff_t j = iter % out_channels; // output channel index
-
-        const size_t y_index = static_cast<size_t>(i) * info.out_channels() + static_cast<size_t>(j);
-
-        // 内层循环：遍历输入通道
-        for (size_t k = 0; k < info.in_channels(); ++k) {
-            const size_t x_index = static_cast<size_t>(i) * info.in_channels() + k;
-            const size_t w_index = static_cast<size_t>(j) * info.in_channels() + k;
-            _applyConv(info, y, x, w, x_shape, x_index, w_index, y_index, 2);
+    const ConvPlan &plan,
+    const float *w,
+    float *scratch_base,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *bias) {
+
+    const size_t ndim = info.ndim();
+    const size_t groups = info.groups();
+    const size_t co_group = info.out_channels() / groups;
+    const size_t ci_group = info.in_channels() / groups;
+    const size_t k = ci_group * kernelSize(info);
+    const size_t positions = info.spatial_sizes();
+    const size_t p_tiles = CEIL_DIV(positions, TILE_N);
+    const size_t co_splits = plan.co_splits;
+    const size_t co_per_split = coPerSplit(info, plan);
+    const size_t scratch_size = threadScratchSize(info, plan);
+    const bool pointwise = plan.algo == INFINIOP_CONV_ALGO_GEMM_1X1;
+    const ptrdiff_t *xs = plan.x_strides.data(), *ys = plan.y_strides.data();
+    // stride between consecutive positions of the flattened spatial dims, pointwise only
+    const ptrdiff_t x_ps = xs[ndim + 1];
+
+#pragma omp parallel num_threads(teamSize(plan))
+    {
+        float *acc = scratch_base + op::common_cpu::getThreadId() * scratch_size;
+        float *pack = acc + co_per_split * TILE_N;
+        std::vector<ptrdiff_t> out_coords(TILE_N * ndim), y_offsets(TILE_N);
+
+#pragma omp for schedule(static)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(info.batch() * groups * p_tiles * co_splits); ++item) {
+            size_t split = size_t(item) % co_splits;
+            size_t p0 = size_t(item) / co_splits % p_tiles * TILE_N;
+            size_t group = size_t(item) / co_splits / p_tiles % groups;
+            size_t batch = size_t(item) / co_splits / p_tiles / groups;
+            size_t nb = std::min(TILE_N, positions - p0);
+            size_t co_begin = group * co_group + split * co_per_split;
+            size_t co_end = std::min((group + 1) * co_group, co_begin + co_per_split);
+            if (co_begin >= co_end) {
+                continue;
+            }
+
+            outputCoords(info, out_coords.data(), p0, nb);
+            for (size_t j = 0; j < nb; ++j) {
+                y_offsets[j] = 0;
+                for (size_t d = 0; d < ndim; ++d) {
+                    y_offsets[j] += out_coords[j * ndim + d] * ys[d + 2];
+                }
+            }
+
+            std::fill(acc, acc + (co_end - co_begin) * TILE_N, 0.0f);
+            const Tdata *x_g = x + batch * xs[0] + group * ci_group * xs[1];
+            for (size_t k0 = 0; k0 < k; k0 += TILE_K) {
+                size_t kc = std::min(TILE_K, k - k0);
+                // one panel of col feeds every output channel of the item
+                if (pointwise) {
+                    packPanel(pack, x_g + k0 * xs[1] + p0 * x_ps, xs[1], x_ps, kc, nb);
+                } else {
+                    packColPanel(info, xs, pack, x_g, out_coords.data(), k0, kc, nb);
+                }
+                for (size_t c0 = co_begin; c0 < co_end; c0 += TILE_M) {
+                    size_t mb = std::min(TILE_M, co_end - c0);
+                    multiplyPanel(acc + (c0 - co_begin) * TILE_N, TILE_N, mb, nb, kc,
+                                  w + c0 * k + k0, ptrdiff_t(k), ptrdiff_t(1),
+                                  pack);
+                }
+            }
+
+            // epilogue: bias and conversion to the output type
+            for (size_t c = co_begin; c < co_end; ++c) {
+                const float *row = acc + (c - co_begin) * TILE_N;
+                const float b = bias ? toFloat(bias[c * plan.b_stride]) : 0.0f;
+                Tdata *y_c = y + batch * ys[0] + c * ys[1];
+                for (size_t j = 0; j < nb; ++j) {
+                    y_c[y_offsets[j]] = utils::cast<Tdata>(row[j] + b);
+                }
+            }
         }
     }
 }
 
-template <typename Xdata, typename Ydata>
-void _conv_cpu(
+template <typename Tdata>
+void convChannelsLast(
     const ConvInfo &info,
-    void *workspace,
-    size_t workspace_size,
-    Ydata *y,
-    const Xdata *x,
-    const Xdata *w) {
-    if (needsPadding(info)) {
-        auto padded_x = reinterpret_cast<Xdata *>(workspace);
-        if constexpr (std::is_same<Xdata, fp16_t>::value) {
-            fp16_t zero_val = utils::cast<fp16_t>(0.0f);
-            std::fill(padded_x, padded_x + calculatePaddedInputSize(info), zero_val);
-        } else if constexpr (std::is_same<Xdata, bf16_t>::value) {
-            bf16_t zero_val = utils::cast<bf16_t>(0.0f);
-            std::fill(padded_x, padded_x + calculatePaddedInputSize(info), zero_val);
-        } else if constexpr (std::is_same<Xdata, float>::value) {
-            std::fill(padded_x, padded_x + calculatePaddedInputSize(info), 0.0f);
-        }
-        fillPaddedInput(info, x, info.getPaddedShape(), padded_x, 0, 0, 0);
-
-        applyConv(info, y, padded_x, w, info.getPaddedShape());
-    } else {
-        std::vector<size_t> shape(info.ndim() + 2);
-        shape[0] = info.batch();
-        shape[1] = info.in_channels();
-        for (size_t i = 0; i < info.ndim(); ++i) {
-            shape[i + 2] = info.input_dim(i);
+    const ConvPlan &plan,
+    const float *w,
+    float *scratch_base,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *bias) {
+
+    const size_t ndim = info.ndim();
+    const size_t groups = info.groups();
+    const size_t co_group = info.out_channels() / groups;
+    const size_t ci_group = info.in_channels() / groups;
+    const size_t k = ci_group * kernelSize(info);
+    const size_t positions = info.spatial_sizes();
+    const size_t p_tiles = CEIL_DIV(positions, TILE_M);
+    const size_t co_splits = plan.co_splits;
+    const size_t co_per_split = coPerSplit(info, plan);
+    const size_t scratch_size = threadScratchSize(info, plan);
+    const bool pointwise = plan.algo == INFINIOP_CONV_ALGO_GEMM_1X1;
+    const ptrdiff_t *xs = plan.x_strides.data(), *ys = plan.y_strides.data();
+    // stride between consecutive positions of the flattened spatial dims, pointwise only
+    const ptrdiff_t x_ps = xs[ndim + 1];
+
+#pragma omp parallel num_threads(teamSize(plan))
+    {
+        float *acc = scratch_base + op::common_cpu::getThreadId() * scratch_size;
+        float *pack = acc + TILE_M * co_per_split;
+        std::vector<ptrdiff_t> out_coords(TILE_M * ndim);
+
+#pragma omp for schedule(static)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(info.batch() * groups * p_tiles * co_splits); ++item) {
+            size_t split = size_t(item) % co_splits;
+            size_t p0 = size_t(item) / co_splits % p_tiles * TILE_M;
+            size_t group = size_t(item) / co_splits / p_tiles % groups;
+            size_t batch = size_t(item) / co_splits / p_tiles / groups;
+            size_t mb = std::min(TILE_M, positions - p0);
+            // output channels of the item, counted inside the group
+            size_t co_begin = split * co_per_split;
+            size_t co_end = std::min(co_group, co_begin + co_per_split);
+            if (co_begin >= co_end) {
+                continue;
+            }
+            const size_t ld_acc = co_end - co_begin;
+            const float *w_g = w + group * co_group * k;
+
+            outputCoords(info, out_coords.data(), p0, mb);
+
+            std::fill(acc, acc + TILE_M * ld_acc, 0.0f);
+            const Tdata *x_g = x + batch * xs[0] + group * ci_group;
+            for (size_t k0 = 0; k0 < k; k0 += TILE_K) {
+                size_t kc = std::min(TILE_K, k - k0);
+                // one panel of col rows feeds every output channel block of the item,
+                // pointwise convolutions multiply straight out of x
+                if (!pointwise) {
+                    packRowPanel(info, xs, pack, x_g, out_coords.data(), k0, kc, mb);
+                }
+                for (size_t c0 = co_begin; c0 < co_end; c0 += TILE_N) {
+                    size_t nb = std::min(TILE_N, co_group - c0);
+                    if (pointwise) {
+                        multiplyPanel(acc + (c0 - co_begin), ld_acc, mb, nb, kc,
+                                      x_g + p0 * x_ps + k0, x_ps, ptrdiff_t(1),
+                                      w_g + c0 * k + k0 * nb);
+                    } else {
+                        multiplyPanel(acc + (c0 - co_begin), ld_acc, mb, nb, kc,
+                                      pack, ptrdiff_t(kc), ptrdiff_t(1),
+                                      w_g + c0 * k + k0 * nb);
+                    }
+                }
+            }
+
+            // epilogue: bias and conversion to the output type, contiguous over output channels
+            for (size_t i = 0; i < mb; ++i) {
+                const float *row = acc + i * ld_acc;
+                Tdata *y_p = y + batch * ys[0] + group * co_group;
+                for (size_t d = 0; d < ndim; ++d) {
+                    y_p += out_coords[i * ndim + d] * ys[d + 2];
+                }
+                for (size_t c = co_begin; c < co_end; ++c) {
+                    const float b = bias ? toFloat(bias[(group * co_group + c) * plan.b_stride]) : 0.0f;
+                    y_p[c] = utils::cast<Tdata>(row[c - co_begin] + b);
+                }
+            }
         }
-        applyConv(info, y, x, w, shape.data());
     }
 }
 
+/**
+ * F(2x2, 3x3) Winograd convolution. Per work item (batch, block of TILE_N output tiles,
+ * output channel split) the 4x4 input tiles of every input channel are transformed once,
+ * then each of the 16 tile elements is an independent [co, ci] x [ci, tiles] GEMM whose
+ * right operand is already laid out as a packed panel. The accumulators of one TILE_M
+ * channel tile are transformed back into 2x2 outputs, bias added.
+ */
 template <typename Tdata>
-infiniStatus_t conv_cpu(
+void convWinograd(
     const ConvInfo &info,
-    void *workspace,
-    size_t workspace_size,
-    void *y,
-    const void *x,
-    const void *w,
-    const void *bias) {
-    auto y_ptr = reinterpret_cast<Tdata *>(y);
-    auto x_ptr = reinterpret_cast<const Tdata *>(x);
-    auto w_ptr = reinterpret_cast<const Tdata *>(w);
-    auto output_size = calculateOutputSize(info);
-    if constexpr (std::is_same<Tdata, float>::value) {
-        std::fill(y_ptr, y_ptr + output_size, 0.0f);
-    } else {
-        std::fill(y_ptr, y_ptr + output_size, static_cast<Tdata>(0));
-    }
-    _conv_cpu<Tdata, Tdata>(info, workspace, workspace_size, y_ptr, x_ptr, w_ptr);
-    if (bias != nullptr) {
-        auto bias_ptr = reinterpret_cast<const Tdata *>(bias);
-#pragma omp parallel for
-        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(output_size); ++i) {
-            size_t channel_idx = (i / info.spatial_sizes()) % info.out_channels();
-            y_ptr[i] += bias_ptr[channel_idx];
+    const ConvPlan &plan,
+    const float *u,
+    float *scratch_base,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *bias) {
+
+    const size_t ci_count = info.in_channels(), co_count = info.out_channels();
+    const size_t ih = info.input_dim(0), iw = info.input_dim(1);
+    const size_t oh = info.output_dim(0), ow = info.output_dim(1);
+    const ptrdiff_t pad_h = ptrdiff_t(info.pad_info(0)), pad_w = ptrdiff_t(info.pad_info(1));
+    const size_t tiles_w = CEIL_DIV(ow, 2);
+    const size_t tiles = winogradTiles(info);
+    const size_t t_blocks = CEIL_DIV(tiles, TILE_N);
+    const size_t co_splits = plan.co_splits;
+    const size_t co_per_split = coPerSplit(info, plan);
+    const size_t scratch_size = threadScratchSize(info, plan);
+    const ptrdiff_t *xs = plan.x_strides.data(), *ys = plan.y_strides.data();
+
+#pragma omp parallel num_threads(teamSize(plan))
+    {
+        float *v = scratch_base + op::common_cpu::getThreadId() * scratch_size;
+        float *m = v + WINOGRAD_TILE * ci_count * TILE_N;
+
+#pragma omp for schedule(static)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(info.batch() * t_blocks * co_splits); ++item) {
+            size_t split = size_t(item) % co_splits;
+            size_t t0 = size_t(item) / co_splits % t_blocks * TILE_N;
+            size_t batch = size_t(item) / co_splits / t_blocks;
+            size_t nb = std::min(TILE_N, tiles - t0);
+            size_t co_begin = split * co_per_split;
+            size_t co_end = std::min(co_count, co_begin + co_per_split);
+            if (co_begin >= co_end) {
+                continue;
+            }
+
+            // input transform, v[e][ci][j]
+            const Tdata *x_n = x + batch * xs[0];
+            for (size_t ci = 0; ci < ci_count; ++ci) {
+                const Tdata *x_c = x_n + ci * xs[1];
+                for (size_t j = 0; j < nb; ++j) {
+                    ptrdiff_t h0 = ptrdiff_t((t0 + j) / tiles_w * 2) - pad_h;
+                    ptrdiff_t w0 = ptrdiff_t((t0 + j) % tiles_w * 2) - pad_w;
+                    float d[WINOGRAD_TILE], t[WINOGRAD_TILE];
+                    for (ptrdiff_t r = 0; r < 4; ++r) {
+                        for (ptrdiff_t c = 0; c < 4; ++c) {
+                            ptrdiff_t h = h0 + r, w = w0 + c;
+                            d[r * 4 + c] = h >= 0 && h < ptrdiff_t(ih) && w >= 0 && w < ptrdiff_t(iw)
+                                             ? toFloat(x_c[h * xs[2] + w * xs[3]])
+                                             : 0.0f;
+                        }
+                    }
+                    winogradInput(d, t);
+                    for (size_t e = 0; e < WINOGRAD_TILE; ++e) {
+                        v[(e * ci_count + ci) * nb + j] = t[e];
+                    }
+                }
+            }
+
+            for (size_t c0 = co_begin; c0 < co_end; c0 += TILE_M) {
+                size_t mb = std::min(TILE_M, co_end - c0);
+                std::fill(m, m + WINOGRAD_TILE * TILE_M * TILE_N, 0.0f);
+                for (size_t e = 0; e < WINOGRAD_TILE; ++e) {
+                    for (size_t k0 = 0; k0 < ci_count; k0 += TILE_K) {
+                        size_t kc = std::min(TILE_K, ci_count - k0);
+                        multiplyPanel(m + e * TILE_M * TILE_N, TILE_N, mb, nb, kc,
+                                      u + (e * co_count + c0) * ci_count + k0, ptrdiff_t(ci_count), ptrdiff_t(1),
+                                      v + (e * ci_count + k0) * nb);
+                    }
+                }
+
+                // output transform, bias and conversion to the output type
+                for (size_t i = 0; i < mb; ++i) {
+                    const float b = bias ? toFloat(bias[(c0 + i) * plan.b_stride]) : 0.0f;
+                    Tdata *y_c = y + batch * ys[0] + (c0 + i) * ys[1];
+                    for (size_t j = 0; j < nb; ++j) {
+                        float tile[WINOGRAD_TILE], out[4];
+                        for (size_t e = 0; e < WINOGRAD_TILE; ++e) {
+                            tile[e] = m[(e * TILE_M + i) * TILE_N + j];
+                        }
+                        winogradOutput(tile, out);
+                        size_t h0 = (t0 + j) / tiles_w * 2, w0 = (t0 + j) % tiles_w * 2;
+                        for (size_t r = 0; r < 2 && h0 + r < oh; ++r) {
+                            for (size_t c = 0; c < 2 && w0 + c < ow; ++c) {
+                                y_c[(h0 + r) * ys[2] + (w0 + c) * ys[3]] = utils::cast<Tdata>(out[r * 2 + c] + b);
+                            }
+                        }
+                    }
+                }
+            }
         }
     }
-    return INFINI_STATUS_SUCCESS;
 }
 
-template <>
-infiniStatus_t conv_cpu<fp16_t>(
+/**
+ * Depthwise convolution over rows of the last spatial dim: for every tap the range of outputs
+ * whose input lies inside x is computed up front, so the inner loop is branch-free and
+ * unit-stride when the convolution stride is 1.
+ */
+template <typename Tdata>
+void depthwiseChannelsFirst(
     const ConvInfo &info,
-    void *workspace,
-    size_t workspace_size,
-    void *y,
-    const void *x,
-    const void *w,
-    const void *bias) {
-    auto y_float = reinterpret_cast<float *>(workspace);
-    auto x_half = reinterpret_cast<const fp16_t *>(x);
-    auto w_half = reinterpret_cast<const fp16_t *>(w);
-    auto output_size = calculateOutputSize(info);
-    std::fill(y_float, y_float + output_size, 0.0f);
+    const ConvPlan &plan,
+    const float *w,
+    float *scratch_base,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *bias) {
+
+    const size_t ndim = info.ndim(), last = ndim - 1;
+    const size_t co_count = info.out_channels();
+    const size_t multiplier = co_count / info.in_channels();
+    const size_t row_len = info.output_dim(last);
+    const size_t rows = info.spatial_sizes() / row_len;
+    const size_t kw_count = info.kernel_dim(last);
+    const size_t k_outer = kernelSize(info) / kw_count;
+    const ptrdiff_t in_len = ptrdiff_t(info.input_dim(last));
+    const ptrdiff_t stride = info.stride_info(last);
+    const ptrdiff_t dilation = ptrdiff_t(info.dilation_info(last));
+    const ptrdiff_t pad = ptrdiff_t(info.pad_info(last));
+    const size_t scratch_size = threadScratchSize(info, plan);
+    const ptrdiff_t *xs = plan.x_strides.data(), *ys = plan.y_strides.data();
+
+#pragma omp parallel num_threads(teamSize(plan))
+    {
+        float *acc = scratch_base + op::common_cpu::getThreadId() * scratch_size;
+        std::vector<ptrdiff_t> coords(ndim);
+
+#pragma omp for schedule(static)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(info.batch() * co_count * rows); ++item) {
+            size_t row = size_t(item) % rows;
+            size_t c = size_t(item) / rows % co_count;
+            size_t batch = size_t(item) / rows / co_count;
+            for (size_t d = last; d-- > 0;) {
+                coords[d] = ptrdiff_t(row % info.output_dim(d));
+                row /= info.output_dim(d);
+            }
 
-    void *conv_workspace = y_float + output_size;
-    size_t conv_workspace_size = workspace_size - output_size * sizeof(float);
+            std::fill(acc, acc + row_len, 0.0f);
+            const Tdata *x_c = x + batch * xs[0] + c / multiplier * xs[1];
+            for (size_t ko = 0; ko < k_outer; ++ko) {
+                // input row of the tap in the leading spatial dims
+                ptrdiff_t offset = 0;
+                bool inside = true;
+                size_t kpos = ko;
+                for (size_t d = last; d-- > 0;) {
+                    ptrdiff_t i = coords[d] * info.stride_info(d)
+                                + ptrdiff_t(kpos % info.kernel_dim(d) * info.dilation_info(d))
+                                - ptrdiff_t(info.pad_info(d));
+                    kpos /= info.kernel_dim(d);
+                    inside &= i >= 0 && i < ptrdiff_t(info.input_dim(d));
+                    offset += i * xs[d + 2];
+                }
+                if (!inside) {
+                    continue;
+                }
 
-    _conv_cpu<fp16_t, float>(info, conv_workspace, conv_workspace_size, y_float, x_half, w_half);
+                for (size_t kw = 0; kw < kw_count; ++kw) {
+                    // input index of output o is o * stride + shift, keep it inside [0, in_len)
+                    ptrdiff_t shift = ptrdiff_t(kw) * dilation - pad;
+                    if (shift >= in_len) {
+                        break;
+                    }
+                    size_t lo = shift >= 0 ? 0 : size_t(CEIL_DIV(-shift, stride));
+                    size_t hi = std::min(row_len, size_t((in_len - 1 - shift) / stride + 1));
+                    const float wv = w[(ko * kw_count + kw) * co_count + c];
+                    const Tdata *src = x_c + offset;
+                    for (size_t o = lo; o < hi; ++o) {
+                        acc[o] += wv * toFloat(src[(ptrdiff_t(o) * stride + shift) * xs[last + 2]]);
+                    }
+                }
+            }
 
-    auto y_half = reinterpret_cast<fp16_t *>(y);
-    if (bias != nullptr) {
-        auto bias_half = reinterpret_cast<const fp16_t *>(bias);
-#pragma omp parallel for
-        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(output_size); ++i) {
-            size_t channel_idx = (i / info.spatial_sizes()) % info.out_channels();
-            float bias_value = utils::cast<float>(bias_half[channel_idx]);
-            y_float[i] += bias_value;
-            y_half[i] = utils::cast<fp16_t>(y_float[i]);
-        }
-    } else {
-#pragma omp parallel for
-        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(output_size); ++i) {
-            y_half[i] = utils::cast<fp16_t>(y_float[i]);
+            const float b = bias ? toFloat(bias[c * plan.b_stride]) : 0.0f;
+            Tdata *y_row = y + batch * ys[0] + c * ys[1];
+            for (size_t d = 0; d < last; ++d) {
+                y_row += coords[d] * ys[d + 2];
+            }
+            for (size_t o = 0; o < row_len; ++o) {
+                y_row[o * ys[last + 2]] = utils::cast<Tdata>(acc[o] + b);
+            }
         }
     }
+}
 
-    return INFINI_STATUS_SUCCESS;
+// Depthwise convolution of channel-contiguous tensors, vectorized over the channels of one position
+template <typename Tdata>
+void depthwiseChannelsLast(
+    const ConvInfo &info,
+    const ConvPlan &plan,
+    const float *w,
+    float *scratch_base,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *bias) {
+
+    const size_t ndim = info.ndim();
+    const size_t co_count = info.out_channels();
+    const size_t multiplier = co_count / info.in_channels();
+    const size_t positions = info.spatial_sizes();
+    const size_t kernel_size = kernelSize(info);
+    const size_t scratch_size = threadScratchSize(info, plan);
+    const ptrdiff_t *xs = plan.x_strides.data(), *ys = plan.y_strides.data();
+
+#pragma omp parallel num_threads(teamSize(plan))
+    {
+        float *acc = scratch_base + op::common_cpu::getThreadId() * scratch_size;
+        std::vector<ptrdiff_t> coords(ndim);
+
+#pragma omp for schedule(static)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(info.batch() * positions); ++item) {
+            size_t batch = size_t(item) / positions;
+            outputCoords(info, coords.data(), size_t(item) % positions, 1);
+
+            std::fill(acc, acc + co_count, 0.0f);
+            for (size_t kpos = 0; kpos < kernel_size; ++kpos) {
+                ptrdiff_t offset;
+                if (!inputOffset(info, xs, coords.data(), kpos, offset)) {
+                    continue;
+                }
+                const Tdata *src = x + batch * xs[0] + offset;
+                const float *w_k = w + kpos * co_count;
+                if (multiplier == 1) {
+                    for (size_t c = 0; c < co_count; ++c) {
+                        acc[c] += toFloat(src[c]) * w_k[c];
+                    }
+                } else {
+                    for (size_t c = 0; c < co_count; ++c) {
+                        acc[c] += toFloat(src[c / multiplier]) * w_k[c];
+                    }
+                }
+            }
+
+            Tdata *y_p = y + batch * ys[0];
+            for (size_t d = 0; d < ndim; ++d) {
+                y_p += coords[d] * ys[d + 2];
+            }
+            for (size_t c = 0; c < co_count; ++c) {
+                const float b = bias ? toFloat(bias[c * plan.b_stride]) : 0.0f;
+                y_p[c] = utils::cast<Tdata>(acc[c] + b);
+            }
+        }
+    }
 }
 
-template <>
-infiniStatus_t conv_cpu<bf16_t>(
+template <typename Tdata>
+void conv_cpu(
     const ConvInfo &info,
+    const ConvPlan &plan,
+    float *workspace,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *w,
+    const float *prepacked_w,
+    const Tdata *bias) {
+
+    const float *packed_w = prepacked_w;
+    float *scratch = workspace + packedWeightsSize(info, plan);
+    if (packed_w == nullptr) {
+        packWeights(info, plan, workspace, w);
+        packed_w = workspace;
+    }
+
+    bool channels_first = plan.layout == ConvLayout::CHANNELS_FIRST;
+    switch (plan.algo) {
+    case INFINIOP_CONV_ALGO_WINOGRAD:
+        convWinograd(info, plan, packed_w, scratch, y, x, bias);
+        break;
+    case INFINIOP_CONV_ALGO_DEPTHWISE:
+        if (channels_first) {
+            depthwiseChannelsFirst(info, plan, packed_w, scratch, y, x, bias);
+        } else {
+            depthwiseChannelsLast(info, plan, packed_w, scratch, y, x, bias);
+        }
+        break;
+    default:
+        if (channels_first) {
+            convChannelsFirst(info, plan, packed_w, scratch, y, x, bias);
+        } else {
+            convChannelsLast(info, plan, packed_w, scratch, y, x, bias);
+        }
+        break;
+    }
+}
+
+infiniStatus_t Descriptor::calculate(
     void *workspace,
     size_t workspace_size,
     void *y,
     const void *x,
     const void *w,
-    const void *bias) {
-    auto y_float = reinterpret_cast<float *>(workspace);
-    auto x_half = reinterpret_cast<const bf16_t *>(x);
-    auto w_half = reinterpret_cast<const bf16_t *>(w);
-    auto output_size = calculateOutputSize(info);
-    std::fill(y_float, y_float + output_size, 0.0f);
-
-    void *conv_workspace = y_float + output_size;
-    size_t conv_workspace_size = workspace_size - output_size * sizeof(float);
+    const void *bias,
+    void *stream) const {
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
 
-    _conv_cpu<bf16_t, float>(info, conv_workspace, conv_workspace_size, y_float, x_half, w_half);
+#define CALCULATE(TDATA)                                    \
+    conv_cpu<TDATA>(_info, _opaque->plan,                   \
+                    reinterpret_cast<float *>(workspace),   \
+                    reinterpret_cast<TDATA *>(y),           \
+                    reinterpret_cast<const TDATA *>(x),     \
+                    reinterpret_cast<const TDATA *>(w),     \
+                    nullptr,                                \
+                    reinterpret_cast<const TDATA *>(bias)); \
+    return INFINI_STATUS_SUCCESS
 
-    auto y_half = reinterpret_cast<bf16_t *>(y);
-    if (bias != nullptr) {
-        auto bias_half = reinterpret_cast<const bf16_t *>(bias);
-#pragma omp parallel for
-        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(output_size); ++i) {
-            size_t channel_idx = (i / info.spatial_sizes()) % info.out_channels();
-            float bias_value = utils::cast<float>(bias_half[channel_idx]);
-            y_float[i] += bias_value;
-            y_half[i] = utils::cast<bf16_t>(y_float[i]);
-        }
-    } else {
-#pragma omp parallel for
-        for (ptrdiff_t i = 0; i < static_cast<ptrdiff_t>(output_size); ++i) {
-            y_half[i] = utils::cast<bf16_t>(y_float[i]);
-        }
+    switch (_dtype) {
+    case INFINI_DTYPE_F16:
+        CALCULATE(fp16_t);
+    case INFINI_DTYPE_F32:
+        CALCULATE(float);
+    case INFINI_DTYPE_BF16:
+        CALCULATE(bf16_t);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
 
-    return INFINI_STATUS_SUCCESS;
+#undef CALCULATE
 }
 
-infiniStatus_t Descriptor::calculate(
+infiniStatus_t Descriptor::calculatePacked(
     void *workspace,
     size_t workspace_size,
     void *y,
     const void *x,
-    const void *w,
+    const float *packed_w,
     const void *bias,
     void *stream) const {
     if (workspace_size < _workspace_size) {
         return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
     }
+
+#define CALCULATE(TDATA)                                    \
+    conv_cpu<TDATA>(_info, _opaque->plan,                   \
+                    reinterpret_cast<float *>(workspace),   \
+                    reinterpret_cast<TDATA *>(y),           \
+                    reinterpret_cast<const TDATA *>(x),     \
+                    nullptr,                                \
+                    packed_w,                               \
+                    reinterpret_cast<const TDATA *>(bias)); \
+    return INFINI_STATUS_SUCCESS
+
+    switch (_dtype) {
+    case INFINI_DTYPE_F16:
+        CALCULATE(fp16_t);
+    case INFINI_DTYPE_F32:
+        CALCULATE(float);
+    case INFINI_DTYPE_BF16:
+        CALCULATE(bf16_t);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+#undef CALCULATE
+}
+
+infiniStatus_t Descriptor::packWeights(std::vector<float> &packed, const void *w) const {
+    packed.resize(packedWeightsSize(_info, _opaque->plan));
+
+#define PACK(TDATA)                                                                            \
+    cpu::packWeights(_info, _opaque->plan, packed.data(), reinterpret_cast<const TDATA *>(w)); \
+    return INFINI_STATUS_SUCCESS
+
     switch (_dtype) {
     case INFINI_DTYPE_F16:
-        return conv_cpu<fp16_t>(_info, workspace, workspace_size, y, x, w, bias);
+        PACK(fp16_t);
     case INFINI_DTYPE_F32:
-        return conv_cpu<float>(_info, workspace, workspace_size, y, x, w, bias);
+        PACK(float);
     case INFINI_DTYPE_BF16:
-        return conv_cpu<bf16_t>(_info, workspace, workspace_size, y, x, w, bias);
+        PACK(bf16_t);
     default:
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
+
+#undef PACK
 }
 
 } // namespace op::conv::cpu
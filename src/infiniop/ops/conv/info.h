@@ -22,6 +22,7 @@ private:
     size_t _batch;
     size_t _in_channels;
     size_t _out_channels;
+    size_t _groups;
     size_t _spatial_sizes;
     size_t _bias_dims_size;
     size_t _padded_shape_size;
@@ -31,6 +32,7 @@ private:
              size_t batch,
              size_t in_channels,
              size_t out_channels,
+             size_t groups,
              size_t spatial_sizes,
              size_t bias_dims_size,
              size_t padded_shape_size)
@@ -39,6 +41,7 @@ private:
           _batch(batch),
           _in_channels(in_channels),
           _out_channels(out_channels),
+          _groups(groups),
           _spatial_sizes(spatial_sizes),
           _bias_dims_size(bias_dims_size),
           _padded_shape_size(padded_shape_size) {}
@@ -48,6 +51,7 @@ public:
     inline size_t batch() const { return _batch; }
     inline size_t in_channels() const { return _in_channels; }
     inline size_t out_channels() const { return _out_channels; }
+    inline size_t groups() const { return _groups; }
     inline size_t spatial_sizes() const { return _spatial_sizes; }
     inline size_t bias_dims_size() const { return _bias_dims_size; }
     inline size_t padded_shape_size() const { return _padded_shape_size; }
@@ -118,7 +122,8 @@ public:
         const void *pads,
         const void *strides,
         const void *dilations,
-        size_t n);
+        size_t n,
+        size_t groups);
 };
 
 inline utils::Result<size_t> calculateConvOutputSize(
@@ -158,7 +163,8 @@ inline utils::Result<ConvInfo> ConvInfo::create(
     const void *pads,
     const void *strides,
     const void *dilations,
-    size_t n) {
+    size_t n,
+    size_t groups) {
 
     auto dtype = y_desc->dtype();
     if (dtype != x_desc->dtype() || dtype != w_desc->dtype()) {
@@ -176,7 +182,11 @@ inline utils::Result<ConvInfo> ConvInfo::create(
     size_t in_channels = x_desc->shape()[1];
     size_t out_channels = w_desc->shape()[0];
 
-    if (y_desc->shape()[0] != batch || y_desc->shape()[1] != out_channels || w_desc->shape()[1] != in_channels) {
+    // w holds in_channels / groups input channels per output channel
+    if (groups == 0 || in_channels % groups != 0 || out_channels % groups != 0) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    if (y_desc->shape()[0] != batch || y_desc->shape()[1] != out_channels || w_desc->shape()[1] != in_channels / groups) {
         return INFINI_STATUS_BAD_TENSOR_SHAPE;
     }
 
@@ -246,7 +256,7 @@ inline utils::Result<ConvInfo> ConvInfo::create(
         }
     }
 
-    ConvInfo info(std::move(meta), ndim, batch, in_channels, out_channels,
+    ConvInfo info(std::move(meta), ndim, batch, in_channels, out_channels, groups,
                   spatial_sizes, bias_dims_size, padded_shape_size);
 
     return utils::Result<ConvInfo>(info);
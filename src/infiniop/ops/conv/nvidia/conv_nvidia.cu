@@ -55,7 +55,7 @@ private:
         output_dims[0] = static_cast<int>(info.batch());
         output_dims[1] = static_cast<int>(info.out_channels());
         filter_dims[0] = static_cast<int>(info.out_channels());
-        filter_dims[1] = static_cast<int>(info.in_channels());
+        filter_dims[1] = static_cast<int>(info.in_channels() / info.groups());
 
         if (is_1d_conv) {
             input_dims[2] = 1;
@@ -185,6 +185,7 @@ private:
                                               const std::vector<int> &strides,
                                               const std::vector<int> &dilations,
                                               int spatial_ndim,
+                                              int groups,
                                               cudnnDataType_t compute_type) {
         CHECK_CUDNN(cudnnSetConvolutionNdDescriptor(
             conv_desc,
@@ -194,6 +195,7 @@ private:
             dilations.data(),
             CUDNN_CROSS_CORRELATION,
             compute_type));
+        CHECK_CUDNN(cudnnSetConvolutionGroupCount(conv_desc, groups));
 
         return INFINI_STATUS_SUCCESS;
     }
@@ -321,7 +323,8 @@ public:
         CHECK_STATUS(createBiasDescriptors(info, cudnn_data_type, actual_tensor_ndim));
 
         CHECK_STATUS(setupConvolutionDescriptor(pads_arr, strides_arr, dilations_arr,
-                                                spatial_ndim_for_conv_desc, compute_type));
+                                                spatial_ndim_for_conv_desc, static_cast<int>(info.groups()),
+                                                compute_type));
 
         if (info.bias_dims_size() == 0) {
             CHECK_STATUS(setupAlgorithmWithoutBias());
@@ -366,7 +369,8 @@ infiniStatus_t Descriptor::create(
     const void *pads,
     const void *strides,
     const void *dilations,
-    size_t n) {
+    size_t n,
+    size_t groups) {
 #ifdef ENABLE_CUDNN_API
     auto handle = reinterpret_cast<device::nvidia::Handle *>(handle_);
     auto dtype = y_desc->dtype();
@@ -374,7 +378,7 @@ infiniStatus_t Descriptor::create(
     CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_BF16);
 
     auto result = ConvInfo::create(handle_, y_desc, x_desc, w_desc, b_desc,
-                                   pads, strides, dilations, n);
+                                   pads, strides, dilations, n, groups);
 
     CHECK_RESULT(result);
     auto conv_info = result.take();
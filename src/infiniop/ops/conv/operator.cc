@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/conv.h"
 
 #ifdef ENABLE_CPU_API
@@ -18,7 +21,14 @@ __C __export infiniStatus_t infiniopCreateConvDescriptor(infiniopHandle_t handle
                                                          void *pads,
                                                          void *strides,
                                                          void *dilations,
-                                                         size_t n) {
+                                                         size_t n,
+                                                         size_t groups) {
+    INFINIOP_DESCRIPTOR_CACHE_WITH_KEY(op::descriptor_cache::Key()
+                                           .addArray(reinterpret_cast<const size_t *>(pads), n)
+                                           .addArray(reinterpret_cast<const ptrdiff_t *>(strides), n)
+                                           .addArray(reinterpret_cast<const size_t *>(dilations), n),
+                                       infiniopCreateConvDescriptor, infiniopDestroyConvDescriptor, handle, desc_ptr, y_desc, x_desc, w_desc, b_desc, pads, strides, dilations, n, groups);
+
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
         return op::conv::NAMESPACE::Descriptor::create(                     \
@@ -31,7 +41,8 @@ __C __export infiniStatus_t infiniopCreateConvDescriptor(infiniopHandle_t handle
             pads,                                                           \
             strides,                                                        \
             dilations,                                                      \
-            n)
+            n,                                                              \
+            groups)
     switch (handle->device) {
 #ifdef ENABLE_CPU_API
         CREATE(INFINI_DEVICE_CPU, cpu);
@@ -78,6 +89,64 @@ infiniopGetConvWorkspaceSize(
 #undef GET
 }
 
+__C infiniStatus_t
+infiniopGetConvAlgorithm(
+    infiniopConvDescriptor_t desc,
+    infiniopConvAlgo_t *algo) {
+
+#define GET(CASE, NAMESPACE)                                                                  \
+    case CASE:                                                                                \
+        *algo = reinterpret_cast<const op::conv::NAMESPACE::Descriptor *>(desc)->algorithm(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopCreateConvPackedWeights(
+    infiniopConvDescriptor_t desc,
+    infiniopConvPackedWeights_t *packed_ptr,
+    const void *w) {
+
+#define PACK(CASE, NAMESPACE)                                                                                        \
+    case CASE: {                                                                                                     \
+        auto packed = new InfiniopConvPackedWeights{desc, {}};                                                       \
+        auto status = reinterpret_cast<const op::conv::NAMESPACE::Descriptor *>(desc)->packWeights(packed->data, w); \
+        if (status != INFINI_STATUS_SUCCESS) {                                                                       \
+            delete packed;                                                                                           \
+            return status;                                                                                           \
+        }                                                                                                            \
+        *packed_ptr = packed;                                                                                        \
+        return INFINI_STATUS_SUCCESS;                                                                                \
+    }
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        PACK(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef PACK
+}
+
+__C infiniStatus_t infiniopDestroyConvPackedWeights(infiniopConvPackedWeights_t packed) {
+    delete packed;
+    return INFINI_STATUS_SUCCESS;
+}
+
 __C infiniStatus_t infiniopConv(
     infiniopConvDescriptor_t desc,
     void *workspace,
@@ -87,15 +156,18 @@ __C infiniStatus_t infiniopConv(
     const void *w,
     const void *bias,
     void *stream) {
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::conv::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size,                             \
-                        y,                                                     \
-                        x,                                                     \
-                        w,                                                     \
-                        bias,                                                  \
-                        stream)
+    INFINIOP_GRAPH_CAPTURE(infiniopConv, desc, workspace, workspace_size, y, x, w, bias, stream);
+    INFINIOP_TRACE(infiniopConv, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::conv::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                                 \
+                        y,                                                                         \
+                        x,                                                                         \
+                        w,                                                                         \
+                        bias,                                                                      \
+                        stream))
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
         CALCULATE(INFINI_DEVICE_CPU, cpu);
@@ -113,8 +185,47 @@ __C infiniStatus_t infiniopConv(
 #undef CALCULATE
 }
 
+__C infiniStatus_t infiniopConvPacked(
+    infiniopConvDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    infiniopConvPackedWeights_t packed_w,
+    const void *bias,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopConvPacked, desc, workspace, workspace_size, y, x, packed_w, bias, stream);
+    INFINIOP_TRACE(infiniopConvPacked, desc, workspace_size);
+
+    // packed for this descriptor, or for the same one served by the cache
+    CHECK_OR_RETURN(packed_w != nullptr, INFINI_STATUS_NULL_POINTER);
+    CHECK_OR_RETURN(packed_w->desc == desc, INFINI_STATUS_BAD_PARAM);
+    const float *packed = packed_w->data.data();
+
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::conv::NAMESPACE::Descriptor *>(desc) \
+            ->calculatePacked(workspace, workspace_size,                                           \
+                              y,                                                                   \
+                              x,                                                                   \
+                              packed,                                                              \
+                              bias,                                                                \
+                              stream))
+    switch (desc->device_type) {
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+#undef CALCULATE
+}
+
 __C infiniStatus_t
 infiniopDestroyConvDescriptor(infiniopConvDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
         delete reinterpret_cast<const op::conv::NAMESPACE::Descriptor *>(desc); \
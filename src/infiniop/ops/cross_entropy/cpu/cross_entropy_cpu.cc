@@ -0,0 +1,232 @@
+#include "cross_entropy_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../../reduce/cpu/softmax.h"
+#include <cmath>
+
+namespace op::cross_entropy::cpu {
+
+using namespace op::common_cpu::softmax_op;
+
+// softmax stats of a row plus the sum of its logits, which label smoothing needs
+struct RowStats {
+    Stats softmax;
+    float x_sum = 0;
+};
+
+inline RowStats merge(RowStats a, RowStats b) {
+    return {op::common_cpu::softmax_op::merge(a.softmax, b.softmax), a.x_sum + b.x_sum};
+}
+
+Descriptor::~Descriptor() = default;
+
+// the workspace holds the checked targets and the row losses when they are reduced, then the
+// partial stats when rows are split
+static size_t rowLossBytes(const CrossEntropyInfo &info) {
+    size_t bytes = info.rows * sizeof(int64_t);
+    if (info.reduction != INFINIOP_CROSS_ENTROPY_NONE) {
+        bytes += info.rows * sizeof(float);
+    }
+    return CEIL_DIV(bytes, alignof(RowStats)) * alignof(RowStats);
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t loss_desc,
+    infiniopTensorDescriptor_t grad_logits_desc,
+    infiniopTensorDescriptor_t logits_desc,
+    infiniopTensorDescriptor_t target_desc,
+    infiniopCrossEntropyReduction_t reduction,
+    int64_t ignore_index,
+    float label_smoothing) {
+
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = CrossEntropyInfo::create(loss_desc, grad_logits_desc, logits_desc, target_desc,
+                                           reduction, ignore_index, label_smoothing);
+    CHECK_RESULT(result);
+    auto info = result.take();
+
+    size_t parts = splitCount(info.rows, info.classes);
+    size_t workspace_size = rowLossBytes(info);
+    if (parts > 1) {
+        workspace_size += info.rows * parts * sizeof(RowStats);
+    }
+
+    *desc_ptr = new Descriptor(
+        std::move(info),
+        parts,
+        workspace_size,
+        handle->device,
+        handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+/**
+ * grad = scale * (softmax(x) - q) over a range of a row, where the target distribution q is
+ * `smooth` on every class plus `on_target` on the class at `target` (relative to the range,
+ * so it may lie outside of it).
+ */
+template <typename T>
+void writeGrad(T *g, ptrdiff_t g_stride, const T *x, ptrdiff_t x_stride, size_t len, Stats s,
+               int64_t target, float scale, float smooth, float on_target) {
+    float buf[SOFTMAX_BLOCK];
+    float inv = scale / s.sum;
+    float shift = scale * smooth;
+    for (size_t j = 0; j < len; j += SOFTMAX_BLOCK) {
+        size_t n = std::min(SOFTMAX_BLOCK, len - j);
+        loadBlock(buf, x + ptrdiff_t(j) * x_stride, n, x_stride);
+#pragma omp simd
+        for (size_t k = 0; k < n; ++k) {
+            buf[k] = expApprox(buf[k] - s.max) * inv - shift;
+        }
+        if (target >= int64_t(j) && target < int64_t(j + n)) {
+            buf[target - int64_t(j)] -= scale * on_target;
+        }
+        storeBlock(g + ptrdiff_t(j) * g_stride, buf, n, g_stride);
+    }
+}
+
+template <typename T, typename Tt>
+infiniStatus_t crossEntropy(const CrossEntropyInfo &info, size_t parts, void *workspace,
+                            T *loss, T *grad, const T *logits, const Tt *target) {
+    const size_t rows = info.rows;
+    const size_t classes = info.classes;
+    const ptrdiff_t xs = info.logits_class_stride;
+    const ptrdiff_t gs = info.grad_class_stride;
+
+    auto offset = [&info](size_t row, const std::vector<ptrdiff_t> &strides) {
+        return ptrdiff_t(op::common_cpu::indexToOffset(row, info.batch_shape.size(), info.batch_shape.data(), strides.data()));
+    };
+
+    const bool parallel = rows * classes >= SOFTMAX_PARALLEL_MIN;
+    int64_t *targets = reinterpret_cast<int64_t *>(workspace);
+
+    // targets are checked before anything is written, ignored rows get -1
+    size_t count = 0, invalid = 0;
+#pragma omp parallel for schedule(static) reduction(+ : count, invalid) if (parallel)
+    for (ptrdiff_t row = 0; row < ptrdiff_t(rows); ++row) {
+        int64_t t = int64_t(target[offset(size_t(row), info.target_strides)]);
+        if (t == info.ignore_index) {
+            t = -1;
+        } else if (t < 0 || t >= int64_t(classes)) {
+            ++invalid;
+        } else {
+            ++count;
+        }
+        targets[row] = t;
+    }
+    if (invalid > 0) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    const bool reduced = info.reduction != INFINIOP_CROSS_ENTROPY_NONE;
+    const float eps = info.label_smoothing;
+    const float smooth = eps / float(classes);
+    const float on_target = 1.0f - eps;
+    const float scale = info.reduction == INFINIOP_CROSS_ENTROPY_MEAN && count > 0 ? 1.0f / float(count) : 1.0f;
+
+    float *row_loss = reinterpret_cast<float *>(targets + rows);
+    auto partial = reinterpret_cast<RowStats *>(reinterpret_cast<char *>(workspace) + rowLossBytes(info));
+
+    rowwise(
+        rows, parts, parallel, partial,
+        [&](size_t row, size_t part) {
+            RowStats s;
+            if (targets[row] >= 0) {
+                auto [begin, end] = partRange(classes, part, parts);
+                const T *x = logits + offset(row, info.logits_strides) + ptrdiff_t(begin) * xs;
+                s.softmax = stats(x, end - begin, xs, eps > 0 ? &s.x_sum : nullptr);
+            }
+            return s;
+        },
+        [&](size_t row, size_t part, RowStats s) {
+            int64_t t = targets[row];
+            auto [begin, end] = partRange(classes, part, parts);
+
+            if (part == 0) {
+                float l = 0;
+                if (t >= 0) {
+                    const T *x = logits + offset(row, info.logits_strides);
+                    // -sum(q * log_softmax(x)) with the weights of q summing to 1
+                    l = s.softmax.max + std::log(s.softmax.sum) - on_target * utils::cast<float>(x[t * xs]);
+                    if (eps > 0) {
+                        l -= smooth * s.x_sum;
+                    }
+                }
+                if (reduced) {
+                    row_loss[row] = l;
+                } else {
+                    loss[offset(row, info.loss_strides)] = utils::cast<T>(l);
+                }
+            }
+
+            if (info.has_grad) {
+                T *g = grad + offset(row, info.grad_strides) + ptrdiff_t(begin) * gs;
+                if (t < 0) {
+                    for (size_t j = 0; j < end - begin; ++j) {
+                        g[ptrdiff_t(j) * gs] = utils::cast<T>(0.0f);
+                    }
+                } else {
+                    const T *x = logits + offset(row, info.logits_strides) + ptrdiff_t(begin) * xs;
+                    writeGrad(g, gs, x, xs, end - begin, s.softmax, t - int64_t(begin), scale, smooth, on_target);
+                }
+            }
+        });
+
+    if (reduced) {
+        double sum = 0;
+        for (size_t row = 0; row < rows; ++row) {
+            sum += row_loss[row];
+        }
+        // the mean over no rows is NaN
+        if (info.reduction == INFINIOP_CROSS_ENTROPY_MEAN) {
+            sum /= double(count);
+        }
+        *loss = utils::cast<T>(float(sum));
+    }
+    return INFINI_STATUS_SUCCESS;
+}
+
+template <typename T>
+infiniStatus_t crossEntropy(const CrossEntropyInfo &info, size_t parts, void *workspace,
+                            void *loss, void *grad, const void *logits, const void *target) {
+    switch (info.target_dtype) {
+    case INFINI_DTYPE_I32:
+        return crossEntropy(info, parts, workspace, (T *)loss, (T *)grad, (const T *)logits, (const int32_t *)target);
+    case INFINI_DTYPE_I64:
+        return crossEntropy(info, parts, workspace, (T *)loss, (T *)grad, (const T *)logits, (const int64_t *)target);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *loss,
+    void *grad_logits,
+    const void *logits,
+    const void *target,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    if (_info.has_grad && grad_logits == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        return crossEntropy<fp16_t>(_info, _parts, workspace, loss, grad_logits, logits, target);
+    case INFINI_DTYPE_BF16:
+        return crossEntropy<bf16_t>(_info, _parts, workspace, loss, grad_logits, logits, target);
+    case INFINI_DTYPE_F32:
+        return crossEntropy<float>(_info, _parts, workspace, loss, grad_logits, logits, target);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::cross_entropy::cpu
@@ -0,0 +1,55 @@
+#ifndef __CROSS_ENTROPY_CPU_H__
+#define __CROSS_ENTROPY_CPU_H__
+
+#include "../../../devices/cpu/cpu_handle.h"
+#include "../../../operator.h"
+#include "../info.h"
+
+namespace op::cross_entropy::cpu {
+
+class Descriptor : public InfiniopDescriptor {
+    CrossEntropyInfo _info;
+    // number of ranges each row is split into
+    size_t _parts;
+    size_t _workspace_size;
+
+    Descriptor(
+        CrossEntropyInfo info,
+        size_t parts,
+        size_t workspace_size,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _info(std::move(info)),
+          _parts(parts),
+          _workspace_size(workspace_size) {}
+
+public:
+    ~Descriptor();
+
+    static infiniStatus_t create(
+        infiniopHandle_t handle,
+        Descriptor **desc_ptr,
+        infiniopTensorDescriptor_t loss_desc,
+        infiniopTensorDescriptor_t grad_logits_desc,
+        infiniopTensorDescriptor_t logits_desc,
+        infiniopTensorDescriptor_t target_desc,
+        infiniopCrossEntropyReduction_t reduction,
+        int64_t ignore_index,
+        float label_smoothing);
+
+    size_t workspaceSize() const { return _workspace_size; }
+
+    infiniStatus_t calculate(
+        void *workspace,
+        size_t workspace_size,
+        void *loss,
+        void *grad_logits,
+        const void *logits,
+        const void *target,
+        void *stream) const;
+};
+
+} // namespace op::cross_entropy::cpu
+
+#endif // __CROSS_ENTROPY_CPU_H__
@@ -0,0 +1,97 @@
+#ifndef __CROSS_ENTROPY_INFO_H__
+#define __CROSS_ENTROPY_INFO_H__
+
+#include "../../../utils.h"
+#include "../../tensor.h"
+#include "infiniop/ops/cross_entropy.h"
+#include <vector>
+
+namespace op::cross_entropy {
+
+/**
+ * Logits (..., C) are walked as `rows` rows of `classes` elements, a row being addressed
+ * through `batch_shape` (the leading dimensions) and the matching strides of each tensor.
+ */
+class CrossEntropyInfo {
+    CrossEntropyInfo() = default;
+
+public:
+    infiniDtype_t dtype;
+    infiniDtype_t target_dtype;
+    infiniopCrossEntropyReduction_t reduction;
+    int64_t ignore_index;
+    float label_smoothing;
+    bool has_grad;
+
+    size_t rows;
+    size_t classes;
+
+    std::vector<size_t> batch_shape;
+    std::vector<ptrdiff_t> logits_strides, grad_strides, target_strides, loss_strides;
+    ptrdiff_t logits_class_stride, grad_class_stride;
+
+    static utils::Result<CrossEntropyInfo> create(
+        infiniopTensorDescriptor_t loss_desc,
+        infiniopTensorDescriptor_t grad_desc,
+        infiniopTensorDescriptor_t logits_desc,
+        infiniopTensorDescriptor_t target_desc,
+        infiniopCrossEntropyReduction_t reduction,
+        int64_t ignore_index,
+        float label_smoothing) {
+
+        auto dtype = logits_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        CHECK_DTYPE(target_desc->dtype(), INFINI_DTYPE_I32, INFINI_DTYPE_I64);
+        CHECK_OR_RETURN(loss_desc->dtype() == dtype, INFINI_STATUS_BAD_TENSOR_DTYPE);
+        CHECK_OR_RETURN(reduction >= INFINIOP_CROSS_ENTROPY_NONE && reduction <= INFINIOP_CROSS_ENTROPY_SUM,
+                        INFINI_STATUS_BAD_PARAM);
+        CHECK_OR_RETURN(label_smoothing >= 0.0f && label_smoothing <= 1.0f, INFINI_STATUS_BAD_PARAM);
+
+        size_t ndim = logits_desc->ndim();
+        CHECK_OR_RETURN(ndim >= 1 && logits_desc->dim(ndim - 1) > 0, INFINI_STATUS_BAD_TENSOR_SHAPE);
+        auto logits_shape = logits_desc->shape();
+        std::vector<size_t> batch_shape(logits_shape.begin(), logits_shape.end() - 1);
+        CHECK_SAME_SHAPE(target_desc->shape(), batch_shape);
+
+        if (reduction == INFINIOP_CROSS_ENTROPY_NONE) {
+            CHECK_SAME_SHAPE(loss_desc->shape(), batch_shape);
+        } else {
+            CHECK_OR_RETURN(loss_desc->numel() == 1, INFINI_STATUS_BAD_TENSOR_SHAPE);
+        }
+
+        CrossEntropyInfo info;
+        info.dtype = dtype;
+        info.target_dtype = target_desc->dtype();
+        info.reduction = reduction;
+        info.ignore_index = ignore_index;
+        info.label_smoothing = label_smoothing;
+        info.has_grad = grad_desc != nullptr;
+        info.rows = target_desc->numel();
+        info.classes = logits_shape.back();
+        info.batch_shape = batch_shape;
+
+        auto logits_strides = logits_desc->strides();
+        info.logits_strides.assign(logits_strides.begin(), logits_strides.end() - 1);
+        info.logits_class_stride = logits_strides.back();
+        info.target_strides = target_desc->strides();
+        if (reduction == INFINIOP_CROSS_ENTROPY_NONE) {
+            info.loss_strides = loss_desc->strides();
+        }
+
+        if (info.has_grad) {
+            CHECK_OR_RETURN(grad_desc->dtype() == dtype, INFINI_STATUS_BAD_TENSOR_DTYPE);
+            CHECK_SAME_SHAPE(grad_desc->shape(), logits_shape);
+            auto grad_strides = grad_desc->strides();
+            info.grad_strides.assign(grad_strides.begin(), grad_strides.end() - 1);
+            info.grad_class_stride = grad_strides.back();
+        } else {
+            info.grad_class_stride = 0;
+        }
+
+        return utils::Result<CrossEntropyInfo>(info);
+    }
+};
+
+} // namespace op::cross_entropy
+
+#endif // __CROSS_ENTROPY_INFO_H__
@@ -0,0 +1,119 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
+#include "infiniop/ops/cross_entropy.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/cross_entropy_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateCrossEntropyDescriptor(
+    infiniopHandle_t handle,
+    infiniopCrossEntropyDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t loss_desc,
+    infiniopTensorDescriptor_t grad_logits_desc,
+    infiniopTensorDescriptor_t logits_desc,
+    infiniopTensorDescriptor_t target_desc,
+    infiniopCrossEntropyReduction_t reduction,
+    int64_t ignore_index,
+    float label_smoothing) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateCrossEntropyDescriptor, infiniopDestroyCrossEntropyDescriptor, handle, desc_ptr, loss_desc, grad_logits_desc, logits_desc, target_desc, reduction, ignore_index, label_smoothing);
+
+#define CREATE(CASE, NAMESPACE)                                                      \
+    case CASE:                                                                       \
+        return op::cross_entropy::NAMESPACE::Descriptor::create(                     \
+            handle,                                                                  \
+            reinterpret_cast<op::cross_entropy::NAMESPACE::Descriptor **>(desc_ptr), \
+            loss_desc,                                                               \
+            grad_logits_desc,                                                        \
+            logits_desc,                                                             \
+            target_desc,                                                             \
+            reduction,                                                               \
+            ignore_index,                                                            \
+            label_smoothing)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetCrossEntropyWorkspaceSize(infiniopCrossEntropyDescriptor_t desc, size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                         \
+    case CASE:                                                                                       \
+        *size = reinterpret_cast<op::cross_entropy::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopCrossEntropy(
+    infiniopCrossEntropyDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *loss,
+    void *grad_logits,
+    const void *logits,
+    const void *target,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopCrossEntropy, desc, workspace, workspace_size, loss, grad_logits, logits, target, stream);
+    INFINIOP_TRACE(infiniopCrossEntropy, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                          \
+    case CASE:                                                                                              \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::cross_entropy::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, loss, grad_logits, logits, target, stream))
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t infiniopDestroyCrossEntropyDescriptor(infiniopCrossEntropyDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
+#define DELETE(CASE, NAMESPACE)                                                          \
+    case CASE:                                                                           \
+        delete reinterpret_cast<const op::cross_entropy::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/crossentropyloss_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -24,6 +27,7 @@ __C infiniStatus_t infiniopCreateCrossEntropyLossBackwardDescriptor(
     infiniopTensorDescriptor_t grad_logits_desc,
     infiniopTensorDescriptor_t probs_desc,
     infiniopTensorDescriptor_t target_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateCrossEntropyLossBackwardDescriptor, infiniopDestroyCrossEntropyLossBackwardDescriptor, handle, desc_ptr, grad_logits_desc, probs_desc, target_desc);
 
 #define CREATE(CASE, NAMESPACE)                                                                     \
     case CASE:                                                                                      \
@@ -106,11 +110,13 @@ __C infiniStatus_t infiniopCrossEntropyLossBackward(
     const void *probs,
     const void *target,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopCrossEntropyLossBackward, desc, workspace, workspace_size, grad_logits, probs, target, stream);
+    INFINIOP_TRACE(infiniopCrossEntropyLossBackward, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                                  \
-    case CASE:                                                                                      \
-        return reinterpret_cast<op::crossentropyloss_backward::NAMESPACE::Descriptor *>(desc)      \
-            ->calculate(workspace, workspace_size, grad_logits, {probs, target}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                \
+    case CASE:                                                                                                    \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::crossentropyloss_backward::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, grad_logits, {probs, target}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -143,6 +149,8 @@ __C infiniStatus_t infiniopCrossEntropyLossBackward(
 
 __C infiniStatus_t
 infiniopDestroyCrossEntropyLossBackwardDescriptor(infiniopCrossEntropyLossBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DESTROY(CASE, NAMESPACE)                                                                    \
     case CASE:                                                                                      \
         delete reinterpret_cast<op::crossentropyloss_backward::NAMESPACE::Descriptor *>(desc);     \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/div.h"
 
 #ifdef ENABLE_CPU_API
@@ -24,6 +27,7 @@ __C infiniStatus_t infiniopCreateDivDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateDivDescriptor, infiniopDestroyDivDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -106,11 +110,13 @@ __C infiniStatus_t infiniopDiv(
     const void *a,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopDiv, desc, workspace, workspace_size, c, a, b, stream);
+    INFINIOP_TRACE(infiniopDiv, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                          \
-    case CASE:                                                              \
-        return reinterpret_cast<op::div::NAMESPACE::Descriptor *>(desc)     \
-            ->calculate(workspace, workspace_size, c, {a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                          \
+    case CASE:                                                                              \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::div::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, c, {a, b}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -143,6 +149,8 @@ __C infiniStatus_t infiniopDiv(
 
 __C infiniStatus_t
 infiniopDestroyDivDescriptor(infiniopDivDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DESTROY(CASE, NAMESPACE)                                            \
     case CASE:                                                              \
         delete reinterpret_cast<op::div::NAMESPACE::Descriptor *>(desc);    \
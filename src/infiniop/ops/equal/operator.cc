@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/equal.h"
 
 #ifdef ENABLE_CPU_API
@@ -25,6 +28,7 @@ __C infiniStatus_t infiniopCreateEqualDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateEqualDescriptor, infiniopDestroyEqualDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                              \
     case CASE:                                                               \
@@ -107,11 +111,13 @@ __C infiniStatus_t infiniopEqual(
     const void *a,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopEqual, desc, workspace, workspace_size, c, a, b, stream);
+    INFINIOP_TRACE(infiniopEqual, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                         \
-    case CASE:                                                             \
-        return reinterpret_cast<op::equal::NAMESPACE::Descriptor *>(desc)  \
-            ->calculate(workspace, workspace_size, c, {a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                            \
+    case CASE:                                                                                \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::equal::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, c, {a, b}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -143,6 +149,7 @@ __C infiniStatus_t infiniopEqual(
 
 __C infiniStatus_t
 infiniopDestroyEqualDescriptor(infiniopEqualDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
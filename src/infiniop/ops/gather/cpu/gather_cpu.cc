@@ -1,72 +1,15 @@
 #include "gather_cpu.h"
-#include "../../../../utils.h"
-#include "../../../tensor.h"
+#include "../../../devices/cpu/common_cpu.h"
 #include <cstring>
-#include <omp.h>
 
 namespace op::gather::cpu {
 
-template<typename T, typename IndexT>
-static infiniStatus_t calculate_gather(
-    const std::vector<size_t> &output_shape,
-    const std::vector<size_t> &input_shape,
-    const std::vector<ptrdiff_t> &output_strides,
-    const std::vector<ptrdiff_t> &input_strides,
-    const std::vector<ptrdiff_t> &index_strides,
-    size_t dim,
-    T * output,
-    const T * input,
-    const IndexT * index
-) {
-
-    size_t total_elements = 1;
-    for (size_t d = 0; d < output_shape.size(); d++) {
-        total_elements *= output_shape[d];
-    }
-    
-    //Use serial processing to avoid problems that may be caused by parallelization
-    for(size_t linear_idx = 0; linear_idx < total_elements; linear_idx++) {
-        
-        // Convert a linear index to multi-dimensional coordinates
-        std::vector<size_t> coords(output_shape.size());
-        size_t temp_idx = linear_idx;
-        for (int d = output_shape.size() - 1; d >= 0; d--) {
-            coords[d] = temp_idx % output_shape[d];
-            temp_idx /= output_shape[d];
-        }
-        
-        size_t output_offset = 0;
-        for (size_t d = 0; d < output_shape.size(); d++) {
-            output_offset += coords[d] * output_strides[d];
-        }
-        
-        size_t index_offset = 0;
-        for (size_t d = 0; d < output_shape.size(); d++) {
-            index_offset += coords[d] * index_strides[d];
-        }
-        
-        // Obtain the index value and perform boundary checks
-        IndexT gather_index = *((const IndexT*)((const char*)index + index_offset));
-        if (gather_index < 0 || gather_index >= static_cast<IndexT>(input_shape[dim])) {
-            return INFINI_STATUS_BAD_PARAM; 
-        }
-        
-        // Calculate the input offset - For the gather operation, 
-        // use gather_index in the dim dimension and output coordinates in other dimensions.
-        size_t input_offset = 0;
-        for (size_t d = 0; d < input_shape.size(); d++) {
-            if (d == dim) {
-                input_offset += gather_index * input_strides[d];
-            } else {
-                input_offset += coords[d] * input_strides[d];
-            }
-        }
-        
-        std::memcpy((char*)output + output_offset, (const char*)input + input_offset, sizeof(T));
-    }
-    
-    return INFINI_STATUS_SUCCESS;
-}
+// elements copied by one work item
+constexpr size_t GATHER_GRAIN = 4096;
+// gathers of fewer elements run on the calling thread
+constexpr size_t GATHER_PARALLEL_MIN = 16384;
+// indices looked ahead when prefetching table rows
+constexpr size_t PREFETCH_DISTANCE = 4;
 
 Descriptor::~Descriptor() = default;
 
@@ -79,72 +22,111 @@ infiniStatus_t Descriptor::create(
     infiniopTensorDescriptor_t index_desc) {
 
     auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
-    auto dtype = input_desc->dtype();
-
-    CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_F64, INFINI_DTYPE_BF16,
-                INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
-                INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
-                INFINI_DTYPE_BOOL);
 
-    // Check that input and output have same dtype
-    if (input_desc->dtype() != output_desc->dtype()) {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
-    }
+    auto info = GatherInfo::create(input_desc, output_desc, dim, index_desc);
+    CHECK_RESULT(info);
 
-    // Check that index is integer type
-    auto index_dtype = index_desc->dtype();
-    if (index_dtype != INFINI_DTYPE_I32 && index_dtype != INFINI_DTYPE_I64) {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
-    }
+    *desc_ptr = new Descriptor(
+        info.take(),
+        handle->device,
+        handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
 
-    // Check dimension bounds
-    auto input_shape = input_desc->shape();
-    auto output_shape = output_desc->shape();
-    auto index_shape = index_desc->shape();
-    
-    if (dim < 0 || dim >= static_cast<int>(input_shape.size())) {
-        return INFINI_STATUS_BAD_PARAM;
-    }
+inline void prefetch(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr);
+#endif
+}
 
-    // Check that input, output and index have same number of dimensions
-    if (input_shape.size() != output_shape.size() || input_shape.size() != index_shape.size()) {
-        return INFINI_STATUS_BAD_TENSOR_SHAPE;
+template <typename Tout, typename Tin>
+inline void copyRow(Tout *dst, const Tin *src, size_t len) {
+    if constexpr (std::is_same_v<Tout, Tin>) {
+        std::memcpy(dst, src, len * sizeof(Tin));
+    } else {
+        for (size_t i = 0; i < len; ++i) {
+            dst[i] = utils::cast<Tout>(src[i]);
+        }
     }
+}
 
-    // Check that output shape equals index shape (torch.gather requirement)
-    for (size_t i = 0; i < output_shape.size(); ++i) {
-        if (output_shape[i] != index_shape[i]) {
-            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+template <typename Tout, typename Tin, typename Tindex>
+infiniStatus_t gather(const GatherInfo &info, Tout *output, const Tin *input, const Tindex *index) {
+    const size_t block = std::max<size_t>(1, GATHER_GRAIN / info.row_len);
+    const size_t blocks = CEIL_DIV(info.inner_len, block);
+    const size_t outer_ndim = info.outer_shape.size();
+    const ptrdiff_t items = ptrdiff_t(info.outer() * blocks);
+    const ptrdiff_t dim_size = ptrdiff_t(info.dim_size);
+    const bool parallel = info.outer() * info.inner_len * info.row_len >= GATHER_PARALLEL_MIN;
+    bool out_of_range = false;
+
+#pragma omp parallel for schedule(static) reduction(|| : out_of_range) if (parallel)
+    for (ptrdiff_t item = 0; item < items; ++item) {
+        size_t k_begin = size_t(item) % blocks * block;
+        size_t k_end = std::min(info.inner_len, k_begin + block);
+        size_t outer = size_t(item) / blocks;
+
+        ptrdiff_t out_offset = 0, index_offset = 0, input_offset = 0;
+        for (size_t d = outer_ndim; d-- > 0;) {
+            ptrdiff_t coord = ptrdiff_t(outer % info.outer_shape[d]);
+            outer /= info.outer_shape[d];
+            out_offset += coord * info.outer_out_strides[d];
+            index_offset += coord * info.outer_index_strides[d];
+            input_offset += coord * info.outer_input_strides[d];
         }
-    }
 
-    // Check that all dimensions except dim have same size between input and index
-    for (size_t i = 0; i < input_shape.size(); ++i) {
-        if (i != static_cast<size_t>(dim) && input_shape[i] != index_shape[i]) {
-            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        Tout *out = output + out_offset + ptrdiff_t(k_begin) * info.out_stride_inner;
+        const Tindex *idx = index + index_offset + ptrdiff_t(k_begin) * info.index_stride_inner;
+        const Tin *in = input + input_offset + ptrdiff_t(k_begin) * info.input_stride_inner;
+
+        if (info.rowGather()) {
+            // embedding lookup: every index selects a row, fetched a few indices ahead
+            for (size_t k = k_begin; k < k_end; ++k) {
+                if (k + PREFETCH_DISTANCE < k_end) {
+                    ptrdiff_t ahead = ptrdiff_t(idx[ptrdiff_t(PREFETCH_DISTANCE) * info.index_stride_inner]);
+                    if (ahead >= 0 && ahead < dim_size) {
+                        prefetch(in + ptrdiff_t(PREFETCH_DISTANCE) * info.input_stride_inner + ahead * info.input_stride_dim);
+                    }
+                }
+                ptrdiff_t i = ptrdiff_t(*idx);
+                if (i >= 0 && i < dim_size) {
+                    copyRow(out, in + i * info.input_stride_dim, info.row_len);
+                } else {
+                    out_of_range = true;
+                }
+                out += info.out_stride_inner;
+                idx += info.index_stride_inner;
+                in += info.input_stride_inner;
+            }
+        } else {
+            for (size_t k = k_begin; k < k_end; ++k) {
+                ptrdiff_t i = ptrdiff_t(*idx);
+                if (i >= 0 && i < dim_size) {
+                    *out = utils::cast<Tout>(in[i * info.input_stride_dim]);
+                } else {
+                    out_of_range = true;
+                }
+                out += info.out_stride_inner;
+                idx += info.index_stride_inner;
+                in += info.input_stride_inner;
+            }
         }
     }
 
-    auto desc = new Descriptor();
-    desc->_input_desc = input_desc;
-    desc->_output_desc = output_desc;
-    desc->_index_desc = index_desc;
-    desc->_dim = dim;
-    desc->_input_shape = input_shape;
-    desc->_output_shape = output_shape;
-    desc->_input_strides = input_desc->getByteStrides();
-    desc->_output_strides = output_desc->getByteStrides();
-    desc->_index_strides = index_desc->getByteStrides(); // 改为使用字节strides保持一致
-    desc->_dtype = input_desc->dtype();
-    desc->_index_dtype = index_desc->dtype();
-    desc->_handle = handle;
-    desc->device_type = INFINI_DEVICE_CPU;
-    desc->device_id = handle->device_id;
-
-    *desc_ptr = desc;
-    return INFINI_STATUS_SUCCESS;
+    return out_of_range ? INFINI_STATUS_BAD_PARAM : INFINI_STATUS_SUCCESS;
 }
 
+template <typename Tout, typename Tin>
+infiniStatus_t gatherIndexType(const GatherInfo &info, void *output, const void *input, const void *index) {
+    switch (info.index_dtype) {
+    case INFINI_DTYPE_I32:
+        return gather(info, (Tout *)output, (const Tin *)input, (const int32_t *)index);
+    case INFINI_DTYPE_I64:
+        return gather(info, (Tout *)output, (const Tin *)input, (const int64_t *)index);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
 
 infiniStatus_t Descriptor::calculate(
     void *workspace,
@@ -154,269 +136,31 @@ infiniStatus_t Descriptor::calculate(
     const void *index,
     void *stream) const {
 
-    auto output_shape = _output_shape;
-    auto input_shape = _input_shape;
-    auto index_shape = _index_desc->shape();
-    auto input_strides = _input_strides;
-    auto output_strides = _output_strides;
-    auto index_strides = _index_strides;
-    auto dtype = _dtype;
-    auto index_dtype = _index_dtype;
-    
-    size_t output_size = 1;
-    for (size_t d = 0; d < output_shape.size(); d++) {
-        output_size *= output_shape[d];
+    if (_info.out_dtype != _info.dtype) {
+        // dequantize a half-precision table to f32
+        switch (_info.dtype) {
+        case INFINI_DTYPE_F16:
+            return gatherIndexType<float, fp16_t>(_info, output, input, index);
+        case INFINI_DTYPE_BF16:
+            return gatherIndexType<float, bf16_t>(_info, output, input, index);
+        default:
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
     }
 
-    if (index_dtype == INFINI_DTYPE_I32) {
-        switch (dtype) {
-            case INFINI_DTYPE_F16:
-                return calculate_gather<fp16_t, int32_t>(
-                     output_shape, input_shape,
-                     output_strides, input_strides, index_strides,
-                     static_cast<size_t>(_dim),
-                     static_cast<fp16_t*>(output),
-                     static_cast<const fp16_t*>(input),
-                     static_cast<const int32_t*>(index));
-                break;
-            case INFINI_DTYPE_F32:
-                return calculate_gather<float, int32_t>(
-                     output_shape, input_shape,
-                     output_strides, input_strides, index_strides,
-                     static_cast<size_t>(_dim),
-                     static_cast<float*>(output),
-                     static_cast<const float*>(input),
-                     static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_F64:
-                 return calculate_gather<double, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<double*>(output),
-                      static_cast<const double*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_BF16:
-                 return calculate_gather<bf16_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<bf16_t*>(output),
-                      static_cast<const bf16_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_I8:
-                 return calculate_gather<int8_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int8_t*>(output),
-                      static_cast<const int8_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_I16:
-                 return calculate_gather<int16_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int16_t*>(output),
-                      static_cast<const int16_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_I32:
-                 return calculate_gather<int32_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int32_t*>(output),
-                      static_cast<const int32_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_I64:
-                 return calculate_gather<int64_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int64_t*>(output),
-                      static_cast<const int64_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_U8:
-                 return calculate_gather<uint8_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint8_t*>(output),
-                      static_cast<const uint8_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_U16:
-                 return calculate_gather<uint16_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint16_t*>(output),
-                      static_cast<const uint16_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_U32:
-                 return calculate_gather<uint32_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint32_t*>(output),
-                      static_cast<const uint32_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_U64:
-                 return calculate_gather<uint64_t, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint64_t*>(output),
-                      static_cast<const uint64_t*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-             case INFINI_DTYPE_BOOL:
-                 return calculate_gather<bool, int32_t>(
-                      output_shape, input_shape,
-                      output_strides, input_strides, index_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<bool*>(output),
-                      static_cast<const bool*>(input),
-                      static_cast<const int32_t*>(index));
-                 break;
-            default:
-                return INFINI_STATUS_BAD_TENSOR_DTYPE;
-        }
-    } else if (index_dtype == INFINI_DTYPE_I64) {
-        switch (dtype) {
-            case INFINI_DTYPE_F16:
-                return calculate_gather<fp16_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<fp16_t*>(output),
-                    static_cast<const fp16_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_F32:
-                return calculate_gather<float, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<float*>(output),
-                    static_cast<const float*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_F64:
-                return calculate_gather<double, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<double*>(output),
-                    static_cast<const double*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_BF16:
-                return calculate_gather<bf16_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<bf16_t*>(output),
-                    static_cast<const bf16_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_I8:
-                return calculate_gather<int8_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<int8_t*>(output),
-                    static_cast<const int8_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_I16:
-                return calculate_gather<int16_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<int16_t*>(output),
-                    static_cast<const int16_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_I32:
-                return calculate_gather<int32_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<int32_t*>(output),
-                    static_cast<const int32_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_I64:
-                return calculate_gather<int64_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<int64_t*>(output),
-                    static_cast<const int64_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_U8:
-                return calculate_gather<uint8_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<uint8_t*>(output),
-                    static_cast<const uint8_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_U16:
-                return calculate_gather<uint16_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<uint16_t*>(output),
-                    static_cast<const uint16_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_U32:
-                return calculate_gather<uint32_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<uint32_t*>(output),
-                    static_cast<const uint32_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_U64:
-                return calculate_gather<uint64_t, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<uint64_t*>(output),
-                    static_cast<const uint64_t*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            case INFINI_DTYPE_BOOL:
-                return calculate_gather<bool, int64_t>(
-                    output_shape, input_shape,
-                    output_strides, input_strides, index_strides,
-                    static_cast<size_t>(_dim),
-                    static_cast<bool*>(output),
-                    static_cast<const bool*>(input),
-                    static_cast<const int64_t*>(index));
-                break;
-            default:
-                return INFINI_STATUS_BAD_TENSOR_DTYPE;
-        }
-    } else {
+    // without conversion elements are only moved, so the dtype only sets their size
+    switch (infiniSizeOf(_info.dtype)) {
+    case 1:
+        return gatherIndexType<uint8_t, uint8_t>(_info, output, input, index);
+    case 2:
+        return gatherIndexType<uint16_t, uint16_t>(_info, output, input, index);
+    case 4:
+        return gatherIndexType<uint32_t, uint32_t>(_info, output, input, index);
+    case 8:
+        return gatherIndexType<uint64_t, uint64_t>(_info, output, input, index);
+    default:
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
-    
-    return INFINI_STATUS_SUCCESS;
 }
 
-} // namespace op::gather::cpu
\ No newline at end of file
+} // namespace op::gather::cpu
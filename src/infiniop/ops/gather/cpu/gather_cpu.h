@@ -1,15 +1,23 @@
 #ifndef __GATHER_CPU_H__
 #define __GATHER_CPU_H__
 
-#include "../../../operator.h"
 #include "../../../devices/cpu/cpu_handle.h"
-#include <vector>
+#include "../../../operator.h"
+#include "../info.h"
 
 namespace op::gather::cpu {
 
 class Descriptor : public InfiniopDescriptor {
+    GatherInfo _info;
+
+    Descriptor(
+        GatherInfo info,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _info(std::move(info)) {}
+
 public:
-    Descriptor() = default;
     ~Descriptor();
 
     static infiniStatus_t create(
@@ -29,22 +37,8 @@ public:
         const void *input,
         const void *index,
         void *stream) const;
-
-private:
-    infiniopTensorDescriptor_t _input_desc;
-    infiniopTensorDescriptor_t _output_desc;
-    infiniopTensorDescriptor_t _index_desc;
-    int _dim;
-    std::vector<size_t> _input_shape;
-    std::vector<size_t> _output_shape;
-    std::vector<ptrdiff_t> _input_strides;
-    std::vector<ptrdiff_t> _output_strides;
-    std::vector<ptrdiff_t> _index_strides;
-    infiniDtype_t _dtype;
-    infiniDtype_t _index_dtype;
-    device::cpu::Handle *_handle;
 };
 
 } // namespace op::gather::cpu
 
-#endif // __GATHER_CPU_H__
\ No newline at end of file
+#endif // __GATHER_CPU_H__
@@ -0,0 +1,137 @@
+#ifndef __GATHER_INFO_H__
+#define __GATHER_INFO_H__
+
+#include "../../../utils.h"
+#include "../../operator.h"
+#include "../../tensor.h"
+#include <vector>
+
+namespace op::gather {
+
+/**
+ * Loop geometry of `output = input.gather(dim, index)`, over the shape of index.
+ *
+ * When index is broadcast (stride 0) over every dimension after `dim` and those
+ * dimensions are contiguous in input and output, each index selects a whole row,
+ * as in an embedding lookup. The trailing dimensions are then folded into `row_len`
+ * and only the leading ones are looped over.
+ *
+ * The looped dimensions are split into the innermost one and the remaining "row"
+ * dimensions. The input strides of the looped dimensions are 0 at `dim`, whose
+ * offset comes from the index instead. All strides are in elements.
+ */
+class GatherInfo {
+    GatherInfo() = default;
+
+public:
+    infiniDtype_t dtype, out_dtype, index_dtype;
+
+    // input.shape[dim], an index outside [0, dim_size) is an error
+    size_t dim_size;
+    ptrdiff_t input_stride_dim;
+
+    // elements copied per index, 1 unless the row gather applies
+    size_t row_len;
+
+    size_t inner_len;
+    ptrdiff_t out_stride_inner, index_stride_inner, input_stride_inner;
+
+    std::vector<size_t> outer_shape;
+    std::vector<ptrdiff_t> outer_out_strides, outer_index_strides, outer_input_strides;
+
+    bool rowGather() const { return row_len > 1; }
+
+    size_t outer() const {
+        size_t n = 1;
+        for (auto len : outer_shape) {
+            n *= len;
+        }
+        return n;
+    }
+
+    static utils::Result<GatherInfo> create(
+        infiniopTensorDescriptor_t input_desc,
+        infiniopTensorDescriptor_t output_desc,
+        int dim,
+        infiniopTensorDescriptor_t index_desc) {
+
+        auto dtype = input_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_F64, INFINI_DTYPE_BF16,
+                    INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
+                    INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
+                    INFINI_DTYPE_BOOL);
+        // the output has the input dtype, or f32 to dequantize a half-precision table
+        auto out_dtype = output_desc->dtype();
+        if (out_dtype != dtype
+            && !(out_dtype == INFINI_DTYPE_F32 && (dtype == INFINI_DTYPE_F16 || dtype == INFINI_DTYPE_BF16))) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        auto index_dtype = index_desc->dtype();
+        CHECK_DTYPE(index_dtype, INFINI_DTYPE_I32, INFINI_DTYPE_I64);
+
+        auto input_shape = input_desc->shape();
+        auto index_shape = index_desc->shape();
+        size_t ndim = input_shape.size();
+        if (dim < 0 || size_t(dim) >= ndim) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        if (index_shape.size() != ndim) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        CHECK_SAME_SHAPE(output_desc->shape(), index_shape);
+        for (size_t d = 0; d < ndim; ++d) {
+            if (d != size_t(dim) && input_shape[d] != index_shape[d]) {
+                return INFINI_STATUS_BAD_TENSOR_SHAPE;
+            }
+        }
+
+        auto out_strides = output_desc->strides();
+        auto index_strides = index_desc->strides();
+        auto input_strides = input_desc->strides();
+
+        GatherInfo info;
+        info.dtype = dtype;
+        info.out_dtype = out_dtype;
+        info.index_dtype = index_dtype;
+        info.dim_size = input_shape[dim];
+        info.input_stride_dim = input_strides[dim];
+
+        size_t loop_ndim = ndim;
+        info.row_len = 1;
+        if (size_t(dim) + 1 < ndim
+            && input_desc->isContiguous(dim + 1, ndim - 1)
+            && output_desc->isContiguous(dim + 1, ndim - 1)) {
+            bool broadcast = true;
+            size_t row_len = 1;
+            for (size_t d = dim + 1; d < ndim; ++d) {
+                broadcast = broadcast && (index_shape[d] == 1 || index_strides[d] == 0);
+                row_len *= index_shape[d];
+            }
+            if (broadcast && row_len > 1) {
+                info.row_len = row_len;
+                loop_ndim = dim + 1;
+            }
+        }
+
+        // the input offset along dim comes from the index
+        input_strides[dim] = 0;
+
+        size_t inner = loop_ndim - 1;
+        info.inner_len = index_shape[inner];
+        info.out_stride_inner = out_strides[inner];
+        info.index_stride_inner = index_strides[inner];
+        info.input_stride_inner = input_strides[inner];
+        for (size_t d = 0; d < inner; ++d) {
+            info.outer_shape.push_back(index_shape[d]);
+            info.outer_out_strides.push_back(out_strides[d]);
+            info.outer_index_strides.push_back(index_strides[d]);
+            info.outer_input_strides.push_back(input_strides[d]);
+        }
+
+        return utils::Result<GatherInfo>(info);
+    }
+};
+
+} // namespace op::gather
+
+#endif // __GATHER_INFO_H__
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/gather.h"
 
 #ifdef ENABLE_CPU_API
@@ -25,6 +28,7 @@ __C infiniStatus_t infiniopCreateGatherDescriptor(
     infiniopTensorDescriptor_t output_desc,
     int dim,
     infiniopTensorDescriptor_t index_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateGatherDescriptor, infiniopDestroyGatherDescriptor, handle, desc_ptr, input_desc, output_desc, dim, index_desc);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -106,11 +110,13 @@ __C infiniStatus_t infiniopGather(
     void *input,
     const void *index,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopGather, desc, workspace, workspace_size, output, input, index, stream);
+    INFINIOP_TRACE(infiniopGather, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                     \
-    case CASE:                                                                         \
-        return reinterpret_cast<op::gather::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, output, input, index, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                         \
+    case CASE:                                                                                             \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::gather::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, output, input, index, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -139,6 +145,7 @@ __C infiniStatus_t infiniopGather(
 
 __C infiniStatus_t
 infiniopDestroyGatherDescriptor(infiniopGatherDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
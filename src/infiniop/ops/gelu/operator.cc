@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/gelu.h"
 
 #ifdef ENABLE_CPU_API
@@ -23,6 +26,7 @@ __C infiniStatus_t infiniopCreateGeluDescriptor(
     infiniopGeluDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t output_desc,
     infiniopTensorDescriptor_t input_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateGeluDescriptor, infiniopDestroyGeluDescriptor, handle, desc_ptr, output_desc, input_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -104,11 +108,13 @@ __C infiniStatus_t infiniopGelu(
     void *output,
     const void *input,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopGelu, desc, workspace, workspace_size, output, input, stream);
+    INFINIOP_TRACE(infiniopGelu, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                          \
-    case CASE:                                                              \
-        return reinterpret_cast<op::gelu::NAMESPACE::Descriptor *>(desc)    \
-            ->calculate(workspace, workspace_size, output, {input}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                           \
+    case CASE:                                                                               \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::gelu::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, output, {input}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -141,6 +147,8 @@ __C infiniStatus_t infiniopGelu(
 
 __C infiniStatus_t
 infiniopDestroyGeluDescriptor(infiniopGeluDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DESTROY(CASE, NAMESPACE)                                            \
     case CASE:                                                              \
         delete reinterpret_cast<op::gelu::NAMESPACE::Descriptor *>(desc);   \
@@ -1,9 +1,126 @@
 #include "gemm_cpu.h"
+#include "../../../devices/cpu/autotune.h"
 #include "../../../devices/cpu/common_cpu.h"
+#include "kernel.h"
+#include <cstdlib>
+#include <utility>
 
 namespace op::gemm::cpu {
 
-Descriptor::~Descriptor() = default;
+struct Tiling {
+    size_t m, n, k;
+};
+
+// the tilings tried by the autotuner, the first one is the default
+static const Tiling TILINGS[] = {
+    {TILE_M, TILE_N, TILE_K},
+    {8, 128, 256},
+    {32, 64, 128},
+    {16, 128, 128},
+    {4, 256, 256},
+    {64, 32, 256},
+};
+
+// How the tiles are shared out: among the threads of the team divided by `divisor`, in equal
+// blocks or one tile at a time as the threads free up.
+struct Schedule {
+    size_t divisor;
+    bool dynamic;
+};
+
+// the schedules tried with the chosen tiling, the first one is the default
+static const Schedule SCHEDULES[] = {
+    {1, false},
+    {1, true},
+    {2, false},
+    {2, true},
+    {4, false},
+    {4, true},
+};
+
+// products larger than this are timed on fewer rows of C
+constexpr size_t TUNING_MAX_WORK = size_t(1) << 26;
+
+struct Descriptor::Opaque {
+    Tiling tiling;
+    Schedule schedule;
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+template <typename Tdata>
+void calculate(
+    const MatmulInfo &info,
+    const Tiling &tiling,
+    const Schedule &schedule,
+    void *c,
+    float beta,
+    const void *a,
+    const void *b,
+    float alpha);
+
+// elements spanned by one matrix of a batch with `rows` rows, 0 for negative strides
+static size_t matrixSpan(const BlasMatrix &matrix, size_t rows) {
+    if (matrix.row_stride < 0 || matrix.col_stride < 0) {
+        return 0;
+    }
+    return (rows - 1) * size_t(matrix.row_stride) + (matrix.cols - 1) * size_t(matrix.col_stride) + 1;
+}
+
+/**
+ * Picks the tiling for `info` among `TILINGS`, then the schedule among `SCHEDULES` for it, timing
+ * them on zeroed buffers laid out like the operands when tuning is enabled. Only one matrix of the
+ * batch is computed, with fewer rows of C when the product is large.
+ */
+template <typename Tdata>
+static std::pair<Tiling, Schedule> selectConfig(infiniDtype_t dtype, MatmulInfo info) {
+    std::vector<std::string> names;
+    for (const auto &tiling : TILINGS) {
+        names.push_back(std::to_string(tiling.m) + 'x' + std::to_string(tiling.n) + 'x' + std::to_string(tiling.k));
+    }
+    // thread counts below one are not offered, the choices are kept per thread count anyway
+    std::vector<Schedule> schedules;
+    std::vector<std::string> schedule_names;
+    for (const auto &schedule : SCHEDULES) {
+        if (schedule.divisor == 1 || schedule.divisor <= common_cpu::getMaxThreads()) {
+            schedules.push_back(schedule);
+            schedule_names.push_back("threads/" + std::to_string(schedule.divisor) + (schedule.dynamic ? "-dynamic" : "-static"));
+        }
+    }
+    auto bucket = common_cpu::autotune::bucket(infiniDtypeToString(dtype), {info.m, info.n, info.k});
+
+    info.batch = 1;
+    info.is_transed = false;
+    info.m = std::min(info.m, std::max(TILE_M * 4, TUNING_MAX_WORK / std::max(info.n * info.k, size_t(1))));
+    size_t a_size = matrixSpan(info.a_matrix, info.m),
+           b_size = matrixSpan(info.b_matrix, info.k),
+           c_size = matrixSpan(info.c_matrix, info.m);
+    if (a_size == 0 || b_size == 0 || c_size == 0) {
+        return {TILINGS[0], SCHEDULES[0]};
+    }
+
+    // allocated once tuning actually runs
+    std::vector<Tdata> a, b, c;
+    auto prepare = [&] {
+        if (c.empty()) {
+            a.assign(a_size, utils::cast<Tdata>(0.0f));
+            b.assign(b_size, utils::cast<Tdata>(0.0f));
+            c.assign(c_size, utils::cast<Tdata>(0.0f));
+        }
+    };
+    size_t index = common_cpu::autotune::select("gemm", bucket, names, 0, [&](size_t i) {
+        prepare();
+        cpu::calculate<Tdata>(info, TILINGS[i], SCHEDULES[0], c.data(), 0, a.data(), b.data(), 1);
+    });
+    const Tiling &tiling = TILINGS[index];
+    size_t schedule = common_cpu::autotune::select("gemm_schedule", bucket + '_' + names[index], schedule_names, 0, [&](size_t i) {
+        prepare();
+        cpu::calculate<Tdata>(info, tiling, schedules[i], c.data(), 0, a.data(), b.data(), 1);
+    });
+    return {tiling, schedules[schedule]};
+}
 
 infiniStatus_t Descriptor::create(
     infiniopHandle_t handle_,
@@ -18,10 +135,24 @@ infiniStatus_t Descriptor::create(
 
     auto result = MatmulInfo::create(c_desc, a_desc, b_desc, MatrixLayout::COL_MAJOR);
     CHECK_RESULT(result);
+    auto info = result.take();
+
+    std::pair<Tiling, Schedule> config;
+    switch (dtype) {
+    case INFINI_DTYPE_F16:
+        config = selectConfig<fp16_t>(dtype, info);
+        break;
+    case INFINI_DTYPE_BF16:
+        config = selectConfig<bf16_t>(dtype, info);
+        break;
+    default:
+        config = selectConfig<float>(dtype, info);
+        break;
+    }
 
     *desc_ptr = new Descriptor(
-        dtype, result.take(), 0,
-        nullptr,
+        dtype, info, 0,
+        new Opaque{config.first, config.second},
         handle->device, handle->device_id);
     return INFINI_STATUS_SUCCESS;
 }
@@ -29,6 +160,8 @@ infiniStatus_t Descriptor::create(
 template <typename Tdata>
 void calculate(
     const MatmulInfo &info,
+    const Tiling &tiling,
+    const Schedule &schedule,
     void *c,
     float beta,
     const void *a,
@@ -38,33 +171,64 @@ void calculate(
         std::swap(a, b);
     }
 
-#pragma omp parallel for
-    for (ptrdiff_t index = 0; index < ptrdiff_t(info.batch * info.m * info.n); ++index) {
-        size_t ind = index;
-        size_t n_ = ind % info.n;
-        ind /= info.n;
-        size_t m_ = ind % info.m;
-        ind /= info.m;
-        size_t i = ind;
-        auto c_ = reinterpret_cast<Tdata *>(c) + i * info.c_matrix.stride + m_ * info.c_matrix.row_stride + n_ * info.c_matrix.col_stride;
-        float sum = 0;
-        for (int k_ = 0; k_ < static_cast<int>(info.k); ++k_) {
-            auto a_ = reinterpret_cast<const Tdata *>(a) + i * info.a_matrix.stride + m_ * info.a_matrix.row_stride + k_ * info.a_matrix.col_stride;
-            auto b_ = reinterpret_cast<const Tdata *>(b) + i * info.b_matrix.stride + n_ * info.b_matrix.col_stride + k_ * info.b_matrix.row_stride;
-            if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
-                sum += utils::cast<float>(*a_) * utils::cast<float>(*b_);
-            } else {
-                sum += *a_ * (*b_);
+    const size_t tile_m = tiling.m, tile_n = tiling.n;
+    const size_t m_tiles = CEIL_DIV(info.m, tile_m);
+    const size_t n_tiles = CEIL_DIV(info.n, tile_n);
+    const ptrdiff_t num_tiles = ptrdiff_t(info.batch * m_tiles * n_tiles);
+    const int num_threads = int(std::max(common_cpu::getMaxThreads() / schedule.divisor, size_t(1)));
+
+#pragma omp parallel num_threads(num_threads)
+    {
+        std::vector<float> acc(tile_m * tile_n);
+        std::vector<float> pack(packSize(tile_n, tiling.k));
+
+        auto compute = [&](ptrdiff_t tile) {
+            size_t ind = tile;
+            size_t n0 = ind % n_tiles * tile_n;
+            ind /= n_tiles;
+            size_t m0 = ind % m_tiles * tile_m;
+            ind /= m_tiles;
+            size_t i = ind;
+            size_t mb = std::min(tile_m, info.m - m0);
+            size_t nb = std::min(tile_n, info.n - n0);
+
+            auto a_ = reinterpret_cast<const Tdata *>(a) + i * info.a_matrix.stride + m0 * info.a_matrix.row_stride;
+            auto b_ = reinterpret_cast<const Tdata *>(b) + i * info.b_matrix.stride + n0 * info.b_matrix.col_stride;
+            auto c_ = reinterpret_cast<Tdata *>(c) + i * info.c_matrix.stride + m0 * info.c_matrix.row_stride + n0 * info.c_matrix.col_stride;
+
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            accumulateTile(acc.data(), tile_n, mb, nb, info.k,
+                           a_, info.a_matrix.row_stride, info.a_matrix.col_stride,
+                           b_, info.b_matrix.row_stride, info.b_matrix.col_stride,
+                           pack.data(), tiling.k);
+
+            for (size_t m_ = 0; m_ < mb; ++m_) {
+                for (size_t n_ = 0; n_ < nb; ++n_) {
+                    auto dst = c_ + m_ * info.c_matrix.row_stride + n_ * info.c_matrix.col_stride;
+                    float sum = acc[m_ * tile_n + n_];
+                    if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
+                        if (beta == 0) {
+                            *dst = utils::cast<Tdata>(alpha * sum);
+                        } else {
+                            *dst = utils::cast<Tdata>(beta * utils::cast<float>(*dst) + alpha * sum);
+                        }
+                    } else {
+                        *dst = beta * (*dst) + alpha * sum;
+                    }
+                }
             }
-        }
-        if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
-            if (beta == 0) {
-                *c_ = utils::cast<Tdata>(alpha * sum);
-            } else {
-                *c_ = utils::cast<Tdata>(beta * utils::cast<float>(*c_) + alpha * sum);
+        };
+
+        if (schedule.dynamic) {
+#pragma omp for schedule(dynamic)
+            for (ptrdiff_t tile = 0; tile < num_tiles; ++tile) {
+                compute(tile);
             }
         } else {
-            *c_ = beta * (*c_) + alpha * sum;
+#pragma omp for schedule(static)
+            for (ptrdiff_t tile = 0; tile < num_tiles; ++tile) {
+                compute(tile);
+            }
         }
     }
 }
@@ -81,15 +245,15 @@ infiniStatus_t Descriptor::calculate(
 
     switch (_dtype) {
     case INFINI_DTYPE_F16:
-        cpu::calculate<fp16_t>(_info, c, beta, a, b, alpha);
+        cpu::calculate<fp16_t>(_info, _opaque->tiling, _opaque->schedule, c, beta, a, b, alpha);
         return INFINI_STATUS_SUCCESS;
 
     case INFINI_DTYPE_BF16:
-        cpu::calculate<bf16_t>(_info, c, beta, a, b, alpha);
+        cpu::calculate<bf16_t>(_info, _opaque->tiling, _opaque->schedule, c, beta, a, b, alpha);
         return INFINI_STATUS_SUCCESS;
 
     case INFINI_DTYPE_F32:
-        cpu::calculate<float>(_info, c, beta, a, b, alpha);
+        cpu::calculate<float>(_info, _opaque->tiling, _opaque->schedule, c, beta, a, b, alpha);
         return INFINI_STATUS_SUCCESS;
 
     default:
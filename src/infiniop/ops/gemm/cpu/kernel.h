@@ -0,0 +1,124 @@
+#ifndef __GEMM_CPU_KERNEL_H__
+#define __GEMM_CPU_KERNEL_H__
+
+#include "../../../../utils.h"
+#include "../../../devices/cpu/cpu_isa.h"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Blocked GEMM building blocks shared by CPU operators.
+ *
+ * A tile of C is accumulated in a caller-provided f32 buffer, so callers may run
+ * an arbitrary epilogue (scaling, bias, activation, ...) on the tile before it
+ * is written back. Panels of B are converted into a contiguous f32 buffer first,
+ * which keeps the innermost loop unit-stride regardless of B's dtype and layout.
+ * The f32 panel product and the conversions run on the kernels bound for the CPU's instruction set.
+ */
+
+namespace op::gemm::cpu {
+
+// Rows of A processed together for one packed panel of B
+constexpr size_t TILE_M = 16;
+// Columns of C accumulated per tile
+constexpr size_t TILE_N = 64;
+// Depth of one packed panel of B
+constexpr size_t TILE_K = 256;
+
+// Size in floats of the panel buffer required by `accumulateTile` for `nb` columns
+inline size_t packSize(size_t nb, size_t tile_k = TILE_K) {
+    return tile_k * nb;
+}
+
+template <typename T>
+inline float toFloat(const T &val) {
+    if constexpr (std::is_same_v<T, float>) {
+        return val;
+    } else {
+        return utils::cast<float>(val);
+    }
+}
+
+// dst[j] = src[j * stride] for j in [0, n)
+template <typename T>
+void convertRow(float *dst, const T *src, ptrdiff_t stride, size_t n) {
+    if (stride == 1) {
+        if constexpr (std::is_same_v<T, float>) {
+            std::copy(src, src + n, dst);
+            return;
+        } else if constexpr (std::is_same_v<T, fp16_t>) {
+            common_cpu::isa::kernels().f16_to_f32(dst, src, n);
+            return;
+        } else if constexpr (std::is_same_v<T, bf16_t>) {
+            common_cpu::isa::kernels().bf16_to_f32(dst, src, n);
+            return;
+        }
+    }
+    for (size_t j = 0; j < n; ++j) {
+        dst[j] = toFloat(src[j * stride]);
+    }
+}
+
+// dst[p * nb + j] = B[p, j] for p in [0, kc), j in [0, nb)
+template <typename Tb>
+void packPanel(float *dst, const Tb *b, ptrdiff_t b_rs, ptrdiff_t b_cs, size_t kc, size_t nb) {
+    for (size_t p = 0; p < kc; ++p) {
+        convertRow(dst + p * nb, b + p * b_rs, b_cs, nb);
+    }
+}
+
+/**
+ * acc[i * ld_acc + j] += sum_p A[i, p] * pack[p * nb + j]
+ * for i in [0, mb), j in [0, nb), p in [0, kc), with `pack` laid out by `packPanel`.
+ *
+ * Callers that produce B on the fly (e.g. implicit im2col) fill `pack` themselves.
+ */
+template <typename Ta>
+void multiplyPanel(
+    float *acc, size_t ld_acc,
+    size_t mb, size_t nb, size_t kc,
+    const Ta *a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+    const float *pack) {
+
+    const auto &kernels = common_cpu::isa::kernels();
+    if constexpr (std::is_same_v<Ta, float>) {
+        kernels.multiply_panel(acc, ld_acc, mb, nb, kc, a, a_rs, a_cs, pack);
+    } else {
+        // rows of A are converted to f32 one chunk at a time
+        float a_row[TILE_K];
+        for (size_t i = 0; i < mb; ++i) {
+            for (size_t p0 = 0; p0 < kc; p0 += TILE_K) {
+                size_t pc = std::min(TILE_K, kc - p0);
+                convertRow(a_row, a + i * a_rs + p0 * a_cs, a_cs, pc);
+                kernels.multiply_panel(acc + i * ld_acc, ld_acc, 1, nb, pc, a_row, 0, 1, pack + p0 * nb);
+            }
+        }
+    }
+}
+
+/**
+ * acc[i * ld_acc + j] += sum_p A[i, p] * B[p, j]
+ * for i in [0, mb), j in [0, nb), p in [0, k).
+ *
+ * `pack` must hold at least `packSize(nb, tile_k)` floats.
+ */
+template <typename Ta, typename Tb>
+void accumulateTile(
+    float *acc, size_t ld_acc,
+    size_t mb, size_t nb, size_t k,
+    const Ta *a, ptrdiff_t a_rs, ptrdiff_t a_cs,
+    const Tb *b, ptrdiff_t b_rs, ptrdiff_t b_cs,
+    float *pack,
+    size_t tile_k = TILE_K) {
+
+    for (size_t p0 = 0; p0 < k; p0 += tile_k) {
+        size_t kc = std::min(tile_k, k - p0);
+        packPanel(pack, b + p0 * b_rs, b_rs, b_cs, kc, nb);
+        multiplyPanel(acc, ld_acc, mb, nb, kc, a + p0 * a_cs, a_rs, a_cs, pack);
+    }
+}
+
+} // namespace op::gemm::cpu
+
+#endif // __GEMM_CPU_KERNEL_H__
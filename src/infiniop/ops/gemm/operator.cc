@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/gemm.h"
 
 #ifdef ENABLE_CPU_API
@@ -30,6 +33,7 @@ __C infiniStatus_t infiniopCreateGemmDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateGemmDescriptor, infiniopDestroyGemmDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -128,14 +132,16 @@ __C infiniStatus_t infiniopGemm(
     float alpha,
     float beta,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopGemm, desc, workspace, workspace_size, c, a, b, alpha, beta, stream);
+    INFINIOP_TRACE(infiniopGemm, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::gemm::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size,                             \
-                        c, beta,                                               \
-                        a, b, alpha,                                           \
-                        stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::gemm::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                                 \
+                        c, beta,                                                                   \
+                        a, b, alpha,                                                               \
+                        stream))
 
     switch (desc->device_type) {
 
@@ -173,6 +179,7 @@ __C infiniStatus_t infiniopGemm(
 
 __C infiniStatus_t
 infiniopDestroyGemmDescriptor(infiniopGemmDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/hardswish.h"
 
 #ifdef ENABLE_CPU_API
@@ -19,6 +22,7 @@ __C infiniStatus_t infiniopCreateHardSwishDescriptor(
     infiniopHardSwishDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t y_desc,
     infiniopTensorDescriptor_t x_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateHardSwishDescriptor, infiniopDestroyHardSwishDescriptor, handle, desc_ptr, y_desc, x_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -87,11 +91,13 @@ __C infiniStatus_t infiniopHardSwish(
     void *y,
     const void *x,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopHardSwish, desc, workspace, workspace_size, y, x, stream);
+    INFINIOP_TRACE(infiniopHardSwish, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::hardswish::NAMESPACE::Descriptor *>(desc)  \
-            ->calculate(workspace, workspace_size, y, {x}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                      \
+    case CASE:                                                                                          \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::hardswish::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, {x}, stream))
 
     switch (desc->device_type) {
 
@@ -118,6 +124,7 @@ __C infiniStatus_t infiniopHardSwish(
 }
 
 __C infiniStatus_t infiniopDestroyHardSwishDescriptor(infiniopHardSwishDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
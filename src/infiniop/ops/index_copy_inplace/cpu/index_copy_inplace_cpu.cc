@@ -1,11 +1,14 @@
 #include "index_copy_inplace_cpu.h"
-#include "../../../../utils.h"
-#include "../../../tensor.h"
+#include "../../../devices/cpu/common_cpu.h"
 #include <cstring>
-#include <cstdio>
 
 namespace op::index_copy_inplace::cpu {
 
+// bytes copied by one work item
+constexpr size_t COPY_GRAIN = 16384;
+// copies of fewer bytes run on the calling thread
+constexpr size_t COPY_PARALLEL_MIN = 65536;
+
 Descriptor::~Descriptor() = default;
 
 infiniStatus_t Descriptor::create(
@@ -17,126 +20,110 @@ infiniStatus_t Descriptor::create(
     infiniopTensorDescriptor_t index_desc) {
 
     auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
-    auto dtype = target_desc->dtype();
 
-    CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_F64, INFINI_DTYPE_BF16,
-                INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
-                INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
-                INFINI_DTYPE_BOOL);
+    auto result = IndexCopyInplaceInfo::create(target_desc, source_desc, dim, index_desc);
+    CHECK_RESULT(result);
+    auto info = result.take();
 
-    // Check that target and source have same dtype
-    if (target_desc->dtype() != source_desc->dtype()) {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
-    }
+    auto slice = utils::RearrangeMeta::create(
+        info.slice_shape.data(), info.slice_target_strides.data(), info.slice_source_strides.data(),
+        info.slice_shape.size(), infiniSizeOf(info.dtype));
+    CHECK_RESULT(slice);
 
-    // Check that index is integer type
-    auto index_dtype = index_desc->dtype();
-    if (index_dtype != INFINI_DTYPE_I32 && index_dtype != INFINI_DTYPE_I64) {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
-    }
+    // one entry per target slice for the duplicate pre-pass, a single index cannot collide
+    size_t workspace_size = info.num_indices > 1 ? info.target_dim_size * sizeof(size_t) : 0;
 
-    // Check dimension bounds
-    auto target_shape = target_desc->shape();
-    auto source_shape = source_desc->shape();
-    if (dim < 0 || dim >= static_cast<int>(target_shape.size())) {
-        return INFINI_STATUS_BAD_PARAM;
-    }
-    if (dim < 0 || dim >= static_cast<int>(source_shape.size())) {
-        return INFINI_STATUS_BAD_PARAM;
-    }
+    *desc_ptr = new Descriptor(
+        std::move(info),
+        slice.take(),
+        workspace_size,
+        handle->device,
+        handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
 
-    // Check that target and source have same shape except possibly at dim
-    if (target_shape.size() != source_shape.size()) {
-        return INFINI_STATUS_BAD_TENSOR_SHAPE;
+template <typename Tindex>
+void indexCopy(
+    const IndexCopyInplaceInfo &info,
+    const utils::RearrangeMeta &slice,
+    size_t *last_writer,
+    char *target,
+    const char *source,
+    const Tindex *index) {
+
+    const size_t n = info.num_indices;
+    const ptrdiff_t dim_size = ptrdiff_t(info.target_dim_size);
+    const ptrdiff_t element_size = ptrdiff_t(infiniSizeOf(info.dtype));
+    const ptrdiff_t target_stride = info.target_stride_dim * element_size;
+    const ptrdiff_t source_stride = info.source_stride_dim * element_size;
+
+    auto slot_of = [&](size_t i) {
+        return ptrdiff_t(index[ptrdiff_t(i) * info.index_stride]);
+    };
+
+    // Duplicate indices: the last source slice wins, as in a serial loop. The pre-pass records
+    // the last writer of every slot it sees; only those slots are read back, so the buffer
+    // needs no clearing.
+    if (n > 1) {
+        for (size_t i = 0; i < n; ++i) {
+            ptrdiff_t slot = slot_of(i);
+            if (slot >= 0 && slot < dim_size) {
+                last_writer[slot] = i;
+            }
+        }
     }
-    for (size_t i = 0; i < target_shape.size(); ++i) {
-        if (i != static_cast<size_t>(dim) && target_shape[i] != source_shape[i]) {
-            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+    auto writes = [&](size_t i, ptrdiff_t slot) {
+        return slot >= 0 && slot < dim_size && (n == 1 || last_writer[slot] == i);
+    };
+
+    const size_t unit = slice.unit();
+    const size_t count = slice.count();
+    const bool parallel = n * count * unit >= COPY_PARALLEL_MIN;
+
+    if (count == 1) {
+        // contiguous slices: one block copy per index, large slices are split into grains
+        const size_t pieces = CEIL_DIV(unit, COPY_GRAIN);
+#pragma omp parallel for schedule(static) if (parallel)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(n * pieces); ++item) {
+            size_t i = size_t(item) / pieces;
+            size_t begin = size_t(item) % pieces * COPY_GRAIN;
+            ptrdiff_t slot = slot_of(i);
+            if (writes(i, slot)) {
+                std::memcpy(target + slot * target_stride + begin,
+                            source + ptrdiff_t(i) * source_stride + begin,
+                            std::min(COPY_GRAIN, unit - begin));
+            }
         }
+        return;
     }
 
-    auto desc = new Descriptor();
-    desc->_target_desc = target_desc;
-    desc->_source_desc = source_desc;
-    desc->_index_desc = index_desc;
-    desc->_dim = dim;
-    desc->_handle = handle;
-    desc->device_type = INFINI_DEVICE_CPU;
-    desc->device_id = handle->device_id;
-
-    *desc_ptr = desc;
-    return INFINI_STATUS_SUCCESS;
-}
-
-template<typename T, typename IndexT>
-static void index_copy_inplace_kernel(
-    const T *source_data,
-    T *target_data,
-    const IndexT *index_data,
-    const std::vector<size_t> &source_shape,
-    const std::vector<size_t> &target_shape,
-    const std::vector<size_t> &index_shape,
-    const std::vector<ptrdiff_t> &source_strides,
-    const std::vector<ptrdiff_t> &target_strides,
-    const std::vector<ptrdiff_t> &index_strides,
-    int dim) {
-
-    // Process each element in the source tensor along the specified dimension
-    // For each source element at position i, copy it to target[index[i]]
-    // Note: When duplicate indices exist, this implementation follows "last value wins" strategy
-    // This matches PyTorch's CPU behavior for index_copy_ with duplicate indices
-    for (size_t source_idx = 0; source_idx < source_shape[dim]; ++source_idx) {
-        // Get the target index for this source element
-        IndexT target_idx = index_data[source_idx];
-        
-        // Check bounds for target index
-        if (target_idx < 0 || target_idx >= static_cast<IndexT>(target_shape[dim])) {
+    const size_t ndim = slice.ndim();
+    const ptrdiff_t *idx_strides = slice.idx_strides();
+    const ptrdiff_t *dst_strides = slice.dst_strides();
+    const ptrdiff_t *src_strides = slice.src_strides();
+    const size_t runs = std::max<size_t>(1, COPY_GRAIN / unit);
+    const size_t blocks = CEIL_DIV(count, runs);
+
+#pragma omp parallel for schedule(static) if (parallel)
+    for (ptrdiff_t item = 0; item < ptrdiff_t(n * blocks); ++item) {
+        size_t i = size_t(item) / blocks;
+        size_t r_begin = size_t(item) % blocks * runs;
+        size_t r_end = std::min(count, r_begin + runs);
+        ptrdiff_t slot = slot_of(i);
+        if (!writes(i, slot)) {
             continue;
         }
-        
-        // Calculate the number of elements in each slice (excluding the dim dimension)
-        size_t slice_size = 1;
-        for (size_t d = 0; d < source_shape.size(); ++d) {
-            if (d != static_cast<size_t>(dim)) {
-                slice_size *= source_shape[d];
-            }
-        }
-        
-        // Copy all elements in this slice
-        for (size_t elem_in_slice = 0; elem_in_slice < slice_size; ++elem_in_slice) {
-            // Calculate coordinates for this element within the slice
-            std::vector<size_t> source_coords(source_shape.size());
-            source_coords[dim] = source_idx;  // Set the dim coordinate for source
-            
-            size_t temp = elem_in_slice;
-            
-            // Fill coordinates for all dimensions except dim
-            for (int d = source_shape.size() - 1; d >= 0; --d) {
-                if (d != dim) {
-                    size_t dim_size = source_shape[d];
-                    source_coords[d] = temp % dim_size;
-                    temp /= dim_size;
-                }
-            }
-            
-            // Calculate target coordinates
-            std::vector<size_t> target_coords = source_coords;
-            target_coords[dim] = static_cast<size_t>(target_idx);
-            
-            // Calculate source offset - strides are in elements
-            ptrdiff_t source_offset = 0;
-            for (size_t d = 0; d < source_coords.size(); ++d) {
-                source_offset += source_coords[d] * source_strides[d];
-            }
-            
-            // Calculate target offset - strides are in elements
-            ptrdiff_t target_offset = 0;
-            for (size_t d = 0; d < target_coords.size(); ++d) {
-                target_offset += target_coords[d] * target_strides[d];
+        char *dst = target + slot * target_stride;
+        const char *src = source + ptrdiff_t(i) * source_stride;
+        for (size_t r = r_begin; r < r_end; ++r) {
+            ptrdiff_t rem = ptrdiff_t(r), dst_offset = 0, src_offset = 0;
+            for (size_t j = 0; j < ndim; ++j) {
+                ptrdiff_t k = rem / idx_strides[j];
+                dst_offset += k * dst_strides[j];
+                src_offset += k * src_strides[j];
+                rem %= idx_strides[j];
             }
-            
-            // Copy the value: target[index[i]] = source[i]
-            target_data[target_offset] = source_data[source_offset];
+            std::memcpy(dst + dst_offset, src + src_offset, unit);
         }
     }
 }
@@ -149,276 +136,21 @@ infiniStatus_t Descriptor::calculate(
     const void *index,
     void *stream) const {
 
-
-    
-    // Check if descriptors are valid pointers
-    if (!_target_desc || !_source_desc || !_index_desc) {
-        return INFINI_STATUS_BAD_PARAM;
-    }
-    
-    if (!target || !source || !index) {
-        return INFINI_STATUS_BAD_PARAM;
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
     }
 
-    auto target_shape = _target_desc->shape();
-    auto source_shape = _source_desc->shape();
-    auto index_shape = _index_desc->shape();
-    auto target_strides = _target_desc->strides();
-    auto source_strides = _source_desc->strides();
-    auto index_strides = _index_desc->strides();
-    auto dtype = _target_desc->dtype();
-    auto index_dtype = _index_desc->dtype();
-
-    // Dispatch based on data type and index type
-    if (index_dtype == INFINI_DTYPE_I32) {
-        switch (dtype) {
-            case INFINI_DTYPE_F16:
-                index_copy_inplace_kernel<uint16_t, int32_t>(
-                    static_cast<const uint16_t*>(source),
-                    static_cast<uint16_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_F32:
-                index_copy_inplace_kernel<float, int32_t>(
-                    static_cast<const float*>(source),
-                    static_cast<float*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_F64:
-                index_copy_inplace_kernel<double, int32_t>(
-                    static_cast<const double*>(source),
-                    static_cast<double*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_BF16:
-                index_copy_inplace_kernel<uint16_t, int32_t>(
-                    static_cast<const uint16_t*>(source),
-                    static_cast<uint16_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I8:
-                index_copy_inplace_kernel<int8_t, int32_t>(
-                    static_cast<const int8_t*>(source),
-                    static_cast<int8_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I16:
-                index_copy_inplace_kernel<int16_t, int32_t>(
-                    static_cast<const int16_t*>(source),
-                    static_cast<int16_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I32:
-                index_copy_inplace_kernel<int32_t, int32_t>(
-                    static_cast<const int32_t*>(source),
-                    static_cast<int32_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I64:
-                index_copy_inplace_kernel<int64_t, int32_t>(
-                    static_cast<const int64_t*>(source),
-                    static_cast<int64_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U8:
-                index_copy_inplace_kernel<uint8_t, int32_t>(
-                    static_cast<const uint8_t*>(source),
-                    static_cast<uint8_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U16:
-                index_copy_inplace_kernel<uint16_t, int32_t>(
-                    static_cast<const uint16_t*>(source),
-                    static_cast<uint16_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U32:
-                index_copy_inplace_kernel<uint32_t, int32_t>(
-                    static_cast<const uint32_t*>(source),
-                    static_cast<uint32_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U64:
-                index_copy_inplace_kernel<uint64_t, int32_t>(
-                    static_cast<const uint64_t*>(source),
-                    static_cast<uint64_t*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_BOOL:
-                index_copy_inplace_kernel<bool, int32_t>(
-                    static_cast<const bool*>(source),
-                    static_cast<bool*>(target),
-                    static_cast<const int32_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            default:
-                return INFINI_STATUS_BAD_TENSOR_DTYPE;
-        }
-    } else if (index_dtype == INFINI_DTYPE_I64) {
-        switch (dtype) {
-            case INFINI_DTYPE_F16:
-                index_copy_inplace_kernel<uint16_t, int64_t>(
-                    static_cast<const uint16_t*>(source),
-                    static_cast<uint16_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_F32:
-                index_copy_inplace_kernel<float, int64_t>(
-                    static_cast<const float*>(source),
-                    static_cast<float*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_F64:
-                index_copy_inplace_kernel<double, int64_t>(
-                    static_cast<const double*>(source),
-                    static_cast<double*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_BF16:
-                index_copy_inplace_kernel<uint16_t, int64_t>(
-                    static_cast<const uint16_t*>(source),
-                    static_cast<uint16_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I8:
-                index_copy_inplace_kernel<int8_t, int64_t>(
-                    static_cast<const int8_t*>(source),
-                    static_cast<int8_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I16:
-                index_copy_inplace_kernel<int16_t, int64_t>(
-                    static_cast<const int16_t*>(source),
-                    static_cast<int16_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I32:
-                index_copy_inplace_kernel<int32_t, int64_t>(
-                    static_cast<const int32_t*>(source),
-                    static_cast<int32_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_I64:
-                index_copy_inplace_kernel<int64_t, int64_t>(
-                    static_cast<const int64_t*>(source),
-                    static_cast<int64_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U8:
-                index_copy_inplace_kernel<uint8_t, int64_t>(
-                    static_cast<const uint8_t*>(source),
-                    static_cast<uint8_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U16:
-                index_copy_inplace_kernel<uint16_t, int64_t>(
-                    static_cast<const uint16_t*>(source),
-                    static_cast<uint16_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U32:
-                index_copy_inplace_kernel<uint32_t, int64_t>(
-                    static_cast<const uint32_t*>(source),
-                    static_cast<uint32_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_U64:
-                index_copy_inplace_kernel<uint64_t, int64_t>(
-                    static_cast<const uint64_t*>(source),
-                    static_cast<uint64_t*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            case INFINI_DTYPE_BOOL:
-                index_copy_inplace_kernel<bool, int64_t>(
-                    static_cast<const bool*>(source),
-                    static_cast<bool*>(target),
-                    static_cast<const int64_t*>(index),
-                    source_shape, target_shape, index_shape,
-                    source_strides, target_strides, index_strides,
-                    _dim);
-                break;
-            default:
-                return INFINI_STATUS_BAD_TENSOR_DTYPE;
-        }
-    } else {
+    // the element type only sets the copy size, so data is moved as bytes
+    switch (_info.index_dtype) {
+    case INFINI_DTYPE_I32:
+        indexCopy(_info, _slice, (size_t *)workspace, (char *)target, (const char *)source, (const int32_t *)index);
+        return INFINI_STATUS_SUCCESS;
+    case INFINI_DTYPE_I64:
+        indexCopy(_info, _slice, (size_t *)workspace, (char *)target, (const char *)source, (const int64_t *)index);
+        return INFINI_STATUS_SUCCESS;
+    default:
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
-
-    return INFINI_STATUS_SUCCESS;
 }
 
-} // namespace op::index_copy_inplace::cpu
\ No newline at end of file
+} // namespace op::index_copy_inplace::cpu
@@ -1,14 +1,31 @@
 #ifndef __INDEX_COPY_INPLACE_CPU_H__
 #define __INDEX_COPY_INPLACE_CPU_H__
 
-#include "../../../operator.h"
+#include "../../../../utils/rearrange.h"
 #include "../../../devices/cpu/cpu_handle.h"
+#include "../../../operator.h"
+#include "../info.h"
 
 namespace op::index_copy_inplace::cpu {
 
 class Descriptor : public InfiniopDescriptor {
+    IndexCopyInplaceInfo _info;
+    // copy of one slice, merged into runs of contiguous bytes
+    utils::RearrangeMeta _slice;
+    size_t _workspace_size;
+
+    Descriptor(
+        IndexCopyInplaceInfo info,
+        utils::RearrangeMeta slice,
+        size_t workspace_size,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _info(std::move(info)),
+          _slice(std::move(slice)),
+          _workspace_size(workspace_size) {}
+
 public:
-    Descriptor() = default;
     ~Descriptor();
 
     static infiniStatus_t create(
@@ -19,7 +36,7 @@ public:
         int dim,
         infiniopTensorDescriptor_t index_desc);
 
-    size_t workspaceSize() const { return 0; }
+    size_t workspaceSize() const { return _workspace_size; }
 
     infiniStatus_t calculate(
         void *workspace,
@@ -28,15 +45,8 @@ public:
         const void *source,
         const void *index,
         void *stream) const;
-
-private:
-    infiniopTensorDescriptor_t _target_desc;
-    infiniopTensorDescriptor_t _source_desc;
-    infiniopTensorDescriptor_t _index_desc;
-    int _dim;
-    device::cpu::Handle *_handle;
 };
 
 } // namespace op::index_copy_inplace::cpu
 
-#endif // __INDEX_COPY_INPLACE_CPU_H__
\ No newline at end of file
+#endif // __INDEX_COPY_INPLACE_CPU_H__
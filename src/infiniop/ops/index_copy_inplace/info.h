@@ -0,0 +1,95 @@
+#ifndef __INDEX_COPY_INPLACE_INFO_H__
+#define __INDEX_COPY_INPLACE_INFO_H__
+
+#include "../../../utils.h"
+#include "../../operator.h"
+#include "../../tensor.h"
+#include <vector>
+
+namespace op::index_copy_inplace {
+
+/**
+ * Geometry of `target.index_copy_(dim, index, source)`: source slice `i` along `dim`
+ * is copied to target slice `index[i]`. A slice is every dimension except `dim` and
+ * has the same shape in target and source. Strides are in elements.
+ */
+class IndexCopyInplaceInfo {
+    IndexCopyInplaceInfo() = default;
+
+public:
+    infiniDtype_t dtype, index_dtype;
+    size_t dim;
+
+    // source.shape[dim], also the number of indices
+    size_t num_indices;
+    // target.shape[dim], indices outside [0, target_dim_size) are skipped
+    size_t target_dim_size;
+    ptrdiff_t index_stride;
+    ptrdiff_t target_stride_dim, source_stride_dim;
+
+    std::vector<size_t> slice_shape;
+    std::vector<ptrdiff_t> slice_target_strides, slice_source_strides;
+
+    static utils::Result<IndexCopyInplaceInfo> create(
+        infiniopTensorDescriptor_t target_desc,
+        infiniopTensorDescriptor_t source_desc,
+        int dim,
+        infiniopTensorDescriptor_t index_desc) {
+
+        auto dtype = target_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_F64, INFINI_DTYPE_BF16,
+                    INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
+                    INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
+                    INFINI_DTYPE_BOOL);
+        if (source_desc->dtype() != dtype) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        auto index_dtype = index_desc->dtype();
+        CHECK_DTYPE(index_dtype, INFINI_DTYPE_I32, INFINI_DTYPE_I64);
+
+        auto target_shape = target_desc->shape();
+        auto source_shape = source_desc->shape();
+        size_t ndim = target_shape.size();
+        if (dim < 0 || size_t(dim) >= ndim) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        if (source_shape.size() != ndim) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        for (size_t d = 0; d < ndim; ++d) {
+            if (d != size_t(dim) && target_shape[d] != source_shape[d]) {
+                return INFINI_STATUS_BAD_TENSOR_SHAPE;
+            }
+        }
+        // index is a vector (or a scalar) with one entry per source slice
+        if (index_desc->ndim() > 1 || index_desc->numel() != source_shape[dim]) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+
+        auto target_strides = target_desc->strides();
+        auto source_strides = source_desc->strides();
+
+        IndexCopyInplaceInfo info;
+        info.dtype = dtype;
+        info.index_dtype = index_dtype;
+        info.dim = size_t(dim);
+        info.num_indices = source_shape[dim];
+        info.target_dim_size = target_shape[dim];
+        info.index_stride = index_desc->ndim() == 1 ? index_desc->stride(0) : 0;
+        info.target_stride_dim = target_strides[dim];
+        info.source_stride_dim = source_strides[dim];
+        for (size_t d = 0; d < ndim; ++d) {
+            if (d != size_t(dim)) {
+                info.slice_shape.push_back(target_shape[d]);
+                info.slice_target_strides.push_back(target_strides[d]);
+                info.slice_source_strides.push_back(source_strides[d]);
+            }
+        }
+
+        return utils::Result<IndexCopyInplaceInfo>(info);
+    }
+};
+
+} // namespace op::index_copy_inplace
+
+#endif // __INDEX_COPY_INPLACE_INFO_H__
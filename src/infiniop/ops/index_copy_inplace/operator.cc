@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/index_copy_inplace.h"
 #include <cstdio>
 
@@ -26,6 +29,7 @@ __C infiniStatus_t infiniopCreateIndexCopyInplaceDescriptor(
     infiniopTensorDescriptor_t source,
     int dim,
     infiniopTensorDescriptor_t index) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateIndexCopyInplaceDescriptor, infiniopDestroyIndexCopyInplaceDescriptor, handle, desc_ptr, target, source, dim, index);
 
     if (desc_ptr == nullptr) {
         return INFINI_STATUS_NULL_POINTER;
@@ -114,16 +118,18 @@ __C infiniStatus_t infiniopIndexCopyInplace(
     const void *source,
     const void *index,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopIndexCopyInplace, desc, workspace, workspace_size, target, source, index, stream);
+    INFINIOP_TRACE(infiniopIndexCopyInplace, desc, workspace_size);
 
 
     if (!desc) {
         return INFINI_STATUS_BAD_PARAM;
     }
 
-#define CALCULATE(CASE, NAMESPACE)                                                         \
-    case CASE:                                                                             \
-        return reinterpret_cast<op::index_copy_inplace::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, target, source, index, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                     \
+    case CASE:                                                                                                         \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::index_copy_inplace::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, target, source, index, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -154,6 +160,7 @@ __C infiniStatus_t infiniopIndexCopyInplace(
 
 __C infiniStatus_t
 infiniopDestroyIndexCopyInplaceDescriptor(infiniopIndexCopyInplaceDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                                           \
     case CASE:                                                                             \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/layer_norm.h"
 
 #ifdef ENABLE_CPU_API
@@ -31,6 +34,8 @@ __C infiniStatus_t infiniopCreateLayerNormDescriptor(
     infiniopTensorDescriptor_t input_std_deviation_desc,
     infiniopTensorDescriptor_t input_standardization_desc,
     float eps) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateLayerNormDescriptor, infiniopDestroyLayerNormDescriptor, handle, desc_ptr, output_desc, input_desc, weight_desc, bias_desc, input_std_deviation_desc, input_standardization_desc, eps);
+
     
     if (!handle || !desc_ptr || !output_desc || !input_desc || 
         !weight_desc || !input_std_deviation_desc || !input_standardization_desc) {
@@ -157,16 +162,19 @@ __C infiniStatus_t infiniopLayerNorm(
     void *input_std_deviation,
     void *input_standardization,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopLayerNorm, desc, workspace, workspace_size, output, input, weight, bias, input_std_deviation, input_standardization, stream);
+    INFINIOP_TRACE(infiniopLayerNorm, desc, workspace_size);
+
     
     if (!desc || !output || !input || !weight || !input_std_deviation || !input_standardization) {
         return INFINI_STATUS_BAD_PARAM;
     }
     
-#define CALCULATE(CASE, NAMESPACE) \
-    case CASE: \
-        return reinterpret_cast<op::layer_norm::NAMESPACE::Descriptor*>(desc)->calculate( \
-            workspace, workspace_size, output, input, weight, bias, \
-            input_std_deviation, input_standardization, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                            \
+    case CASE:                                                                                                \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::layer_norm::NAMESPACE::Descriptor*>(desc)->calculate( \
+            workspace, workspace_size, output, input, weight, bias,                                           \
+            input_std_deviation, input_standardization, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -180,27 +188,27 @@ __C infiniStatus_t infiniopLayerNorm(
 #endif
 #ifdef ENABLE_ASCEND_API
         case INFINI_DEVICE_ASCEND:
-            return reinterpret_cast<op::layer_norm::ascend::Descriptor *>(desc)->calculate(
+            return INFINIOP_GRAPH_CALL(reinterpret_cast<op::layer_norm::ascend::Descriptor *>(desc)->calculate(
                 workspace, workspace_size, output, input, weight, bias,
-                input_std_deviation, input_standardization, stream);
+                input_std_deviation, input_standardization, stream));
 #endif
 #ifdef ENABLE_METAX_API
         case INFINI_DEVICE_METAX:
-            return reinterpret_cast<op::layer_norm::metax::Descriptor *>(desc)->calculate(
+            return INFINIOP_GRAPH_CALL(reinterpret_cast<op::layer_norm::metax::Descriptor *>(desc)->calculate(
                 workspace, workspace_size, output, input, weight, bias,
-                input_std_deviation, input_standardization, stream);
+                input_std_deviation, input_standardization, stream));
 #endif
 #ifdef ENABLE_MOORE_API
         case INFINI_DEVICE_MOORE:
-            return reinterpret_cast<op::layer_norm::musa::Descriptor *>(desc)->calculate(
+            return INFINIOP_GRAPH_CALL(reinterpret_cast<op::layer_norm::musa::Descriptor *>(desc)->calculate(
                 workspace, workspace_size, output, input, weight, bias,
-                input_std_deviation, input_standardization, stream);
+                input_std_deviation, input_standardization, stream));
 #endif
 #ifdef ENABLE_KUNLUN_API
         case INFINI_DEVICE_KUNLUN:
-            return reinterpret_cast<op::layer_norm::kunlun::Descriptor *>(desc)->calculate(
+            return INFINIOP_GRAPH_CALL(reinterpret_cast<op::layer_norm::kunlun::Descriptor *>(desc)->calculate(
                 workspace, workspace_size, output, input, weight, bias,
-                input_std_deviation, input_standardization, stream);
+                input_std_deviation, input_standardization, stream));
 #endif
     }
 
@@ -211,6 +219,8 @@ __C infiniStatus_t infiniopLayerNorm(
 
 __C infiniStatus_t infiniopDestroyLayerNormDescriptor(
     infiniopLayerNormDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
     
     if (!desc) {
         return INFINI_STATUS_BAD_PARAM;
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/layer_norm_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -33,6 +36,8 @@ __C infiniStatus_t infiniopCreateLayerNormBackwardDescriptor(
     infiniopTensorDescriptor_t input_std_deviation_desc,
     infiniopTensorDescriptor_t input_standardization_desc,
     float eps) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateLayerNormBackwardDescriptor, infiniopDestroyLayerNormBackwardDescriptor, handle, desc_ptr, input_grad_desc, weight_grad_desc, bias_grad_desc, output_grad_desc, input_desc, weight_desc, input_std_deviation_desc, input_standardization_desc, eps);
+
     
     if (!handle || !desc_ptr || !input_grad_desc || !output_grad_desc || !input_desc || 
         !weight_desc || !input_std_deviation_desc || !input_standardization_desc) {
@@ -159,6 +164,9 @@ __C infiniStatus_t infiniopLayerNormBackward(
     const void *input_std_deviation,
     const void *input_standardization,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopLayerNormBackward, desc, workspace, workspace_size, input_grad, weight_grad, bias_grad, output_grad, input, weight, input_std_deviation, input_standardization, stream);
+    INFINIOP_TRACE(infiniopLayerNormBackward, desc, workspace_size);
+
     
     if (!desc || !input_grad || !output_grad || !input || !weight || 
         !input_std_deviation || !input_standardization) {
@@ -167,11 +175,11 @@ __C infiniStatus_t infiniopLayerNormBackward(
     
     auto descriptor = reinterpret_cast<InfiniopDescriptor*>(desc);
     
-#define CALCULATE(CASE, NAMESPACE) \
-    case CASE: \
-        return reinterpret_cast<op::layer_norm_backward::NAMESPACE::Descriptor*>(desc)->calculate( \
-            workspace, workspace_size, input_grad, weight_grad, bias_grad, \
-            output_grad, input, weight, input_std_deviation, input_standardization, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                     \
+    case CASE:                                                                                                         \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::layer_norm_backward::NAMESPACE::Descriptor*>(desc)->calculate( \
+            workspace, workspace_size, input_grad, weight_grad, bias_grad,                                             \
+            output_grad, input, weight, input_std_deviation, input_standardization, stream))
 
     switch (descriptor->device_type) {
 #ifdef ENABLE_CPU_API
@@ -204,6 +212,8 @@ __C infiniStatus_t infiniopLayerNormBackward(
 
 __C infiniStatus_t infiniopDestroyLayerNormBackwardDescriptor(
     infiniopLayerNormBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
     
     if (!desc) {
         return INFINI_STATUS_BAD_PARAM;
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/leaky_relu.h"
 
 #ifdef ENABLE_CPU_API
@@ -20,6 +23,7 @@ __C infiniStatus_t infiniopCreateLeakyReLUDescriptor(
     infiniopTensorDescriptor_t y_desc,
     infiniopTensorDescriptor_t x_desc,
     float negative_slope) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateLeakyReLUDescriptor, infiniopDestroyLeakyReLUDescriptor, handle, desc_ptr, y_desc, x_desc, negative_slope);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -89,11 +93,13 @@ __C infiniStatus_t infiniopLeakyReLU(
     void *y,
     const void *x,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopLeakyReLU, desc, workspace, workspace_size, y, x, stream);
+    INFINIOP_TRACE(infiniopLeakyReLU, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::leaky_relu::NAMESPACE::Descriptor *>(desc)  \
-            ->calculate(workspace, workspace_size, y, {x}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                       \
+    case CASE:                                                                                           \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::leaky_relu::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, {x}, stream))
 
     switch (desc->device_type) {
 
@@ -120,6 +126,7 @@ __C infiniStatus_t infiniopLeakyReLU(
 }
 
 __C infiniStatus_t infiniopDestroyLeakyReLUDescriptor(infiniopLeakyReLUDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
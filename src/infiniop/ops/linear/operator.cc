@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/linear.h"
 
 #ifdef ENABLE_CPU_API
@@ -25,6 +28,7 @@ __C infiniStatus_t infiniopCreateLinearDescriptor(
     infiniopTensorDescriptor_t w_desc,
     infiniopTensorDescriptor_t b_desc,
     infiniopTensorDescriptor_t y_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateLinearDescriptor, infiniopDestroyLinearDescriptor, handle, desc_ptr, x_desc, w_desc, b_desc, y_desc);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -107,11 +111,13 @@ __C infiniStatus_t infiniopLinear(
     const void *w,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopLinear, desc, workspace, workspace_size, y, x, w, b, stream);
+    INFINIOP_TRACE(infiniopLinear, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                     \
-    case CASE:                                                                         \
-        return reinterpret_cast<op::linear::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, y, x, w, b, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                         \
+    case CASE:                                                                                             \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::linear::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, y, x, w, b, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -140,6 +146,7 @@ __C infiniStatus_t infiniopLinear(
 
 __C infiniStatus_t
 infiniopDestroyLinearDescriptor(infiniopLinearDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
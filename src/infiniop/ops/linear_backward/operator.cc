@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/linear_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -27,6 +30,7 @@ __C infiniStatus_t infiniopCreateLinearBackwardDescriptor(
     infiniopTensorDescriptor_t grad_x_desc,
     infiniopTensorDescriptor_t grad_w_desc,
     infiniopTensorDescriptor_t grad_b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateLinearBackwardDescriptor, infiniopDestroyLinearBackwardDescriptor, handle, desc_ptr, grad_y_desc, x_desc, w_desc, grad_x_desc, grad_w_desc, grad_b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -113,11 +117,13 @@ __C infiniStatus_t infiniopLinearBackward(
     const void *x,
     const void *w,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopLinearBackward, desc, workspace, workspace_size, grad_x, grad_w, grad_b, grad_y, x, w, stream);
+    INFINIOP_TRACE(infiniopLinearBackward, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                     \
-    case CASE:                                                                         \
-        return reinterpret_cast<op::linear_backward::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, grad_x, grad_w, grad_b, grad_y, x, w, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                  \
+    case CASE:                                                                                                      \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::linear_backward::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, grad_x, grad_w, grad_b, grad_y, x, w, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -146,6 +152,7 @@ __C infiniStatus_t infiniopLinearBackward(
 
 __C infiniStatus_t
 infiniopDestroyLinearBackwardDescriptor(infiniopLinearBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
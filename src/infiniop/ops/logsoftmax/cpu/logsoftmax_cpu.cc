@@ -1,12 +1,19 @@
 #include "logsoftmax_cpu.h"
 #include "../../../devices/cpu/common_cpu.h"
-#include "../../../reduce/cpu/reduce.h"
-#include <algorithm>
-#include <cmath>
+#include "../../../reduce/cpu/softmax.h"
 
 namespace op::logsoftmax::cpu {
 
-Descriptor::~Descriptor() {}
+using namespace op::common_cpu::softmax_op;
+
+struct Descriptor::Opaque {
+    // number of ranges each row is split into
+    size_t parts;
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
 
 infiniStatus_t Descriptor::create(
     infiniopHandle_t handle,
@@ -15,72 +22,44 @@ infiniStatus_t Descriptor::create(
     infiniopTensorDescriptor_t x_desc) {
     auto result = LogSoftmaxInfo::create(y_desc, x_desc);
     CHECK_RESULT(result);
-    *desc_ptr = new Descriptor(nullptr, result.take(), 0, handle->device, handle->device_id);
+    auto info = result.take();
+
+    size_t parts = splitCount(info.batch_size, info.probs_size);
+    size_t workspace_size = parts > 1 ? info.batch_size * parts * sizeof(Stats) : 0;
+
+    *desc_ptr = new Descriptor(new Opaque{parts}, info, workspace_size, handle->device, handle->device_id);
     return INFINI_STATUS_SUCCESS;
 }
 
 template <typename Tx, typename Ty>
-infiniStatus_t logsoftmax(const LogSoftmaxInfo *info, Ty *y, const Tx *x) {
-#pragma omp parallel for
-    for (ptrdiff_t batch = 0; batch < ptrdiff_t(info->batch_size); batch++) {
-        ptrdiff_t y_offset, x_offset;
+infiniStatus_t logsoftmax(const LogSoftmaxInfo *info, size_t parts, Stats *partial, Ty *y, const Tx *x) {
+    bool parallel = info->batch_size * info->probs_size >= SOFTMAX_PARALLEL_MIN;
 
+    auto offsets = [info](size_t batch) {
         if (info->ndim == 3) {
             // For 3D tensors, convert linear batch index back to 2D indices
             ptrdiff_t batch_idx = batch / info->seq_len;
             ptrdiff_t seq_idx = batch % info->seq_len;
-            y_offset = batch_idx * info->y_stride_0 + seq_idx * info->y_stride_1;
-            x_offset = batch_idx * info->x_stride_0 + seq_idx * info->x_stride_1;
-        } else {
-            // For 2D tensors, use the flattened strides
-            y_offset = batch * info->y_stride_b;
-            x_offset = batch * info->x_stride_b;
-        }
-
-        Ty *y_ = y + y_offset;
-        const Tx *x_ = x + x_offset;
-
-        // Find max value for numerical stability
-        float max_val;
-        if constexpr (std::is_same<Tx, fp16_t>::value || std::is_same<Tx, bf16_t>::value) {
-            max_val = op::common_cpu::reduce_op::max(x_, info->probs_size, info->x_stride_p);
-        } else {
-            max_val = op::common_cpu::reduce_op::max(x_, info->probs_size, info->x_stride_p);
+            return std::make_pair(batch_idx * info->y_stride_0 + seq_idx * info->y_stride_1,
+                                  batch_idx * info->x_stride_0 + seq_idx * info->x_stride_1);
         }
-
-        // Compute exp(x - max) and sum
-        float sum = 0.0f;
-        for (size_t i = 0; i < info->probs_size; i++) {
-            float x_val;
-            if constexpr (std::is_same<Tx, fp16_t>::value || std::is_same<Tx, bf16_t>::value) {
-                x_val = utils::cast<float>(x_[i * info->x_stride_p]);
-            } else {
-                x_val = x_[i * info->x_stride_p];
-            }
-            sum += std::exp(x_val - max_val);
-        }
-
-        // Compute log(sum)
-        float log_sum = std::log(sum);
-
-        // Compute log_softmax = x - max - log(sum)
-        for (size_t i = 0; i < info->probs_size; i++) {
-            float x_val;
-            if constexpr (std::is_same<Tx, fp16_t>::value || std::is_same<Tx, bf16_t>::value) {
-                x_val = utils::cast<float>(x_[i * info->x_stride_p]);
-            } else {
-                x_val = x_[i * info->x_stride_p];
-            }
-
-            float result = x_val - max_val - log_sum;
-
-            if constexpr (std::is_same<Ty, fp16_t>::value || std::is_same<Ty, bf16_t>::value) {
-                y_[i * info->y_stride_p] = utils::cast<Ty>(result);
-            } else {
-                y_[i * info->y_stride_p] = result;
-            }
-        }
-    }
+        // For 2D tensors, use the flattened strides
+        return std::make_pair(ptrdiff_t(batch) * info->y_stride_b, ptrdiff_t(batch) * info->x_stride_b);
+    };
+
+    rowwise(
+        info->batch_size, parts, parallel, partial,
+        [&](size_t batch, size_t part) {
+            auto [begin, end] = partRange(info->probs_size, part, parts);
+            const Tx *x_ = x + offsets(batch).second + ptrdiff_t(begin) * info->x_stride_p;
+            return stats(x_, end - begin, info->x_stride_p);
+        },
+        [&](size_t batch, size_t part, Stats s) {
+            auto [begin, end] = partRange(info->probs_size, part, parts);
+            auto [y_offset, x_offset] = offsets(batch);
+            writeLogSoftmax(y + y_offset + ptrdiff_t(begin) * info->y_stride_p, info->y_stride_p,
+                            x + x_offset + ptrdiff_t(begin) * info->x_stride_p, info->x_stride_p, end - begin, s);
+        });
 
     return INFINI_STATUS_SUCCESS;
 }
@@ -91,34 +70,40 @@ infiniStatus_t Descriptor::calculate(
     const void *x,
     void *stream) const {
 
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    size_t parts = _opaque->parts;
+    auto partial = reinterpret_cast<Stats *>(workspace);
+
     // Handle different input/output dtype combinations
     if (_info.x_dtype == INFINI_DTYPE_F16) {
         if (_info.y_dtype == INFINI_DTYPE_F16) {
-            return logsoftmax<fp16_t, fp16_t>(&_info, (fp16_t *)y, (const fp16_t *)x);
+            return logsoftmax<fp16_t, fp16_t>(&_info, parts, partial, (fp16_t *)y, (const fp16_t *)x);
         } else if (_info.y_dtype == INFINI_DTYPE_BF16) {
-            return logsoftmax<fp16_t, bf16_t>(&_info, (bf16_t *)y, (const fp16_t *)x);
+            return logsoftmax<fp16_t, bf16_t>(&_info, parts, partial, (bf16_t *)y, (const fp16_t *)x);
         } else if (_info.y_dtype == INFINI_DTYPE_F32) {
-            return logsoftmax<fp16_t, float>(&_info, (float *)y, (const fp16_t *)x);
+            return logsoftmax<fp16_t, float>(&_info, parts, partial, (float *)y, (const fp16_t *)x);
         } else {
             return INFINI_STATUS_BAD_TENSOR_DTYPE;
         }
     } else if (_info.x_dtype == INFINI_DTYPE_BF16) {
         if (_info.y_dtype == INFINI_DTYPE_F16) {
-            return logsoftmax<bf16_t, fp16_t>(&_info, (fp16_t *)y, (const bf16_t *)x);
+            return logsoftmax<bf16_t, fp16_t>(&_info, parts, partial, (fp16_t *)y, (const bf16_t *)x);
         } else if (_info.y_dtype == INFINI_DTYPE_BF16) {
-            return logsoftmax<bf16_t, bf16_t>(&_info, (bf16_t *)y, (const bf16_t *)x);
+            return logsoftmax<bf16_t, bf16_t>(&_info, parts, partial, (bf16_t *)y, (const bf16_t *)x);
         } else if (_info.y_dtype == INFINI_DTYPE_F32) {
-            return logsoftmax<bf16_t, float>(&_info, (float *)y, (const bf16_t *)x);
+            return logsoftmax<bf16_t, float>(&_info, parts, partial, (float *)y, (const bf16_t *)x);
         } else {
             return INFINI_STATUS_BAD_TENSOR_DTYPE;
         }
     } else if (_info.x_dtype == INFINI_DTYPE_F32) {
         if (_info.y_dtype == INFINI_DTYPE_F16) {
-            return logsoftmax<float, fp16_t>(&_info, (fp16_t *)y, (const float *)x);
+            return logsoftmax<float, fp16_t>(&_info, parts, partial, (fp16_t *)y, (const float *)x);
         } else if (_info.y_dtype == INFINI_DTYPE_BF16) {
-            return logsoftmax<float, bf16_t>(&_info, (bf16_t *)y, (const float *)x);
+            return logsoftmax<float, bf16_t>(&_info, parts, partial, (bf16_t *)y, (const float *)x);
         } else if (_info.y_dtype == INFINI_DTYPE_F32) {
-            return logsoftmax<float, float>(&_info, (float *)y, (const float *)x);
+            return logsoftmax<float, float>(&_info, parts, partial, (float *)y, (const float *)x);
         } else {
             return INFINI_STATUS_BAD_TENSOR_DTYPE;
         }
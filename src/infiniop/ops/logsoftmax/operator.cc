@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/logsoftmax.h"
 
 #ifdef ENABLE_CPU_API
@@ -20,6 +23,7 @@ __C infiniStatus_t infiniopCreateLogSoftmaxDescriptor(
     infiniopLogSoftmaxDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t y_desc,
     infiniopTensorDescriptor_t x_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateLogSoftmaxDescriptor, infiniopDestroyLogSoftmaxDescriptor, handle, desc_ptr, y_desc, x_desc);
 
 #define CREATE(CASE, NAMESPACE)                                                   \
     case CASE:                                                                    \
@@ -82,11 +86,13 @@ __C infiniStatus_t infiniopLogSoftmax(
     void *y,
     const void *x,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopLogSoftmax, desc, workspace, workspace_size, y, x, stream);
+    INFINIOP_TRACE(infiniopLogSoftmax, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                         \
-    case CASE:                                                                             \
-        return reinterpret_cast<op::logsoftmax::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, y, x, stream);
+#define CALCULATE(CASE, NAMESPACE)                                                                             \
+    case CASE:                                                                                                 \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::logsoftmax::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, y, x, stream));
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -109,6 +115,7 @@ __C infiniStatus_t infiniopLogSoftmax(
 }
 
 __C infiniStatus_t infiniopDestroyLogSoftmaxDescriptor(infiniopLogSoftmaxDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                                \
     case CASE:                                                                  \
@@ -0,0 +1,201 @@
+#include "mlp_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../gemm/cpu/kernel.h"
+#include "../../swiglu/cpu/swiglu_cpu.h"
+
+namespace op::mlp::cpu {
+
+using op::gemm::cpu::accumulateTile;
+using op::gemm::cpu::packSize;
+using op::gemm::cpu::TILE_M;
+using op::gemm::cpu::TILE_N;
+
+struct Descriptor::Opaque {
+    // number of parts the intermediate dimension is split into for each token tile
+    size_t splits;
+    // number of threads the workspace is sized for
+    size_t num_threads;
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+// floats of private scratch used by one thread: gate tile, up tile, packed panel and one row tile of y
+static size_t threadScratchSize(size_t hidden) {
+    return 2 * TILE_M * TILE_N + packSize(TILE_N) + TILE_M * hidden;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t w_gate_up_desc,
+    infiniopTensorDescriptor_t w_down_desc) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = MLPInfo::create(y_desc, x_desc, w_gate_up_desc, w_down_desc);
+    CHECK_RESULT(result);
+    auto info = result.take();
+
+    // With few token tiles (decode), split the intermediate dimension so all threads get work.
+    // Each split then accumulates into its own partial y tile, which are summed afterwards.
+    size_t num_threads = op::common_cpu::getMaxThreads();
+    size_t m_tiles = CEIL_DIV(info.ntok, TILE_M);
+    size_t n_tiles = CEIL_DIV(info.inter, TILE_N);
+    size_t splits = std::max<size_t>(1, std::min(num_threads / std::max<size_t>(m_tiles, 1), n_tiles));
+
+    size_t partial_size = splits > 1 ? m_tiles * splits * TILE_M * info.hidden : 0;
+    size_t workspace_size = (partial_size + num_threads * threadScratchSize(info.hidden)) * sizeof(float);
+
+    *desc_ptr = new Descriptor(
+        info,
+        workspace_size,
+        new Opaque{splits, num_threads},
+        handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+template <typename Tdata>
+void calculate(
+    const MLPInfo &info,
+    size_t splits,
+    size_t num_threads,
+    float *workspace,
+    Tdata *y,
+    const Tdata *x,
+    const Tdata *w_gate_up,
+    const Tdata *w_down) {
+
+    const size_t m_tiles = CEIL_DIV(info.ntok, TILE_M);
+    const size_t inter_per_split = CEIL_DIV(CEIL_DIV(info.inter, TILE_N), splits) * TILE_N;
+    const size_t scratch_size = threadScratchSize(info.hidden);
+    float *partial = workspace;
+    float *scratch_base = workspace + (splits > 1 ? m_tiles * splits * TILE_M * info.hidden : 0);
+
+    auto store_row = [&](Tdata *dst, const float *src) {
+        for (size_t c = 0; c < info.hidden; ++c) {
+            dst[c * info.y_stride_hidden] = utils::cast<Tdata>(src[c]);
+        }
+    };
+
+    // never more than the workspace holds scratch for, fewer when a graph launch shares the team
+#pragma omp parallel num_threads(int(std::min(num_threads, op::common_cpu::getMaxThreads())))
+    {
+        float *scratch = scratch_base + op::common_cpu::getThreadId() * scratch_size;
+        float *gate = scratch;
+        float *up = gate + TILE_M * TILE_N;
+        float *pack = up + TILE_M * TILE_N;
+        float *y_tile = pack + packSize(TILE_N);
+
+#pragma omp for schedule(static)
+        for (ptrdiff_t item = 0; item < ptrdiff_t(m_tiles * splits); ++item) {
+            size_t m0 = size_t(item) / splits * TILE_M;
+            size_t split = size_t(item) % splits;
+            size_t mb = std::min(TILE_M, info.ntok - m0);
+            size_t j_begin = split * inter_per_split;
+            size_t j_end = std::min(info.inter, j_begin + inter_per_split);
+            float *y_acc = splits > 1 ? partial + size_t(item) * TILE_M * info.hidden : y_tile;
+            const Tdata *x_rows = x + m0 * info.x_stride_tok;
+
+            std::fill(y_acc, y_acc + mb * info.hidden, 0.0f);
+
+            for (size_t j0 = j_begin; j0 < j_end; j0 += TILE_N) {
+                size_t nb = std::min(TILE_N, j_end - j0);
+
+                // gate and up tiles come from the same concatenated weight
+                std::fill(gate, gate + TILE_M * TILE_N, 0.0f);
+                std::fill(up, up + TILE_M * TILE_N, 0.0f);
+                accumulateTile(gate, TILE_N, mb, nb, info.hidden,
+                               x_rows, info.x_stride_tok, info.x_stride_hidden,
+                               w_gate_up + j0 * info.w_gate_up_stride_col,
+                               info.w_gate_up_stride_row, info.w_gate_up_stride_col,
+                               pack);
+                accumulateTile(up, TILE_N, mb, nb, info.hidden,
+                               x_rows, info.x_stride_tok, info.x_stride_hidden,
+                               w_gate_up + (info.inter + j0) * info.w_gate_up_stride_col,
+                               info.w_gate_up_stride_row, info.w_gate_up_stride_col,
+                               pack);
+
+                // SwiGLU epilogue, the activation tile overwrites the gate tile
+                for (size_t i = 0; i < mb; ++i) {
+                    for (size_t j = 0; j < nb; ++j) {
+                        gate[i * TILE_N + j] = op::swiglu::cpu::SwiGLUOp{}(up[i * TILE_N + j], gate[i * TILE_N + j]);
+                    }
+                }
+
+                // stream the activation tile into the down projection
+                for (size_t c0 = 0; c0 < info.hidden; c0 += TILE_N) {
+                    size_t cb = std::min(TILE_N, info.hidden - c0);
+                    accumulateTile(y_acc + c0, info.hidden, mb, cb, nb,
+                                   gate, ptrdiff_t(TILE_N), ptrdiff_t(1),
+                                   w_down + j0 * info.w_down_stride_row + c0 * info.w_down_stride_col,
+                                   info.w_down_stride_row, info.w_down_stride_col,
+                                   pack);
+                }
+            }
+
+            if (splits == 1) {
+                for (size_t i = 0; i < mb; ++i) {
+                    store_row(y + (m0 + i) * info.y_stride_tok, y_acc + i * info.hidden);
+                }
+            }
+        }
+
+        if (splits > 1) {
+            // sum the partial results of all splits into y
+#pragma omp for schedule(static)
+            for (ptrdiff_t tok = 0; tok < ptrdiff_t(info.ntok); ++tok) {
+                size_t m_tile = size_t(tok) / TILE_M, i = size_t(tok) % TILE_M;
+                float *row = y_tile;
+                std::fill(row, row + info.hidden, 0.0f);
+                for (size_t split = 0; split < splits; ++split) {
+                    const float *src = partial + ((m_tile * splits + split) * TILE_M + i) * info.hidden;
+                    for (size_t c = 0; c < info.hidden; ++c) {
+                        row[c] += src[c];
+                    }
+                }
+                store_row(y + tok * info.y_stride_tok, row);
+            }
+        }
+    }
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    const void *w_gate_up,
+    const void *w_down,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+#define CALCULATE(TDATA)                                                   \
+    cpu::calculate<TDATA>(_info, _opaque->splits, _opaque->num_threads,    \
+                          reinterpret_cast<float *>(workspace),            \
+                          reinterpret_cast<TDATA *>(y),                    \
+                          reinterpret_cast<const TDATA *>(x),              \
+                          reinterpret_cast<const TDATA *>(w_gate_up),      \
+                          reinterpret_cast<const TDATA *>(w_down));        \
+    return INFINI_STATUS_SUCCESS
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        CALCULATE(fp16_t);
+    case INFINI_DTYPE_BF16:
+        CALCULATE(bf16_t);
+    case INFINI_DTYPE_F32:
+        CALCULATE(float);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+#undef CALCULATE
+}
+
+} // namespace op::mlp::cpu
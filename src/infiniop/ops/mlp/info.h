@@ -0,0 +1,75 @@
+#ifndef __MLP_INFO_H__
+#define __MLP_INFO_H__
+
+#include "../../../utils.h"
+#include "../../operator.h"
+#include "../../tensor.h"
+
+namespace op::mlp {
+
+class MLPInfo {
+    MLPInfo() = default;
+
+public:
+    infiniDtype_t dtype;
+    size_t ntok, hidden, inter;
+
+    ptrdiff_t y_stride_tok, y_stride_hidden;
+    ptrdiff_t x_stride_tok, x_stride_hidden;
+    ptrdiff_t w_gate_up_stride_row, w_gate_up_stride_col;
+    ptrdiff_t w_down_stride_row, w_down_stride_col;
+
+    static utils::Result<MLPInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        infiniopTensorDescriptor_t x_desc,
+        infiniopTensorDescriptor_t w_gate_up_desc,
+        infiniopTensorDescriptor_t w_down_desc) {
+
+        CHECK_OR_RETURN(y_desc != nullptr && x_desc != nullptr
+                            && w_gate_up_desc != nullptr && w_down_desc != nullptr,
+                        INFINI_STATUS_NULL_POINTER);
+
+        auto dtype = y_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        CHECK_OR_RETURN(x_desc->dtype() == dtype
+                            && w_gate_up_desc->dtype() == dtype
+                            && w_down_desc->dtype() == dtype,
+                        INFINI_STATUS_BAD_TENSOR_DTYPE);
+
+        CHECK_OR_RETURN(y_desc->ndim() == 2
+                            && x_desc->ndim() == 2
+                            && w_gate_up_desc->ndim() == 2
+                            && w_down_desc->ndim() == 2,
+                        INFINI_STATUS_BAD_TENSOR_SHAPE);
+
+        auto ntok = y_desc->dim(0),
+             hidden = y_desc->dim(1),
+             inter = w_down_desc->dim(0);
+
+        CHECK_OR_RETURN(x_desc->dim(0) == ntok && x_desc->dim(1) == hidden
+                            && w_gate_up_desc->dim(0) == hidden && w_gate_up_desc->dim(1) == 2 * inter
+                            && w_down_desc->dim(1) == hidden,
+                        INFINI_STATUS_BAD_TENSOR_SHAPE);
+
+        CHECK_OR_RETURN(!y_desc->hasBroadcastDim(), INFINI_STATUS_BAD_TENSOR_STRIDES);
+
+        return utils::Result<MLPInfo>(MLPInfo{
+            dtype,
+            ntok,
+            hidden,
+            inter,
+            y_desc->stride(0),
+            y_desc->stride(1),
+            x_desc->stride(0),
+            x_desc->stride(1),
+            w_gate_up_desc->stride(0),
+            w_gate_up_desc->stride(1),
+            w_down_desc->stride(0),
+            w_down_desc->stride(1),
+        });
+    }
+};
+
+} // namespace op::mlp
+
+#endif // __MLP_INFO_H__
@@ -0,0 +1,113 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
+#include "infiniop/ops/mlp.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/mlp_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateMLPDescriptor(
+    infiniopHandle_t handle,
+    infiniopMLPDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t w_gate_up_desc,
+    infiniopTensorDescriptor_t w_down_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateMLPDescriptor, infiniopDestroyMLPDescriptor, handle, desc_ptr, y_desc, x_desc, w_gate_up_desc, w_down_desc);
+
+#define CREATE(CASE, NAMESPACE)                                            \
+    case CASE:                                                             \
+        return op::mlp::NAMESPACE::Descriptor::create(                     \
+            handle,                                                        \
+            reinterpret_cast<op::mlp::NAMESPACE::Descriptor **>(desc_ptr), \
+            y_desc,                                                        \
+            x_desc,                                                        \
+            w_gate_up_desc,                                                \
+            w_down_desc)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetMLPWorkspaceSize(infiniopMLPDescriptor_t desc, size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                               \
+    case CASE:                                                                             \
+        *size = reinterpret_cast<op::mlp::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopMLP(
+    infiniopMLPDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    const void *w_gate_up,
+    const void *w_down,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopMLP, desc, workspace, workspace_size, y, x, w_gate_up, w_down, stream);
+    INFINIOP_TRACE(infiniopMLP, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                \
+    case CASE:                                                                                    \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::mlp::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, x, w_gate_up, w_down, stream))
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t infiniopDestroyMLPDescriptor(infiniopMLPDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
+#define DELETE(CASE, NAMESPACE)                                                \
+    case CASE:                                                                 \
+        delete reinterpret_cast<const op::mlp::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/mul.h"
 
 #ifdef ENABLE_CPU_API
@@ -21,6 +24,7 @@ __C infiniStatus_t infiniopCreateMulDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateMulDescriptor, infiniopDestroyMulDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -96,11 +100,13 @@ __C infiniStatus_t infiniopMul(
     const void *a,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopMul, desc, workspace, workspace_size, c, a, b, stream);
+    INFINIOP_TRACE(infiniopMul, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                            \
-    case CASE:                                                                \
-        return reinterpret_cast<const op::mul::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, c, {a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                \
+    case CASE:                                                                                    \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::mul::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, c, {a, b}, stream))
 
     switch (desc->device_type) {
 
@@ -129,6 +135,7 @@ __C infiniStatus_t infiniopMul(
 
 __C infiniStatus_t
 infiniopDestroyMulDescriptor(infiniopMulDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                \
     case CASE:                                                                 \
@@ -0,0 +1,207 @@
+#include "qkv_rope_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+#include "../../gemm/cpu/kernel.h"
+
+namespace op::qkv_rope::cpu {
+
+using op::gemm::cpu::accumulateTile;
+using op::gemm::cpu::packSize;
+using op::gemm::cpu::TILE_M;
+using op::gemm::cpu::TILE_N;
+using op::gemm::cpu::toFloat;
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t q_desc,
+    infiniopTensorDescriptor_t k_cache_desc,
+    infiniopTensorDescriptor_t v_cache_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t w_qkv_desc,
+    infiniopTensorDescriptor_t b_qkv_desc,
+    infiniopTensorDescriptor_t pos_ids_desc,
+    infiniopTensorDescriptor_t sin_table_desc,
+    infiniopTensorDescriptor_t cos_table_desc) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto info = QKVRoPEInfo::create(q_desc, k_cache_desc, v_cache_desc,
+                                    x_desc, w_qkv_desc, b_qkv_desc,
+                                    pos_ids_desc, sin_table_desc, cos_table_desc);
+    CHECK_RESULT(info);
+
+    *desc_ptr = new Descriptor(
+        info.take(),
+        0,
+        nullptr,
+        handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+template <typename Tdata, typename Tindex>
+infiniStatus_t calculateQKVRoPE(
+    const QKVRoPEInfo &info,
+    Tdata *q,
+    Tdata *k_cache,
+    Tdata *v_cache,
+    const Tdata *x,
+    const Tdata *w_qkv,
+    const Tdata *b_qkv,
+    const Tindex *pos_ids,
+    const Tdata *sin_table,
+    const Tdata *cos_table,
+    size_t pos) {
+
+    // positions index the tables, they are checked before anything is written
+    for (size_t tok = 0; tok < info.ntok; ++tok) {
+        auto p = pos_ids[tok * info.pos_stride];
+        if (p < 0 || uint64_t(p) >= info.table_len) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+    }
+
+    // Column tiles never cross a head boundary and start at an even offset,
+    // so both elements of every rotary pair land in the same tile.
+    const size_t n_head = info.n_q_head + 2 * info.n_kv_head;
+    const size_t head_tiles = CEIL_DIV(info.dhead, TILE_N);
+    const size_t m_tiles = CEIL_DIV(info.ntok, TILE_M);
+    const ptrdiff_t num_tiles = ptrdiff_t(m_tiles * n_head * head_tiles);
+
+#pragma omp parallel
+    {
+        std::vector<float> acc(TILE_M * TILE_N);
+        std::vector<float> pack(packSize(TILE_N));
+
+#pragma omp for
+        for (ptrdiff_t tile = 0; tile < num_tiles; ++tile) {
+            size_t ind = tile;
+            size_t d0 = ind % head_tiles * TILE_N;
+            ind /= head_tiles;
+            size_t head = ind % n_head;
+            ind /= n_head;
+            size_t m0 = ind * TILE_M;
+            size_t mb = std::min(TILE_M, info.ntok - m0);
+            size_t nb = std::min(TILE_N, info.dhead - d0);
+            size_t col = head * info.dhead + d0;
+
+            std::fill(acc.begin(), acc.end(), 0.0f);
+            accumulateTile(acc.data(), TILE_N, mb, nb, info.hidden,
+                           x + m0 * info.x_stride_tok, info.x_stride_tok, info.x_stride_hidden,
+                           w_qkv + col * info.w_stride_col, info.w_stride_row, info.w_stride_col,
+                           pack.data());
+
+            // Epilogue: bias, rotary embedding for q/k, then scatter to q or the cache slots
+            bool is_q = head < info.n_q_head;
+            bool is_v = head >= info.n_q_head + info.n_kv_head;
+            for (size_t i = 0; i < mb; ++i) {
+                size_t tok = m0 + i;
+                float *row = acc.data() + i * TILE_N;
+
+                if (info.has_bias) {
+                    for (size_t j = 0; j < nb; ++j) {
+                        row[j] += toFloat(b_qkv[(col + j) * info.b_stride]);
+                    }
+                }
+
+                if (!is_v) {
+                    size_t table_offset = size_t(pos_ids[tok * info.pos_stride]) * info.table_dim + d0 / 2;
+                    for (size_t j = 0; j < nb; j += 2) {
+                        float x0 = row[j],
+                              x1 = row[j + 1],
+                              sin__ = toFloat(sin_table[table_offset + j / 2]),
+                              cos__ = toFloat(cos_table[table_offset + j / 2]);
+                        row[j] = x0 * cos__ - x1 * sin__;
+                        row[j + 1] = x0 * sin__ + x1 * cos__;
+                    }
+                }
+
+                Tdata *dst;
+                ptrdiff_t dst_stride;
+                if (is_q) {
+                    dst = q + tok * info.q_stride_tok + head * info.q_stride_head + d0 * info.q_stride_dim;
+                    dst_stride = info.q_stride_dim;
+                } else if (!is_v) {
+                    size_t kv_head = head - info.n_q_head;
+                    dst = k_cache + kv_head * info.k_stride_head + (pos + tok) * info.k_stride_slot + d0 * info.k_stride_dim;
+                    dst_stride = info.k_stride_dim;
+                } else {
+                    size_t kv_head = head - info.n_q_head - info.n_kv_head;
+                    dst = v_cache + kv_head * info.v_stride_head + (pos + tok) * info.v_stride_slot + d0 * info.v_stride_dim;
+                    dst_stride = info.v_stride_dim;
+                }
+                for (size_t j = 0; j < nb; ++j) {
+                    dst[j * dst_stride] = utils::cast<Tdata>(row[j]);
+                }
+            }
+        }
+    }
+
+    return INFINI_STATUS_SUCCESS;
+}
+
+#define CALCULATE_QKV_ROPE(TDATA, TINDEX)                                                    \
+    calculateQKVRoPE(_info, (TDATA *)q, (TDATA *)k_cache, (TDATA *)v_cache, (const TDATA *)x, \
+                     (const TDATA *)w_qkv, (const TDATA *)b_qkv, (const TINDEX *)pos_ids,     \
+                     (const TDATA *)sin_table, (const TDATA *)cos_table, pos)
+
+#define QKV_ROPE_TYPE(TDATA)                        \
+    switch (_info.pos_type) {                       \
+    case INFINI_DTYPE_U8:                           \
+        return CALCULATE_QKV_ROPE(TDATA, uint8_t);  \
+    case INFINI_DTYPE_U16:                          \
+        return CALCULATE_QKV_ROPE(TDATA, uint16_t); \
+    case INFINI_DTYPE_U32:                          \
+        return CALCULATE_QKV_ROPE(TDATA, uint32_t); \
+    case INFINI_DTYPE_U64:                          \
+        return CALCULATE_QKV_ROPE(TDATA, uint64_t); \
+    case INFINI_DTYPE_I8:                           \
+        return CALCULATE_QKV_ROPE(TDATA, int8_t);   \
+    case INFINI_DTYPE_I16:                          \
+        return CALCULATE_QKV_ROPE(TDATA, int16_t);  \
+    case INFINI_DTYPE_I32:                          \
+        return CALCULATE_QKV_ROPE(TDATA, int32_t);  \
+    case INFINI_DTYPE_I64:                          \
+        return CALCULATE_QKV_ROPE(TDATA, int64_t);  \
+    default:                                        \
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;      \
+    }
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *q,
+    void *k_cache,
+    void *v_cache,
+    const void *x,
+    const void *w_qkv,
+    const void *b_qkv,
+    const void *pos_ids,
+    const void *sin_table,
+    const void *cos_table,
+    size_t pos,
+    void *stream) const {
+
+    if (_info.has_bias && b_qkv == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (pos > _info.cache_len || _info.ntok > _info.cache_len - pos) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    switch (_info.data_type) {
+    case INFINI_DTYPE_F16:
+        QKV_ROPE_TYPE(fp16_t);
+    case INFINI_DTYPE_BF16:
+        QKV_ROPE_TYPE(bf16_t);
+    case INFINI_DTYPE_F32:
+        QKV_ROPE_TYPE(float);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+#undef QKV_ROPE_TYPE
+#undef CALCULATE_QKV_ROPE
+
+} // namespace op::qkv_rope::cpu
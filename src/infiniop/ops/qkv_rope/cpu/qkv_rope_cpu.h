@@ -0,0 +1,8 @@
+#ifndef __QKV_ROPE_CPU_H__
+#define __QKV_ROPE_CPU_H__
+
+#include "../qkv_rope.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __QKV_ROPE_CPU_H__
@@ -0,0 +1,118 @@
+#ifndef __QKV_ROPE_INFO_H__
+#define __QKV_ROPE_INFO_H__
+
+#include "../../../utils.h"
+#include "../../operator.h"
+#include "../../tensor.h"
+
+namespace op::qkv_rope {
+
+class QKVRoPEInfo {
+    QKVRoPEInfo() = default;
+
+public:
+    infiniDtype_t data_type, pos_type;
+    size_t ntok, hidden, n_q_head, n_kv_head, dhead, table_len, table_dim;
+    // slots of the smaller cache, a call writes `ntok` of them from its `pos`
+    size_t cache_len;
+    bool has_bias;
+
+    ptrdiff_t x_stride_tok, x_stride_hidden;
+    ptrdiff_t w_stride_row, w_stride_col;
+    ptrdiff_t b_stride;
+    ptrdiff_t q_stride_tok, q_stride_head, q_stride_dim;
+    ptrdiff_t k_stride_head, k_stride_slot, k_stride_dim;
+    ptrdiff_t v_stride_head, v_stride_slot, v_stride_dim;
+    ptrdiff_t pos_stride;
+
+    static utils::Result<QKVRoPEInfo> create(
+        infiniopTensorDescriptor_t q_desc,
+        infiniopTensorDescriptor_t k_cache_desc,
+        infiniopTensorDescriptor_t v_cache_desc,
+        infiniopTensorDescriptor_t x_desc,
+        infiniopTensorDescriptor_t w_qkv_desc,
+        infiniopTensorDescriptor_t b_qkv_desc,
+        infiniopTensorDescriptor_t pos_desc,
+        infiniopTensorDescriptor_t sin_desc,
+        infiniopTensorDescriptor_t cos_desc) {
+
+        CHECK_OR_RETURN(q_desc != nullptr && k_cache_desc != nullptr && v_cache_desc != nullptr
+                            && x_desc != nullptr && w_qkv_desc != nullptr && pos_desc != nullptr
+                            && sin_desc != nullptr && cos_desc != nullptr,
+                        INFINI_STATUS_NULL_POINTER);
+
+        const infiniDtype_t data_type = q_desc->dtype();
+        const infiniDtype_t pos_type = pos_desc->dtype();
+        CHECK_DTYPE(data_type, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        CHECK_DTYPE_ANY_INT(pos_type);
+        for (auto desc : {k_cache_desc, v_cache_desc, x_desc, w_qkv_desc, sin_desc, cos_desc}) {
+            CHECK_OR_RETURN(desc->dtype() == data_type, INFINI_STATUS_BAD_TENSOR_DTYPE);
+        }
+        CHECK_OR_RETURN(b_qkv_desc == nullptr || b_qkv_desc->dtype() == data_type, INFINI_STATUS_BAD_TENSOR_DTYPE);
+
+        CHECK_OR_RETURN(q_desc->ndim() == 3
+                            && k_cache_desc->ndim() == 3
+                            && v_cache_desc->ndim() == 3
+                            && x_desc->ndim() == 2
+                            && w_qkv_desc->ndim() == 2
+                            && (b_qkv_desc == nullptr || b_qkv_desc->ndim() == 1)
+                            && pos_desc->ndim() == 1
+                            && sin_desc->ndim() == 2
+                            && cos_desc->ndim() == 2,
+                        INFINI_STATUS_BAD_TENSOR_SHAPE);
+
+        const auto ntok = q_desc->dim(0),
+                   n_q_head = q_desc->dim(1),
+                   dhead = q_desc->dim(2),
+                   hidden = x_desc->dim(1),
+                   n_kv_head = k_cache_desc->dim(0),
+                   table_len = sin_desc->dim(0),
+                   table_dim = sin_desc->dim(1);
+        const auto qkv_dim = (n_q_head + 2 * n_kv_head) * dhead;
+
+        CHECK_OR_RETURN(x_desc->dim(0) == ntok
+                            && pos_desc->dim(0) == ntok
+                            && w_qkv_desc->dim(0) == hidden && w_qkv_desc->dim(1) == qkv_dim
+                            && (b_qkv_desc == nullptr || b_qkv_desc->dim(0) == qkv_dim)
+                            && k_cache_desc->dim(2) == dhead
+                            && v_cache_desc->dim(0) == n_kv_head && v_cache_desc->dim(2) == dhead
+                            && cos_desc->dim(0) == table_len && cos_desc->dim(1) == table_dim,
+                        INFINI_STATUS_BAD_TENSOR_SHAPE);
+        CHECK_OR_RETURN(dhead == table_dim * 2, INFINI_STATUS_BAD_TENSOR_SHAPE);
+        // sin table and cos table must be totally contiguous
+        CHECK_OR_RETURN(sin_desc->isContiguous() && cos_desc->isContiguous(), INFINI_STATUS_BAD_TENSOR_STRIDES);
+
+        return utils::Result<QKVRoPEInfo>(QKVRoPEInfo{
+            data_type,
+            pos_type,
+            ntok,
+            hidden,
+            n_q_head,
+            n_kv_head,
+            dhead,
+            table_len,
+            table_dim,
+            std::min(k_cache_desc->dim(1), v_cache_desc->dim(1)),
+            b_qkv_desc != nullptr,
+            x_desc->stride(0),
+            x_desc->stride(1),
+            w_qkv_desc->stride(0),
+            w_qkv_desc->stride(1),
+            b_qkv_desc == nullptr ? 0 : b_qkv_desc->stride(0),
+            q_desc->stride(0),
+            q_desc->stride(1),
+            q_desc->stride(2),
+            k_cache_desc->stride(0),
+            k_cache_desc->stride(1),
+            k_cache_desc->stride(2),
+            v_cache_desc->stride(0),
+            v_cache_desc->stride(1),
+            v_cache_desc->stride(2),
+            pos_desc->stride(0),
+        });
+    }
+};
+
+} // namespace op::qkv_rope
+
+#endif // __QKV_ROPE_INFO_H__
@@ -0,0 +1,133 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
+#include "infiniop/ops/qkv_rope.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/qkv_rope_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateQKVRoPEDescriptor(
+    infiniopHandle_t handle,
+    infiniopQKVRoPEDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t q_desc,
+    infiniopTensorDescriptor_t k_cache_desc,
+    infiniopTensorDescriptor_t v_cache_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t w_qkv_desc,
+    infiniopTensorDescriptor_t b_qkv_desc,
+    infiniopTensorDescriptor_t pos_ids_desc,
+    infiniopTensorDescriptor_t sin_table_desc,
+    infiniopTensorDescriptor_t cos_table_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateQKVRoPEDescriptor, infiniopDestroyQKVRoPEDescriptor, handle, desc_ptr, q_desc, k_cache_desc, v_cache_desc, x_desc, w_qkv_desc, b_qkv_desc, pos_ids_desc, sin_table_desc, cos_table_desc);
+
+#define CREATE(CASE, NAMESPACE)                                                 \
+    case CASE:                                                                  \
+        return op::qkv_rope::NAMESPACE::Descriptor::create(                     \
+            handle,                                                             \
+            reinterpret_cast<op::qkv_rope::NAMESPACE::Descriptor **>(desc_ptr), \
+            q_desc,                                                             \
+            k_cache_desc,                                                       \
+            v_cache_desc,                                                       \
+            x_desc,                                                             \
+            w_qkv_desc,                                                         \
+            b_qkv_desc,                                                         \
+            pos_ids_desc,                                                       \
+            sin_table_desc,                                                     \
+            cos_table_desc)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetQKVRoPEWorkspaceSize(infiniopQKVRoPEDescriptor_t desc, size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                    \
+    case CASE:                                                                                  \
+        *size = reinterpret_cast<op::qkv_rope::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopQKVRoPE(
+    infiniopQKVRoPEDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *q,
+    void *k_cache,
+    void *v_cache,
+    const void *x,
+    const void *w_qkv,
+    const void *b_qkv,
+    const void *pos_ids,
+    const void *sin_table,
+    const void *cos_table,
+    size_t pos,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopQKVRoPE, desc, workspace, workspace_size, q, k_cache, v_cache, x, w_qkv, b_qkv, pos_ids, sin_table, cos_table, pos, stream);
+    INFINIOP_TRACE(infiniopQKVRoPE, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                     \
+    case CASE:                                                                                         \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::qkv_rope::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                                     \
+                        q, k_cache, v_cache,                                                           \
+                        x, w_qkv, b_qkv,                                                               \
+                        pos_ids, sin_table, cos_table,                                                 \
+                        pos, stream))
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t infiniopDestroyQKVRoPEDescriptor(infiniopQKVRoPEDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
+#define DELETE(CASE, NAMESPACE)                                                     \
+    case CASE:                                                                      \
+        delete reinterpret_cast<const op::qkv_rope::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
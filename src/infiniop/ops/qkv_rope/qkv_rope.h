@@ -0,0 +1,61 @@
+#ifndef __QKV_ROPE_H__
+#define __QKV_ROPE_H__
+
+#include "../../operator.h"
+#include "info.h"
+
+#define DESCRIPTOR(NAMESPACE)                                    \
+                                                                 \
+    namespace op::qkv_rope::NAMESPACE {                          \
+    class Descriptor final : public InfiniopDescriptor {         \
+        struct Opaque;                                           \
+        Opaque *_opaque;                                         \
+        QKVRoPEInfo _info;                                       \
+        size_t _workspace_size;                                  \
+                                                                 \
+        Descriptor(                                              \
+            QKVRoPEInfo info,                                    \
+            size_t workspace_size_,                              \
+            Opaque *opaque,                                      \
+            infiniDevice_t device_type,                          \
+            int device_id)                                       \
+            : InfiniopDescriptor{device_type, device_id},        \
+              _opaque(opaque),                                   \
+              _info(info),                                       \
+              _workspace_size(workspace_size_) {}                \
+                                                                 \
+    public:                                                      \
+        ~Descriptor();                                           \
+                                                                 \
+        size_t workspaceSize() const { return _workspace_size; } \
+                                                                 \
+        static infiniStatus_t create(                            \
+            infiniopHandle_t handle,                             \
+            Descriptor **desc_ptr,                               \
+            infiniopTensorDescriptor_t q_desc,                   \
+            infiniopTensorDescriptor_t k_cache_desc,             \
+            infiniopTensorDescriptor_t v_cache_desc,             \
+            infiniopTensorDescriptor_t x_desc,                   \
+            infiniopTensorDescriptor_t w_qkv_desc,               \
+            infiniopTensorDescriptor_t b_qkv_desc,               \
+            infiniopTensorDescriptor_t pos_ids_desc,             \
+            infiniopTensorDescriptor_t sin_table_desc,           \
+            infiniopTensorDescriptor_t cos_table_desc);          \
+                                                                 \
+        infiniStatus_t calculate(                                \
+            void *workspace, size_t workspace_size,              \
+            void *q,                                             \
+            void *k_cache,                                       \
+            void *v_cache,                                       \
+            const void *x,                                       \
+            const void *w_qkv,                                   \
+            const void *b_qkv,                                   \
+            const void *pos_ids,                                 \
+            const void *sin_table,                               \
+            const void *cos_table,                               \
+            size_t pos,                                          \
+            void *stream) const;                                 \
+    };                                                           \
+    }
+
+#endif // __QKV_ROPE_H__
@@ -25,6 +25,8 @@ infiniStatus_t Descriptor::create(
     auto result = RandomSampleInfo::create(result_desc, probs_desc);
     CHECK_RESULT(result);
     CHECK_DTYPE(result->dt_i, INFINI_DTYPE_I64);
+    // batched requests are only implemented on CPU
+    CHECK_OR_RETURN(result->batch == 1, INFINI_STATUS_BAD_TENSOR_SHAPE);
     auto workspace_size = probs_desc->numel() * infiniSizeOf(probs_desc->dtype()) + probs_desc->numel() * infiniSizeOf(infiniDtype_t::INFINI_DTYPE_I64);
     auto tresult = new aclnnTensorDescriptor(result_desc);
     auto tprobs = new aclnnTensorDescriptor(probs_desc);
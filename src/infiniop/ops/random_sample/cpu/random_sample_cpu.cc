@@ -3,10 +3,47 @@
 #include "../info.h"
 #include "infinicore.h"
 #include <algorithm>
+#include <limits>
 
 namespace op::random_sample::cpu {
 
-Descriptor::~Descriptor() = default;
+struct Descriptor::Opaque {
+    // rows sampled concurrently, each owns one slot of the workspace
+    size_t num_slots;
+    // parts an argmax row is split into at most, the partial results share the workspace
+    size_t max_parts;
+};
+
+// one token of the sampling candidates
+struct Candidate {
+    float val;
+    uint32_t idx;
+};
+
+// an argmax row is only split when every part still has this many elements
+constexpr size_t MIN_PART = 16384;
+
+// parts each row of an argmax is split into: with fewer rows than threads, long rows are split
+// and the parts merged afterwards
+static size_t argmaxParts(size_t batch, size_t n) {
+    return std::max<size_t>(1, std::min(op::common_cpu::getMaxThreads() / batch, n / MIN_PART));
+}
+
+// Values in (0, 1] are bucketed by the top bits of their IEEE representation
+// (exponent and 3 mantissa bits), which preserves their order.
+constexpr size_t BUCKET_SHIFT = 20;
+constexpr size_t NUM_BUCKETS = 1024;
+
+// bytes of workspace used to sample one row of `n` tokens: the bucket histogram, then the
+// values and the candidates, rounded up to keep the next slot's histogram aligned
+static size_t slotSize(size_t n) {
+    return NUM_BUCKETS * (sizeof(double) + sizeof(size_t))
+         + CEIL_DIV(n * (sizeof(float) + sizeof(Candidate)), alignof(double)) * alignof(double);
+}
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
 
 infiniStatus_t Descriptor::create(
     infiniopHandle_t handle_,
@@ -17,11 +54,18 @@ infiniStatus_t Descriptor::create(
 
     auto result = RandomSampleInfo::create(result_desc, probs_desc);
     CHECK_RESULT(result);
+    auto info = result.take();
+    CHECK_OR_RETURN(info.n <= UINT32_MAX, INFINI_STATUS_BAD_TENSOR_SHAPE);
+
+    size_t num_slots = std::min(info.batch, op::common_cpu::getMaxThreads());
+    size_t max_parts = argmaxParts(info.batch, info.n);
+    // the partial maxima are at most pairs of an index and a double
+    size_t argmax_size = info.batch * max_parts * 2 * sizeof(double);
 
     *desc_ptr = new Descriptor(
-        result.take(),
-        0,
-        nullptr,
+        info,
+        std::max(num_slots * slotSize(info.n), argmax_size),
+        new Opaque{num_slots, max_parts},
         handle->device, handle->device_id);
     return INFINI_STATUS_SUCCESS;
 }
@@ -45,72 +89,245 @@ struct ComputeType<bf16_t> {
     using type = float;
 };
 
+inline size_t bucketOf(float val) {
+    uint32_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return std::min<size_t>(bits >> BUCKET_SHIFT, NUM_BUCKETS - 1);
+}
+
 struct Algo {
+    RandomSampleInfo info;
+    size_t num_slots, max_parts;
+    // per-row random values of a batched call, the scalar `random_val` is used when null
+    const float *random_vals;
+    float repetition_penalty, frequency_penalty;
+    const int *token_counts;
 
     template <class Tidx, class Tval>
     static auto get(void const *ptr, size_t i) {
         return utils::cast<typename ComputeType<Tval>::type, Tval>(reinterpret_cast<Tval const *>(ptr)[i]);
     }
 
+    template <class T>
+    T penalize(T val, int count) const {
+        if (count == 0) {
+            return val;
+        }
+        val = val > 0 ? val / T(repetition_penalty) : val * T(repetition_penalty);
+        return val - T(frequency_penalty) * T(count);
+    }
+
+    // position and value of the first maximum within a range of a row
+    template <class T>
+    struct ArgMax {
+        size_t idx;
+        T val;
+    };
+
+    /**
+     * First maximum of `row[begin, end)`. Elements are converted (and penalized) a block at a
+     * time into a local buffer, so the max search itself is a plain vectorizable reduction and
+     * the position is only looked up in blocks that raise the maximum.
+     */
+    template <class Tval>
+    ArgMax<typename ComputeType<Tval>::type> argmaxRange(
+        const Tval *row, const int *counts, size_t begin, size_t end) const {
+        using T = typename ComputeType<Tval>::type;
+        constexpr size_t BLOCK = 256;
+
+        ArgMax<T> best{begin, utils::cast<T>(row[begin])};
+        if (counts) {
+            best.val = penalize(best.val, counts[begin]);
+        }
+
+        T buf[BLOCK];
+        for (size_t i0 = begin; i0 < end; i0 += BLOCK) {
+            size_t len = std::min(BLOCK, end - i0);
+            for (size_t i = 0; i < len; i++) {
+                buf[i] = utils::cast<T>(row[i0 + i]);
+            }
+            if (counts) {
+                for (size_t i = 0; i < len; i++) {
+                    buf[i] = penalize(buf[i], counts[i0 + i]);
+                }
+            }
+
+            T block_max = buf[0];
+#pragma omp simd reduction(max : block_max)
+            for (size_t i = 0; i < len; i++) {
+                block_max = buf[i] > block_max ? buf[i] : block_max;
+            }
+
+            if (block_max > best.val) {
+                size_t i = 0;
+                while (buf[i] != block_max) {
+                    i++;
+                }
+                best = {i0 + i, block_max};
+            }
+        }
+        return best;
+    }
+
     template <class Tidx, class Tval>
     infiniStatus_t argmax(
         void *workspace, size_t workspace_size,
         void *result, void const *probs, size_t n,
         void *stream) {
-        auto idx = reinterpret_cast<Tidx *>(result);
-        *idx = 0;
+        using T = typename ComputeType<Tval>::type;
+        static_assert(sizeof(ArgMax<T>) <= 2 * sizeof(double), "the workspace holds pairs of an index and a double");
 
-        auto max_val = get<Tidx, Tval>(probs, 0);
-        for (size_t i = 0; i < n; i++) {
-            if (auto val = get<Tidx, Tval>(probs, i); val > max_val) {
-                max_val = val;
-                *idx = static_cast<Tidx>(i);
+        // the threads may have changed since the workspace was sized
+        const size_t parts = std::min(argmaxParts(info.batch, n), max_parts);
+        const size_t part_len = CEIL_DIV(n, parts);
+        auto partial = reinterpret_cast<ArgMax<T> *>(workspace);
+
+#pragma omp parallel for
+        for (ptrdiff_t item = 0; item < ptrdiff_t(info.batch * parts); item++) {
+            size_t row = size_t(item) / parts, part = size_t(item) % parts;
+            size_t begin = part * part_len, end = std::min(n, begin + part_len);
+            if (begin < end) {
+                partial[item] = argmaxRange(
+                    reinterpret_cast<Tval const *>(probs) + row * info.stride_probs,
+                    token_counts ? token_counts + row * n : nullptr,
+                    begin, end);
+            } else {
+                partial[item] = {n, -std::numeric_limits<T>::infinity()};
+            }
+        }
+
+        for (size_t row = 0; row < info.batch; row++) {
+            // parts are visited in order and only replaced by a strictly larger value,
+            // which keeps the first occurrence of the maximum
+            ArgMax<T> best = partial[row * parts];
+            for (size_t part = 1; part < parts; part++) {
+                if (partial[row * parts + part].val > best.val) {
+                    best = partial[row * parts + part];
+                }
             }
+            reinterpret_cast<Tidx *>(result)[row * info.stride_result] = static_cast<Tidx>(best.idx);
         }
 
         return INFINI_STATUS_SUCCESS;
     }
 
+    /**
+     * Samples one row without sorting the vocabulary:
+     *
+     * 1. penalized logits and their max, then exp((logit - max) / temperature) and its sum;
+     * 2. a histogram of the probabilities over order-preserving buckets gives the smallest
+     *    set of buckets that surely holds the top-k tokens, or the top-p mass if top-k
+     *    covers the whole vocabulary;
+     * 3. only tokens of those buckets are gathered, selected (top-k) and sorted.
+     */
     template <class Tidx, class Tval>
-    infiniStatus_t random(
-        void *workspace, size_t workspace_size,
-        void *result, void const *probs, size_t n,
-        float random_val, float topp, int topk, float temperature,
-        void *stream) {
+    void randomRow(
+        double *bucket_mass, size_t *bucket_count,
+        float *vals, Candidate *candidates,
+        Tidx *idx, void const *probs, const int *counts,
+        float random_val, float topp, int topk, float temperature) const {
 
-        struct KVPair {
-            Tidx idx;
-            typename ComputeType<Tval>::type val;
+        const size_t n = info.n;
+        const float inv_temperature = 1.0f / temperature;
 
-            bool operator<(const KVPair &other) const {
-                return val > other.val;
-            }
-        };
+        float max_val = -INFINITY;
+        for (size_t i = 0; i < n; i++) {
+            float val = float(get<Tidx, Tval>(probs, i));
+            vals[i] = counts ? penalize(val, counts[i]) : val;
+        }
+#pragma omp simd reduction(max : max_val)
+        for (size_t i = 0; i < n; i++) {
+            max_val = vals[i] > max_val ? vals[i] : max_val;
+        }
+
+        // sums are kept in double, the cumulative scan compares against them across ~1e5 tokens
+        double sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (size_t i = 0; i < n; i++) {
+            vals[i] = std::exp((vals[i] - max_val) * inv_temperature);
+            sum += vals[i];
+        }
 
-        auto idx = reinterpret_cast<Tidx *>(result);
-        // build & sort
-        std::vector<KVPair> pairs(n);
+        std::fill_n(bucket_count, NUM_BUCKETS, 0);
+        std::fill_n(bucket_mass, NUM_BUCKETS, 0.0);
         for (size_t i = 0; i < n; i++) {
-            pairs[i] = {static_cast<Tidx>(i), get<Tidx, Tval>(probs, i)};
+            size_t b = bucketOf(vals[i]);
+            bucket_count[b]++;
+            bucket_mass[b] += vals[i];
         }
-        std::sort(pairs.begin(), pairs.end());
-        // softmax & sum
-        auto const max_val = pairs[0].val;
-        pairs[0].val = 1;
-        for (size_t i = 1; i < n; i++) {
-            pairs[i].val = pairs[i - 1].val + std::exp((pairs[i].val - max_val) / temperature);
+
+        // `Calculate` takes argmax for any top-k below 2
+        const size_t k = std::min(static_cast<size_t>(topk), n);
+        size_t cutoff = NUM_BUCKETS;
+        if (k < n) {
+            // highest bucket that, with all buckets above it, holds at least k tokens
+            for (size_t count = 0; count < k;) {
+                count += bucket_count[--cutoff];
+            }
+        } else {
+            // top-k keeps every token, the buckets only need to hold the mass the sampler may reach
+            double mass = 0, plimit = random_val * sum * topp;
+            do {
+                mass += bucket_mass[--cutoff];
+            } while (mass < plimit && cutoff > 0);
+            // one more bucket absorbs rounding differences between the histogram and the scan below
+            cutoff -= cutoff > 0;
         }
-        // topk & topp & limit
-        auto const pk = pairs[std::min(static_cast<size_t>(topk), n) - 1].val,
-                   pp = pairs[n - 1].val * topp,
-                   plimit = random_val * std::min(pk, pp);
-        // sample
+
+        size_t m = 0;
         for (size_t i = 0; i < n; i++) {
-            if (plimit <= pairs[i].val) {
-                *idx = pairs[i].idx;
-                break;
+            if (bucketOf(vals[i]) >= cutoff) {
+                candidates[m++] = {vals[i], static_cast<uint32_t>(i)};
+            }
+        }
+
+        auto greater = [](const Candidate &a, const Candidate &b) { return a.val > b.val; };
+        double pk = sum;
+        if (k < n) {
+            std::nth_element(candidates, candidates + k - 1, candidates + m, greater);
+            m = k;
+            pk = 0;
+            for (size_t i = 0; i < k; i++) {
+                pk += candidates[i].val;
+            }
+        }
+        std::sort(candidates, candidates + m, greater);
+
+        const double plimit = random_val * std::min(pk, sum * topp);
+        double cum = 0;
+        for (size_t i = 0; i < m; i++) {
+            cum += candidates[i].val;
+            if (plimit <= cum) {
+                *idx = static_cast<Tidx>(candidates[i].idx);
+                return;
             }
         }
+        // only reachable through rounding of the sums
+        *idx = static_cast<Tidx>(candidates[m - 1].idx);
+    }
+
+    template <class Tidx, class Tval>
+    infiniStatus_t random(
+        void *workspace, size_t workspace_size,
+        void *result, void const *probs, size_t n,
+        float random_val, float topp, int topk, float temperature,
+        void *stream) {
+
+#pragma omp parallel for num_threads(int(num_slots))
+        for (ptrdiff_t row = 0; row < ptrdiff_t(info.batch); row++) {
+            auto slot = reinterpret_cast<char *>(workspace) + op::common_cpu::getThreadId() * slotSize(n);
+            auto vals = slot + NUM_BUCKETS * (sizeof(double) + sizeof(size_t));
+            randomRow<Tidx, Tval>(
+                reinterpret_cast<double *>(slot),
+                reinterpret_cast<size_t *>(slot + NUM_BUCKETS * sizeof(double)),
+                reinterpret_cast<float *>(vals),
+                reinterpret_cast<Candidate *>(vals + n * sizeof(float)),
+                reinterpret_cast<Tidx *>(result) + row * info.stride_result,
+                reinterpret_cast<Tval const *>(probs) + row * info.stride_probs,
+                token_counts ? token_counts + row * n : nullptr,
+                random_vals ? random_vals[row] : random_val,
+                topp, topk, temperature);
+        }
 
         return INFINI_STATUS_SUCCESS;
     }
@@ -127,8 +344,13 @@ infiniStatus_t Descriptor::calculate(
     float temperature,
     void *stream) const {
 
+    if (workspace_size < _min_workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
     Calculate::calculate<Algo>(
-        Algo{}, _info, workspace, workspace_size,
+        Algo{_info, _opaque->num_slots, _opaque->max_parts, nullptr, 1.0f, 0.0f, nullptr},
+        _info, workspace, workspace_size,
         result, probs,
         random_val, topp, topk, temperature,
         stream);
@@ -136,4 +358,38 @@ infiniStatus_t Descriptor::calculate(
     return INFINI_STATUS_SUCCESS;
 }
 
+infiniStatus_t Descriptor::calculateBatch(
+    void *workspace,
+    size_t workspace_size,
+    void *result,
+    const void *probs,
+    const float *random_val,
+    float topp,
+    int topk,
+    float temperature,
+    float repetition_penalty,
+    float frequency_penalty,
+    const int *token_counts,
+    void *stream) const {
+
+    if (random_val == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    if (workspace_size < _min_workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+    // The per-row random values are read by the algorithm, the nonzero scalar only keeps
+    // `Calculate` from choosing argmax for the whole batch. A row with a zero random value
+    // still gets its most probable token.
+    Calculate::calculate<Algo>(
+        Algo{_info, _opaque->num_slots, _opaque->max_parts, random_val, repetition_penalty, frequency_penalty, token_counts},
+        _info, workspace, workspace_size,
+        result, probs,
+        1.0f, topp, topk, temperature,
+        stream);
+
+    return INFINI_STATUS_SUCCESS;
+}
+
 } // namespace op::random_sample::cpu
@@ -9,6 +9,9 @@ namespace op::random_sample {
 struct RandomSampleInfo {
     infiniDtype_t dt_i, dt_p;
     size_t n;
+    // rows sampled in one call, each row is an independent request
+    size_t batch;
+    ptrdiff_t stride_probs, stride_result;
 
     static utils::Result<RandomSampleInfo> create(
         infiniopTensorDescriptor_t result_desc,
@@ -19,11 +22,26 @@ struct RandomSampleInfo {
 
         CHECK_DTYPE_ANY_INT(dt_i);
         CHECK_DTYPE(dt_p, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32, INFINI_DTYPE_F64);
-        CHECK_OR_RETURN(result_desc->ndim() == 0, INFINI_STATUS_BAD_TENSOR_SHAPE);
-        CHECK_OR_RETURN(probs_desc->ndim() == 1, INFINI_STATUS_BAD_TENSOR_SHAPE);
-        CHECK_OR_RETURN(probs_desc->stride(0) == 1, INFINI_STATUS_BAD_TENSOR_STRIDES);
-
-        return utils::Result<RandomSampleInfo>({dt_i, dt_p, probs_desc->dim(0)});
+        // single request: result [], probs [voc]; batched: result [batch], probs [batch, voc]
+        auto ndim = probs_desc->ndim();
+        CHECK_OR_RETURN(ndim == 1 || ndim == 2, INFINI_STATUS_BAD_TENSOR_SHAPE);
+        CHECK_OR_RETURN(result_desc->ndim() == ndim - 1, INFINI_STATUS_BAD_TENSOR_SHAPE);
+        CHECK_OR_RETURN(probs_desc->stride(ndim - 1) == 1, INFINI_STATUS_BAD_TENSOR_STRIDES);
+
+        size_t batch = 1;
+        ptrdiff_t stride_probs = 0, stride_result = 0;
+        if (ndim == 2) {
+            batch = probs_desc->dim(0);
+            CHECK_OR_RETURN(result_desc->dim(0) == batch, INFINI_STATUS_BAD_TENSOR_SHAPE);
+            stride_probs = probs_desc->stride(0);
+            stride_result = result_desc->stride(0);
+        }
+
+        // a call samples at least one token from at least one candidate
+        CHECK_OR_RETURN(batch > 0 && probs_desc->dim(ndim - 1) > 0, INFINI_STATUS_BAD_TENSOR_SHAPE);
+
+        return utils::Result<RandomSampleInfo>({dt_i, dt_p, probs_desc->dim(ndim - 1),
+                                                batch, stride_probs, stride_result});
     }
 };
 
@@ -24,6 +24,8 @@ infiniStatus_t Descriptor::create(
     CHECK_RESULT(result);
 
     auto info = result.take();
+    // batched requests are only implemented on CPU
+    CHECK_OR_RETURN(info.batch == 1, INFINI_STATUS_BAD_TENSOR_SHAPE);
     size_t workspace_size;
 
 #define CASE_P(CASE, Tidx, Tval)                                        \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/random_sample.h"
 
 #ifdef ENABLE_CPU_API
@@ -24,6 +27,7 @@ infiniopCreateRandomSampleDescriptor(
     infiniopRandomSampleDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t result,
     infiniopTensorDescriptor_t probs) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateRandomSampleDescriptor, infiniopDestroyRandomSampleDescriptor, handle, desc_ptr, result, probs);
 
 #define CREATE(CASE, NAMESPACE)                                                      \
     case CASE:                                                                       \
@@ -111,15 +115,17 @@ __C infiniStatus_t infiniopRandomSample(
     int topk,
     float temperature,
     void *stream) {
-
-#define CALCULATE(CASE, NAMESPACE)                                                      \
-    case CASE:                                                                          \
-        return reinterpret_cast<const op::random_sample::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size,                                      \
-                        result, probs,                                                  \
-                        random_val,                                                     \
-                        topp, topk, temperature,                                        \
-                        stream)
+    INFINIOP_GRAPH_CAPTURE(infiniopRandomSample, desc, workspace, workspace_size, result, probs, random_val, topp, topk, temperature, stream);
+    INFINIOP_TRACE(infiniopRandomSample, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                          \
+    case CASE:                                                                                              \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::random_sample::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size,                                                          \
+                        result, probs,                                                                      \
+                        random_val,                                                                         \
+                        topp, topk, temperature,                                                            \
+                        stream))
 
     switch (desc->device_type) {
 
@@ -149,8 +155,50 @@ __C infiniStatus_t infiniopRandomSample(
 #undef CALCULATE
 }
 
+__C infiniStatus_t infiniopRandomSampleBatch(
+    infiniopRandomSampleDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *result,
+    const void *probs,
+    const float *random_val,
+    float topp,
+    int topk,
+    float temperature,
+    float repetition_penalty,
+    float frequency_penalty,
+    const int *token_counts,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRandomSampleBatch, desc, workspace, workspace_size, result, probs, random_val, topp, topk, temperature, repetition_penalty, frequency_penalty, token_counts, stream);
+    INFINIOP_TRACE(infiniopRandomSampleBatch, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                          \
+    case CASE:                                                                                              \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::random_sample::NAMESPACE::Descriptor *>(desc) \
+            ->calculateBatch(workspace, workspace_size,                                                     \
+                             result, probs,                                                                 \
+                             random_val,                                                                    \
+                             topp, topk, temperature,                                                       \
+                             repetition_penalty, frequency_penalty,                                         \
+                             token_counts,                                                                  \
+                             stream))
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
 __C infiniStatus_t infiniopDestroyRandomSampleDescriptor(
     infiniopRandomSampleDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                          \
     case CASE:                                                                           \
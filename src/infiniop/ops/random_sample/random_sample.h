@@ -45,6 +45,21 @@
             float topp,                                   \
             int topk,                                     \
             float temperature,                            \
+            void *stream) const;                          \
+                                                          \
+        /* only implemented by the CPU backend */         \
+        infiniStatus_t calculateBatch(                    \
+            void *workspace,                              \
+            size_t workspace_size,                        \
+            void *result,                                 \
+            const void *probs,                            \
+            const float *random_val,                      \
+            float topp,                                   \
+            int topk,                                     \
+            float temperature,                            \
+            float repetition_penalty,                     \
+            float frequency_penalty,                      \
+            const int *token_counts,                      \
             void *stream) const;                          \
     };                                                    \
     }
@@ -65,7 +80,8 @@ class Calculate {
 
     template <class Tidx, class Tval, class Algo>
     static void switch_f(Algo algo, size_t n, CalculateArgs args) {
-        if (args.random_val == 0 || args.topp == 0 || args.topk == 1 || args.temperature == 0) {
+        // a top-k of 1 or less leaves a single candidate: the most probable token
+        if (args.random_val == 0 || args.topp == 0 || args.topk <= 1 || args.temperature == 0) {
             algo.template argmax<Tidx, Tval>(
                 args.workspace, args.workspace_size,
                 args.result, args.probs, n,
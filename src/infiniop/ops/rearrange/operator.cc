@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/rearrange.h"
 
 #ifdef ENABLE_CPU_API
@@ -26,6 +29,7 @@ __C infiniStatus_t infiniopCreateRearrangeDescriptor(
     infiniopRearrangeDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t dst,
     infiniopTensorDescriptor_t src) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateRearrangeDescriptor, infiniopDestroyRearrangeDescriptor, handle, desc_ptr, dst, src);
 
 #define CREATE(CASE, NAMESPACE)                                                  \
     case CASE:                                                                   \
@@ -70,11 +74,13 @@ __C infiniStatus_t infiniopRearrange(
     void *dst,
     const void *src,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRearrange, desc, dst, src, stream);
+    INFINIOP_TRACE(infiniopRearrange, desc, 0);
 
-#define CALCULATE(CASE, NAMESPACE)                                                  \
-    case CASE:                                                                      \
-        return reinterpret_cast<const op::rearrange::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(dst, src, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                   \
+    case CASE:                                                                                                       \
+        return INFINIOP_GRAPH_CALL_NO_WORKSPACE(reinterpret_cast<const op::rearrange::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(dst, src, stream))
 
     switch (desc->device_type) {
 
@@ -109,6 +115,7 @@ __C infiniStatus_t infiniopRearrange(
 
 __C infiniStatus_t infiniopDestroyRearrangeDescriptor(
     infiniopRearrangeDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                      \
     case CASE:                                                                       \
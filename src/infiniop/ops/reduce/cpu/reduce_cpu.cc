@@ -0,0 +1,64 @@
+#include "reduce_cpu.h"
+
+namespace op::reduce::cpu {
+
+Descriptor::~Descriptor() = default;
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t output_desc,
+    infiniopTensorDescriptor_t input_desc,
+    const size_t *axes,
+    size_t naxes,
+    bool keepdim,
+    infiniopReduceMode_t mode) {
+
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    if (mode < INFINIOP_REDUCE_SUM || mode > INFINIOP_REDUCE_NORM2) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    auto dtype = input_desc->dtype();
+    CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32, INFINI_DTYPE_F64);
+    if (output_desc->dtype() != (mode == INFINIOP_REDUCE_ARGMAX ? INFINI_DTYPE_I64 : dtype)) {
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+
+    auto result = ReduceInfo::create(output_desc, input_desc, axes, naxes, keepdim);
+    CHECK_RESULT(result);
+    auto info = result.take();
+
+    // max, min and argmax have no value over nothing
+    if (info.reduce_size == 0
+        && (mode == INFINIOP_REDUCE_MAX || mode == INFINIOP_REDUCE_MIN || mode == INFINIOP_REDUCE_ARGMAX)) {
+        return INFINI_STATUS_BAD_TENSOR_SHAPE;
+    }
+
+    size_t splits = splitCount(info);
+    size_t workspace_size = partialWorkspaceSize(info, splits);
+
+    *desc_ptr = new Descriptor(
+        std::move(info),
+        mode,
+        splits,
+        workspace_size,
+        handle->device,
+        handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *output,
+    const void *input,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+    return reduce(_info, _mode, _splits, workspace, output, input);
+}
+
+} // namespace op::reduce::cpu
@@ -0,0 +1,55 @@
+#ifndef __REDUCE_CPU_H__
+#define __REDUCE_CPU_H__
+
+#include "../../../devices/cpu/cpu_handle.h"
+#include "../../../operator.h"
+#include "../../../reduce/cpu/reduce_cpu.h"
+#include "infiniop/ops/reduce.h"
+
+namespace op::reduce::cpu {
+
+class Descriptor : public InfiniopDescriptor {
+    ReduceInfo _info;
+    infiniopReduceMode_t _mode;
+    size_t _splits;
+    size_t _workspace_size;
+
+    Descriptor(
+        ReduceInfo info,
+        infiniopReduceMode_t mode,
+        size_t splits,
+        size_t workspace_size,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _info(std::move(info)),
+          _mode(mode),
+          _splits(splits),
+          _workspace_size(workspace_size) {}
+
+public:
+    ~Descriptor();
+
+    static infiniStatus_t create(
+        infiniopHandle_t handle,
+        Descriptor **desc_ptr,
+        infiniopTensorDescriptor_t output_desc,
+        infiniopTensorDescriptor_t input_desc,
+        const size_t *axes,
+        size_t naxes,
+        bool keepdim,
+        infiniopReduceMode_t mode);
+
+    size_t workspaceSize() const { return _workspace_size; }
+
+    infiniStatus_t calculate(
+        void *workspace,
+        size_t workspace_size,
+        void *output,
+        const void *input,
+        void *stream) const;
+};
+
+} // namespace op::reduce::cpu
+
+#endif // __REDUCE_CPU_H__
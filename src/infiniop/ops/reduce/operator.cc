@@ -0,0 +1,116 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
+#include "infiniop/ops/reduce.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/reduce_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateReduceDescriptor(
+    infiniopHandle_t handle,
+    infiniopReduceDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t output_desc,
+    infiniopTensorDescriptor_t input_desc,
+    const size_t *axes,
+    size_t naxes,
+    int keepdim,
+    infiniopReduceMode_t mode) {
+    INFINIOP_DESCRIPTOR_CACHE_WITH_KEY(op::descriptor_cache::Key().addArray(axes, naxes),
+                                       infiniopCreateReduceDescriptor, infiniopDestroyReduceDescriptor, handle, desc_ptr, output_desc, input_desc, axes, naxes, keepdim, mode);
+
+#define CREATE(CASE, NAMESPACE)                                               \
+    case CASE:                                                                \
+        return op::reduce::NAMESPACE::Descriptor::create(                     \
+            handle,                                                           \
+            reinterpret_cast<op::reduce::NAMESPACE::Descriptor **>(desc_ptr), \
+            output_desc,                                                      \
+            input_desc,                                                       \
+            axes,                                                             \
+            naxes,                                                            \
+            keepdim != 0,                                                     \
+            mode)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetReduceWorkspaceSize(infiniopReduceDescriptor_t desc, size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                  \
+    case CASE:                                                                                \
+        *size = reinterpret_cast<op::reduce::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopReduce(
+    infiniopReduceDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *output,
+    const void *input,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopReduce, desc, workspace, workspace_size, output, input, stream);
+    INFINIOP_TRACE(infiniopReduce, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                   \
+    case CASE:                                                                                       \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::reduce::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, output, input, stream))
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t infiniopDestroyReduceDescriptor(infiniopReduceDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
+#define DELETE(CASE, NAMESPACE)                                                   \
+    case CASE:                                                                    \
+        delete reinterpret_cast<const op::reduce::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/reduce_max.h"
 
 #ifdef ENABLE_CPU_API
@@ -20,6 +23,7 @@ __C infiniStatus_t infiniopCreateReduceMaxDescriptor(
     infiniopTensorDescriptor_t output_desc,
     infiniopTensorDescriptor_t input_desc,
     size_t dim) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateReduceMaxDescriptor, infiniopDestroyReduceMaxDescriptor, handle, desc_ptr, output_desc, input_desc, dim);
 
 #define CREATE(CASE, NAMESPACE)                                                    \
     case CASE:                                                                     \
@@ -87,11 +91,13 @@ __C infiniStatus_t infiniopReduceMax(
     void *output,
     const void *input,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopReduceMax, desc, workspace, workspace_size, output, input, stream);
+    INFINIOP_TRACE(infiniopReduceMax, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                    \
-    case CASE:                                                                        \
-        return reinterpret_cast<const op::reduce_max::NAMESPACE::Descriptor *>(desc)  \
-            ->calculate(workspace, workspace_size, output, input, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                       \
+    case CASE:                                                                                           \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::reduce_max::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, output, input, stream))
 
     switch (desc->device_type) {
 
@@ -117,6 +123,7 @@ __C infiniStatus_t infiniopReduceMax(
 
 __C infiniStatus_t
 infiniopDestroyReduceMaxDescriptor(infiniopReduceMaxDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
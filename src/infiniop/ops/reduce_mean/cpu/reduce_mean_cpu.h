@@ -1,32 +1,28 @@
 #ifndef __REDUCE_MEAN_CPU_H__
 #define __REDUCE_MEAN_CPU_H__
 
+#include "../../../devices/cpu/cpu_handle.h"
 #include "../../../operator.h"
-#include "../../../devices/cpu/common_cpu.h"
-#include "../../../reduce/cpu/reduce.h"
-#include "../../../tensor.h"
-#include "../../../../utils.h"
+#include "../../../reduce/cpu/reduce_cpu.h"
 
 namespace op::reduce_mean::cpu {
 
-struct ReduceMeanInfo {
-    size_t ndim;
-    size_t reduce_dim;
-    infiniDtype_t dtype;
-    std::vector<size_t> input_shape;
-    std::vector<size_t> output_shape;
-    std::vector<ptrdiff_t> input_strides;
-    std::vector<ptrdiff_t> output_strides;
-    size_t input_size;
-    size_t output_size;
-};
-
+// ReduceMean over a single dimension, kept with length 1 in output
 class Descriptor final : public InfiniopDescriptor {
-    ReduceMeanInfo _info;
+    op::reduce::ReduceInfo _info;
+    size_t _splits;
     size_t _workspace_size;
 
-    Descriptor(infiniDevice_t device, int device_id, ReduceMeanInfo info, size_t workspace_size)
-        : InfiniopDescriptor{device, device_id}, _info(std::move(info)), _workspace_size(workspace_size) {}
+    Descriptor(
+        op::reduce::ReduceInfo info,
+        size_t splits,
+        size_t workspace_size,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _info(std::move(info)),
+          _splits(splits),
+          _workspace_size(workspace_size) {}
 
 public:
     ~Descriptor() = default;
@@ -49,4 +45,4 @@ public:
 
 } // namespace op::reduce_mean::cpu
 
-#endif // __REDUCE_MEAN_CPU_H__
\ No newline at end of file
+#endif // __REDUCE_MEAN_CPU_H__
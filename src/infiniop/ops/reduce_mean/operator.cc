@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/reduce_mean.h"
 
 #ifdef ENABLE_CPU_API
@@ -18,6 +21,8 @@ __C infiniStatus_t infiniopCreateReduceMeanDescriptor(
     infiniopTensorDescriptor_t output_desc,
     infiniopTensorDescriptor_t input_desc,
     size_t dim) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateReduceMeanDescriptor, infiniopDestroyReduceMeanDescriptor, handle, desc_ptr, output_desc, input_desc, dim);
+
     
     if (!handle || !desc_ptr || !output_desc || !input_desc) {
         return INFINI_STATUS_BAD_PARAM;
@@ -84,6 +89,9 @@ __C infiniStatus_t infiniopReduceMean(
     void *output,
     const void *input,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopReduceMean, desc, workspace, workspace_size, output, input, stream);
+    INFINIOP_TRACE(infiniopReduceMean, desc, workspace_size);
+
     
     if (!desc || !output || !input) {
         return INFINI_STATUS_BAD_PARAM;
@@ -95,16 +103,16 @@ __C infiniStatus_t infiniopReduceMean(
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
         case INFINI_DEVICE_CPU:
-            return static_cast<const op::reduce_mean::cpu::Descriptor*>(desc)->calculate(workspace, workspace_size, output, input, stream);
+            return INFINIOP_GRAPH_CALL(static_cast<const op::reduce_mean::cpu::Descriptor*>(desc)->calculate(workspace, workspace_size, output, input, stream));
 #endif
 #if defined(ENABLE_NVIDIA_API) || defined(ENABLE_ILUVATAR_API)
         case INFINI_DEVICE_NVIDIA:
         case INFINI_DEVICE_ILUVATAR:
-            return static_cast<const op::reduce_mean::nvidia::Descriptor*>(desc)->calculate(workspace, workspace_size, output, input, stream);
+            return INFINIOP_GRAPH_CALL(static_cast<const op::reduce_mean::nvidia::Descriptor*>(desc)->calculate(workspace, workspace_size, output, input, stream));
 #endif
 #ifdef ENABLE_METAX_API
         case INFINI_DEVICE_METAX:
-            return static_cast<const op::reduce_mean::metax::Descriptor*>(desc)->calculate(workspace, workspace_size, output, input, stream);
+            return INFINIOP_GRAPH_CALL(static_cast<const op::reduce_mean::metax::Descriptor*>(desc)->calculate(workspace, workspace_size, output, input, stream));
 #endif
         default:
             return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
@@ -113,6 +121,8 @@ __C infiniStatus_t infiniopReduceMean(
 
 __C infiniStatus_t infiniopDestroyReduceMeanDescriptor(
     infiniopReduceMeanDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
     
     if (!desc) {
         return INFINI_STATUS_BAD_PARAM;
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/relu.h"
 
 #ifdef ENABLE_CPU_API
@@ -21,6 +24,7 @@ __C infiniStatus_t infiniopCreateReluDescriptor(
     infiniopReluDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t y_desc,
     infiniopTensorDescriptor_t x_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateReluDescriptor, infiniopDestroyReluDescriptor, handle, desc_ptr, y_desc, x_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -99,11 +103,13 @@ __C infiniStatus_t infiniopRelu(
     void *y,
     const void *x,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRelu, desc, workspace, workspace_size, y, x, stream);
+    INFINIOP_TRACE(infiniopRelu, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::relu::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, y, {x}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::relu::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, {x}, stream))
 
     switch (desc->device_type) {
 
@@ -135,6 +141,7 @@ __C infiniStatus_t infiniopRelu(
 
 __C infiniStatus_t
 infiniopDestroyReluDescriptor(infiniopReluDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
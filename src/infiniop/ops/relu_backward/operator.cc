@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/relu_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -24,6 +27,7 @@ __C infiniStatus_t infiniopCreateReluBackwardDescriptor(
     infiniopTensorDescriptor_t grad_input_desc,
     infiniopTensorDescriptor_t input_desc,
     infiniopTensorDescriptor_t grad_output_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateReluBackwardDescriptor, infiniopDestroyReluBackwardDescriptor, handle, desc_ptr, grad_input_desc, input_desc, grad_output_desc);
 
 #define CREATE(CASE, NAMESPACE)                                                     \
     case CASE:                                                                      \
@@ -106,11 +110,13 @@ __C infiniStatus_t infiniopReluBackward(
     const void *input,
     const void *grad_output,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopReluBackward, desc, workspace, workspace_size, grad_input, input, grad_output, stream);
+    INFINIOP_TRACE(infiniopReluBackward, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                  \
-    case CASE:                                                                      \
-        return reinterpret_cast<op::relu_backward::NAMESPACE::Descriptor *>(desc)   \
-            ->calculate(workspace, workspace_size, grad_input, {input, grad_output}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                    \
+    case CASE:                                                                                        \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::relu_backward::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, grad_input, {input, grad_output}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -143,6 +149,8 @@ __C infiniStatus_t infiniopReluBackward(
 
 __C infiniStatus_t
 infiniopDestroyReluBackwardDescriptor(infiniopReluBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DESTROY(CASE, NAMESPACE)                                                    \
     case CASE:                                                                      \
         delete reinterpret_cast<op::relu_backward::NAMESPACE::Descriptor *>(desc);  \
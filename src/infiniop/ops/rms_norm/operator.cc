@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/rms_norm.h"
 
 #ifdef ENABLE_CPU_API
@@ -31,6 +34,7 @@ __C infiniStatus_t infiniopCreateRMSNormDescriptor(
     infiniopTensorDescriptor_t x_desc,
     infiniopTensorDescriptor_t w_desc,
     float epsilon) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateRMSNormDescriptor, infiniopDestroyRMSNormDescriptor, handle, desc_ptr, y_desc, x_desc, w_desc, epsilon);
 
 #define CREATE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
@@ -115,11 +119,13 @@ __C infiniStatus_t infiniopGetRMSNormWorkspaceSize(infiniopRMSNormDescriptor_t d
 
 __C infiniStatus_t infiniopRMSNorm(infiniopRMSNormDescriptor_t desc, void *workspace, size_t workspace_size,
                                    void *y, const void *x, const void *w, void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRMSNorm, desc, workspace, workspace_size, y, x, w, stream);
+    INFINIOP_TRACE(infiniopRMSNorm, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                       \
-    case CASE:                                                                           \
-        return reinterpret_cast<op::rms_norm::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, y, x, w, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                           \
+    case CASE:                                                                                               \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::rms_norm::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, y, x, w, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -154,6 +160,7 @@ __C infiniStatus_t infiniopRMSNorm(infiniopRMSNormDescriptor_t desc, void *works
 }
 
 __C infiniStatus_t infiniopDestroyRMSNormDescriptor(infiniopRMSNormDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                              \
     case CASE:                                                                \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/rms_norm_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -21,6 +24,7 @@ __C infiniStatus_t infiniopCreateRMSNormBackwardDescriptor(
     infiniopTensorDescriptor_t input_desc,
     infiniopTensorDescriptor_t weight_desc,
     float epsilon) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateRMSNormBackwardDescriptor, infiniopDestroyRMSNormBackwardDescriptor, handle, desc_ptr, input_grad_desc, weight_grad_desc, output_grad_desc, input_desc, weight_desc, epsilon);
 
 #define CREATE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
@@ -84,11 +88,13 @@ __C infiniStatus_t infiniopGetRMSNormBackwardWorkspaceSize(infiniopRMSNormBackwa
 __C infiniStatus_t infiniopRMSNormBackward(infiniopRMSNormBackwardDescriptor_t desc, void *workspace, size_t workspace_size,
                                            void *grad_input, void *grad_weight,
                                            const void *grad_output, const void *input, const void *weight, void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRMSNormBackward, desc, workspace, workspace_size, grad_input, grad_weight, grad_output, input, weight, stream);
+    INFINIOP_TRACE(infiniopRMSNormBackward, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                             \
-    case CASE:                                                                                 \
-        return reinterpret_cast<op::rms_norm_backward::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, grad_input, grad_weight, grad_output, input, weight, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                                    \
+    case CASE:                                                                                                        \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::rms_norm_backward::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, grad_input, grad_weight, grad_output, input, weight, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -111,6 +117,7 @@ __C infiniStatus_t infiniopRMSNormBackward(infiniopRMSNormBackwardDescriptor_t d
 }
 
 __C infiniStatus_t infiniopDestroyRMSNormBackwardDescriptor(infiniopRMSNormBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                                    \
     case CASE:                                                                      \
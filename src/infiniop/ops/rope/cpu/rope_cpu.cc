@@ -37,35 +37,36 @@ infiniStatus_t calculateRoPE(const RoPEInfo &info,
                              const Tindex *pos_ids,
                              const Tdata *sin_table,
                              const Tdata *cos_table) {
+    // parallel over (token, head) so decode with few heads still spreads across cores
 #pragma omp parallel for
-    for (ptrdiff_t h = 0; h < ptrdiff_t(info.nhead); h++) {
-        for (size_t tok = 0; tok < info.seqlen; tok++) {
-            size_t x_offset = tok * info.x_stride_seqlen + h * info.x_stride_nhead;
-            size_t y_offset = tok * info.y_stride_seqlen + h * info.y_stride_nhead;
-            size_t pos_id = size_t(pos_ids[tok]);
-            size_t table_offset = pos_id * info.table_dim;
-
-            for (size_t i = 0; i < info.table_dim; i++) {
-                size_t pos0 = 2 * i;
-                size_t pos1 = 2 * i + 1;
-
-                if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
-                    float x0 = utils::cast<float>(x[x_offset + pos0]),
-                          x1 = utils::cast<float>(x[x_offset + pos1]),
-                          sin__ = utils::cast<float>(sin_table[table_offset + i]),
-                          cos__ = utils::cast<float>(cos_table[table_offset + i]);
-
-                    y[y_offset + pos0] = utils::cast<Tdata>(x0 * cos__ - x1 * sin__);
-                    y[y_offset + pos1] = utils::cast<Tdata>(x0 * sin__ + x1 * cos__);
-                } else {
-                    Tdata x0 = x[x_offset + pos0],
-                          x1 = x[x_offset + pos1],
-                          sin__ = sin_table[table_offset + i],
-                          cos__ = cos_table[table_offset + i];
-
-                    y[y_offset + pos0] = x0 * cos__ - x1 * sin__;
-                    y[y_offset + pos1] = x0 * sin__ + x1 * cos__;
-                }
+    for (ptrdiff_t index = 0; index < ptrdiff_t(info.seqlen * info.nhead); index++) {
+        size_t tok = size_t(index) / info.nhead;
+        size_t h = size_t(index) % info.nhead;
+        size_t x_offset = tok * info.x_stride_seqlen + h * info.x_stride_nhead;
+        size_t y_offset = tok * info.y_stride_seqlen + h * info.y_stride_nhead;
+        size_t pos_id = size_t(pos_ids[tok]);
+        size_t table_offset = pos_id * info.table_dim;
+
+        for (size_t i = 0; i < info.table_dim; i++) {
+            size_t pos0 = 2 * i;
+            size_t pos1 = 2 * i + 1;
+
+            if constexpr (std::is_same<Tdata, fp16_t>::value || std::is_same<Tdata, bf16_t>::value) {
+                float x0 = utils::cast<float>(x[x_offset + pos0]),
+                      x1 = utils::cast<float>(x[x_offset + pos1]),
+                      sin__ = utils::cast<float>(sin_table[table_offset + i]),
+                      cos__ = utils::cast<float>(cos_table[table_offset + i]);
+
+                y[y_offset + pos0] = utils::cast<Tdata>(x0 * cos__ - x1 * sin__);
+                y[y_offset + pos1] = utils::cast<Tdata>(x0 * sin__ + x1 * cos__);
+            } else {
+                Tdata x0 = x[x_offset + pos0],
+                      x1 = x[x_offset + pos1],
+                      sin__ = sin_table[table_offset + i],
+                      cos__ = cos_table[table_offset + i];
+
+                y[y_offset + pos0] = x0 * cos__ - x1 * sin__;
+                y[y_offset + pos1] = x0 * sin__ + x1 * cos__;
             }
         }
     }
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/rope.h"
 
 #ifdef ENABLE_CPU_API
@@ -29,6 +32,7 @@ __C infiniStatus_t infiniopCreateRoPEDescriptor(
     infiniopTensorDescriptor_t pos_ids,
     infiniopTensorDescriptor_t sin_table,
     infiniopTensorDescriptor_t cos_table) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateRoPEDescriptor, infiniopDestroyRoPEDescriptor, handle, desc_ptr, y, x, pos_ids, sin_table, cos_table);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -128,11 +132,13 @@ __C infiniStatus_t infiniopRoPE(
     const void *sin_table,
     const void *cos_table,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRoPE, desc, workspace, workspace_size, y, x, pos_ids, sin_table, cos_table, stream);
+    INFINIOP_TRACE(infiniopRoPE, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                             \
-    case CASE:                                                                 \
-        return reinterpret_cast<const op::rope::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, y, x, pos_ids, sin_table, cos_table, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                 \
+    case CASE:                                                                                     \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::rope::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, x, pos_ids, sin_table, cos_table, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -171,6 +177,7 @@ __C infiniStatus_t infiniopRoPE(
 
 __C infiniStatus_t
 infiniopDestroyRoPEDescriptor(infiniopRoPEDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
@@ -0,0 +1,169 @@
+#include "rope_theta_cpu.h"
+#include "../../../devices/cpu/common_cpu.h"
+
+namespace op::rope_theta::cpu {
+
+// rotary pairs handled by one parallel work item
+constexpr size_t PAIR_BLOCK = 32;
+
+struct Descriptor::Opaque {
+    // inv_freq[i] = theta ^ (-2i / rotary_dim)
+    std::vector<double> inv_freq;
+};
+
+Descriptor::~Descriptor() {
+    delete _opaque;
+}
+
+infiniStatus_t Descriptor::create(
+    infiniopHandle_t handle_,
+    Descriptor **desc_ptr,
+    infiniopTensorDescriptor_t y_desc,
+    infiniopTensorDescriptor_t x_desc,
+    infiniopTensorDescriptor_t pos_desc,
+    float theta,
+    size_t rotary_dim,
+    infiniopRoPEAlgo_t algo) {
+    auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
+
+    auto result = RoPEThetaInfo::create(y_desc, x_desc, pos_desc, theta, rotary_dim, algo);
+    CHECK_RESULT(result);
+    auto info = result.take();
+
+    const size_t half = info.rotary_dim / 2;
+    auto opaque = new Opaque{std::vector<double>(half)};
+    for (size_t i = 0; i < half; ++i) {
+        opaque->inv_freq[i] = std::pow(double(info.theta), -double(2 * i) / double(info.rotary_dim));
+    }
+
+    // sin and cos of every (token, pair), shared by all heads of the token
+    size_t workspace_size = 2 * info.ntok() * half * sizeof(float);
+
+    *desc_ptr = new Descriptor(
+        info,
+        workspace_size,
+        opaque,
+        handle->device, handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+template <typename Tdata, typename Tindex>
+void calculateRoPETheta(
+    const RoPEThetaInfo &info,
+    const double *inv_freq,
+    float *sin_cache,
+    float *cos_cache,
+    Tdata *y,
+    const Tdata *x,
+    const Tindex *pos_ids) {
+
+    const size_t ntok = info.ntok();
+    const size_t half = info.rotary_dim / 2;
+    const size_t pair_blocks = std::max<size_t>(CEIL_DIV(half, PAIR_BLOCK), 1);
+    const bool neox = info.algo == INFINIOP_ROPE_ALGO_GPT_NEOX;
+
+#pragma omp parallel
+    {
+        // angles are formed in double so large positions keep their precision
+#pragma omp for
+        for (ptrdiff_t index = 0; index < ptrdiff_t(ntok * half); ++index) {
+            size_t tok = size_t(index) / half, i = size_t(index) % half;
+            size_t b = tok / info.seqlen, s = tok % info.seqlen;
+            double angle = double(pos_ids[b * info.pos_stride_batch + s * info.pos_stride_seqlen]) * inv_freq[i];
+            sin_cache[index] = float(std::sin(angle));
+            cos_cache[index] = float(std::cos(angle));
+        }
+
+        // parallel over (token, head, pair block) so decode with few tokens and heads still spreads across cores
+#pragma omp for
+        for (ptrdiff_t index = 0; index < ptrdiff_t(ntok * info.nhead * pair_blocks); ++index) {
+            size_t ind = size_t(index);
+            size_t block = ind % pair_blocks;
+            ind /= pair_blocks;
+            size_t h = ind % info.nhead;
+            size_t tok = ind / info.nhead;
+            size_t b = tok / info.seqlen, s = tok % info.seqlen;
+
+            Tdata *y_ = y + b * info.y_stride_batch + s * info.y_stride_seqlen + h * info.y_stride_nhead;
+            const Tdata *x_ = x + b * info.x_stride_batch + s * info.x_stride_seqlen + h * info.x_stride_nhead;
+            const float *sin_ = sin_cache + tok * half;
+            const float *cos_ = cos_cache + tok * half;
+
+            size_t i_end = std::min(half, (block + 1) * PAIR_BLOCK);
+            for (size_t i = block * PAIR_BLOCK; i < i_end; ++i) {
+                size_t d0 = neox ? i : 2 * i,
+                       d1 = neox ? i + half : 2 * i + 1;
+                float x0 = utils::cast<float>(x_[d0 * info.x_stride_dhead]),
+                      x1 = utils::cast<float>(x_[d1 * info.x_stride_dhead]);
+                y_[d0 * info.y_stride_dhead] = utils::cast<Tdata>(x0 * cos_[i] - x1 * sin_[i]);
+                y_[d1 * info.y_stride_dhead] = utils::cast<Tdata>(x0 * sin_[i] + x1 * cos_[i]);
+            }
+
+            // the unrotated tail of a partial rotary embedding is copied once per head
+            if (block == 0) {
+                for (size_t d = info.rotary_dim; d < info.dhead; ++d) {
+                    y_[d * info.y_stride_dhead] = x_[d * info.x_stride_dhead];
+                }
+            }
+        }
+    }
+}
+
+#define CALCULATE_ROPE_THETA(TDATA, TINDEX)                                    \
+    calculateRoPETheta(_info, _opaque->inv_freq.data(), sin_cache, cos_cache,  \
+                       (TDATA *)y, (const TDATA *)x, (const TINDEX *)pos_ids); \
+    return INFINI_STATUS_SUCCESS
+
+#define ROPE_THETA_TYPE(TDATA)                 \
+    switch (_info.pos_type) {                  \
+    case INFINI_DTYPE_U8:                      \
+        CALCULATE_ROPE_THETA(TDATA, uint8_t);  \
+    case INFINI_DTYPE_U16:                     \
+        CALCULATE_ROPE_THETA(TDATA, uint16_t); \
+    case INFINI_DTYPE_U32:                     \
+        CALCULATE_ROPE_THETA(TDATA, uint32_t); \
+    case INFINI_DTYPE_U64:                     \
+        CALCULATE_ROPE_THETA(TDATA, uint64_t); \
+    case INFINI_DTYPE_I8:                      \
+        CALCULATE_ROPE_THETA(TDATA, int8_t);   \
+    case INFINI_DTYPE_I16:                     \
+        CALCULATE_ROPE_THETA(TDATA, int16_t);  \
+    case INFINI_DTYPE_I32:                     \
+        CALCULATE_ROPE_THETA(TDATA, int32_t);  \
+    case INFINI_DTYPE_I64:                     \
+        CALCULATE_ROPE_THETA(TDATA, int64_t);  \
+    default:                                   \
+        return INFINI_STATUS_BAD_TENSOR_DTYPE; \
+    }
+
+infiniStatus_t Descriptor::calculate(
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    const void *pos_ids,
+    void *stream) const {
+
+    if (workspace_size < _workspace_size) {
+        return INFINI_STATUS_INSUFFICIENT_WORKSPACE;
+    }
+
+    float *sin_cache = reinterpret_cast<float *>(workspace);
+    float *cos_cache = sin_cache + _info.ntok() * (_info.rotary_dim / 2);
+
+    switch (_info.data_type) {
+    case INFINI_DTYPE_F16:
+        ROPE_THETA_TYPE(fp16_t);
+    case INFINI_DTYPE_BF16:
+        ROPE_THETA_TYPE(bf16_t);
+    case INFINI_DTYPE_F32:
+        ROPE_THETA_TYPE(float);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+#undef ROPE_THETA_TYPE
+#undef CALCULATE_ROPE_THETA
+
+} // namespace op::rope_theta::cpu
@@ -0,0 +1,8 @@
+#ifndef __INFINIOP_ROPE_THETA_CPU_H__
+#define __INFINIOP_ROPE_THETA_CPU_H__
+
+#include "../rope_theta.h"
+
+DESCRIPTOR(cpu)
+
+#endif // __INFINIOP_ROPE_THETA_CPU_H__
@@ -0,0 +1,100 @@
+#ifndef __ROPE_THETA_INFO_H__
+#define __ROPE_THETA_INFO_H__
+
+#include "../../../utils.h"
+#include "../../operator.h"
+#include "../../tensor.h"
+#include "infiniop/ops/rope_theta.h"
+
+namespace op::rope_theta {
+
+class RoPEThetaInfo {
+    RoPEThetaInfo() = default;
+
+public:
+    infiniDtype_t data_type, pos_type;
+    infiniopRoPEAlgo_t algo;
+    float theta;
+    // tokens are indexed as (batch, seqlen), batch is 1 for 3D inputs
+    size_t batch, seqlen, nhead, dhead, rotary_dim;
+    ptrdiff_t
+        y_stride_batch,
+        y_stride_seqlen,
+        y_stride_nhead,
+        y_stride_dhead,
+        x_stride_batch,
+        x_stride_seqlen,
+        x_stride_nhead,
+        x_stride_dhead,
+        pos_stride_batch,
+        pos_stride_seqlen;
+
+    size_t ntok() const { return batch * seqlen; }
+
+    static utils::Result<RoPEThetaInfo> create(
+        infiniopTensorDescriptor_t y_desc,
+        infiniopTensorDescriptor_t x_desc,
+        infiniopTensorDescriptor_t pos_desc,
+        float theta,
+        size_t rotary_dim,
+        infiniopRoPEAlgo_t algo) {
+        CHECK_OR_RETURN(y_desc != nullptr && x_desc != nullptr && pos_desc != nullptr,
+                        INFINI_STATUS_NULL_POINTER);
+
+        const infiniDtype_t data_type = y_desc->dtype();
+        const infiniDtype_t pos_type = pos_desc->dtype();
+        CHECK_OR_RETURN(data_type == x_desc->dtype(), INFINI_STATUS_BAD_TENSOR_DTYPE);
+        CHECK_DTYPE(data_type, INFINI_DTYPE_F16, INFINI_DTYPE_BF16, INFINI_DTYPE_F32);
+        CHECK_DTYPE_ANY_INT(pos_type);
+        CHECK_OR_RETURN(algo == INFINIOP_ROPE_ALGO_GPT_J || algo == INFINIOP_ROPE_ALGO_GPT_NEOX,
+                        INFINI_STATUS_BAD_PARAM);
+        CHECK_OR_RETURN(theta > 0, INFINI_STATUS_BAD_PARAM);
+
+        const auto ndim = y_desc->ndim();
+        CHECK_OR_RETURN((ndim == 3 || ndim == 4)
+                            && x_desc->ndim() == ndim
+                            && pos_desc->ndim() == ndim - 2,
+                        INFINI_STATUS_BAD_TENSOR_SHAPE);
+        CHECK_SAME_SHAPE(y_desc->shape(), x_desc->shape());
+        CHECK_OR_RETURN(!y_desc->hasBroadcastDim(), INFINI_STATUS_BAD_TENSOR_STRIDES);
+
+        // view 3D inputs as a single batch
+        const size_t off = ndim - 3;
+        const size_t batch = ndim == 4 ? y_desc->dim(0) : 1,
+                     seqlen = y_desc->dim(off),
+                     nhead = y_desc->dim(off + 1),
+                     dhead = y_desc->dim(off + 2);
+        if (rotary_dim == 0) {
+            rotary_dim = dhead;
+        }
+        CHECK_OR_RETURN(rotary_dim <= dhead && rotary_dim % 2 == 0, INFINI_STATUS_BAD_PARAM);
+        CHECK_OR_RETURN(pos_desc->dim(off) == seqlen && (ndim == 3 || pos_desc->dim(0) == batch),
+                        INFINI_STATUS_BAD_TENSOR_SHAPE);
+
+        return utils::Result<RoPEThetaInfo>(RoPEThetaInfo{
+            data_type,
+            pos_type,
+            algo,
+            theta,
+            batch,
+            seqlen,
+            nhead,
+            dhead,
+            rotary_dim,
+            ndim == 4 ? y_desc->stride(0) : 0,
+            y_desc->stride(off),
+            y_desc->stride(off + 1),
+            y_desc->stride(off + 2),
+            ndim == 4 ? x_desc->stride(0) : 0,
+            x_desc->stride(off),
+            x_desc->stride(off + 1),
+            x_desc->stride(off + 2),
+            ndim == 4 ? pos_desc->stride(0) : 0,
+            pos_desc->stride(off),
+        });
+    }
+};
+
+} // namespace op::rope_theta
+
+#endif // __ROPE_THETA_INFO_H__
@@ -0,0 +1,116 @@
+#include "../../operator.h"
+#include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
+#include "infiniop/ops/rope_theta.h"
+
+#ifdef ENABLE_CPU_API
+#include "cpu/rope_theta_cpu.h"
+#endif
+
+__C infiniStatus_t infiniopCreateRoPEThetaDescriptor(
+    infiniopHandle_t handle,
+    infiniopRoPEThetaDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t y,
+    infiniopTensorDescriptor_t x,
+    infiniopTensorDescriptor_t pos_ids,
+    float theta,
+    size_t rotary_dim,
+    infiniopRoPEAlgo_t algo) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateRoPEThetaDescriptor, infiniopDestroyRoPEThetaDescriptor, handle, desc_ptr, y, x, pos_ids, theta, rotary_dim, algo);
+
+#define CREATE(CASE, NAMESPACE)                                                   \
+    case CASE:                                                                    \
+        return op::rope_theta::NAMESPACE::Descriptor::create(                     \
+            handle,                                                               \
+            reinterpret_cast<op::rope_theta::NAMESPACE::Descriptor **>(desc_ptr), \
+            y,                                                                    \
+            x,                                                                    \
+            pos_ids,                                                              \
+            theta,                                                                \
+            rotary_dim,                                                           \
+            algo)
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+        CREATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CREATE
+}
+
+__C infiniStatus_t infiniopGetRoPEThetaWorkspaceSize(infiniopRoPEThetaDescriptor_t desc, size_t *size) {
+
+#define GET(CASE, NAMESPACE)                                                                      \
+    case CASE:                                                                                    \
+        *size = reinterpret_cast<op::rope_theta::NAMESPACE::Descriptor *>(desc)->workspaceSize(); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        GET(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef GET
+}
+
+__C infiniStatus_t infiniopRoPETheta(
+    infiniopRoPEThetaDescriptor_t desc,
+    void *workspace,
+    size_t workspace_size,
+    void *y,
+    const void *x,
+    const void *pos_ids,
+    void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopRoPETheta, desc, workspace, workspace_size, y, x, pos_ids, stream);
+    INFINIOP_TRACE(infiniopRoPETheta, desc, workspace_size);
+
+#define CALCULATE(CASE, NAMESPACE)                                                                       \
+    case CASE:                                                                                           \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::rope_theta::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, x, pos_ids, stream))
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        CALCULATE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef CALCULATE
+}
+
+__C infiniStatus_t infiniopDestroyRoPEThetaDescriptor(infiniopRoPEThetaDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
+#define DELETE(CASE, NAMESPACE)                                                       \
+    case CASE:                                                                        \
+        delete reinterpret_cast<const op::rope_theta::NAMESPACE::Descriptor *>(desc); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (desc->device_type) {
+
+#ifdef ENABLE_CPU_API
+        DELETE(INFINI_DEVICE_CPU, cpu);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+
+#undef DELETE
+}
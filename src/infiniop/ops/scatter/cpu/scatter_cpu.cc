@@ -1,84 +1,13 @@
 #include "scatter_cpu.h"
-#include "../../../../utils.h"
-#include "../../../tensor.h"
-#include <cstring>
-#include <omp.h>
+#include "../../../devices/cpu/common_cpu.h"
+#include <type_traits>
 
 namespace op::scatter::cpu {
 
-template<typename T, typename IndexT>
-static infiniStatus_t calculate_scatter(
-    const std::vector<size_t> &input_shape,
-    const std::vector<size_t> &output_shape,
-    const std::vector<size_t> &src_shape,
-    const std::vector<ptrdiff_t> &input_strides,
-    const std::vector<ptrdiff_t> &output_strides,
-    const std::vector<ptrdiff_t> &index_strides,
-    const std::vector<ptrdiff_t> &src_strides,
-    size_t dim,
-    T * output,
-    const T * input,
-    const IndexT * index,
-    const T * src
-) {
-    // Step 1: Copy input to output (initialization)
-    size_t total_input_elements = 1;
-    for (size_t d = 0; d < input_shape.size(); d++) {
-        total_input_elements *= input_shape[d];
-    }
-    
-    std::memcpy(output, input, total_input_elements * sizeof(T));
-    
-    // Step 2: Scatter operation - iterate over src elements
-    size_t total_src_elements = 1;
-    for (size_t d = 0; d < src_shape.size(); d++) {
-        total_src_elements *= src_shape[d];
-    }
-    
-    for(size_t linear_idx = 0; linear_idx < total_src_elements; linear_idx++) {
-        
-        // Convert linear index to multi-dimensional coordinates
-        std::vector<size_t> coords(src_shape.size());
-        size_t temp_idx = linear_idx;
-        for (int d = src_shape.size() - 1; d >= 0; d--) {
-            coords[d] = temp_idx % src_shape[d];
-            temp_idx /= src_shape[d];
-        }
-        
-        // Calculate src offset
-        size_t src_offset = 0;
-        for (size_t d = 0; d < src_shape.size(); d++) {
-            src_offset += coords[d] * src_strides[d];
-        }
-        
-        // Calculate index offset
-        size_t index_offset = 0;
-        for (size_t d = 0; d < src_shape.size(); d++) {
-            index_offset += coords[d] * index_strides[d];
-        }
-        
-        // Get scatter index and perform bounds check
-        IndexT scatter_index = *((const IndexT*)((const char*)index + index_offset));
-        if (scatter_index < 0 || scatter_index >= static_cast<IndexT>(output_shape[dim])) {
-            continue; // Skip invalid indices
-        }
-        
-        // Calculate output offset - for scatter operation, use scatter_index in dim dimension
-        size_t output_offset = 0;
-        for (size_t d = 0; d < output_shape.size(); d++) {
-            if (d == dim) {
-                output_offset += scatter_index * output_strides[d];
-            } else {
-                output_offset += coords[d] * output_strides[d];
-            }
-        }
-        
-        // Copy data from src to output
-        std::memcpy((char*)output + output_offset, (const char*)src + src_offset, sizeof(T));
-    }
-    
-    return INFINI_STATUS_SUCCESS;
-}
+// elements of the inner dimension handled by one work item
+constexpr size_t SCATTER_BLOCK = 256;
+// scatters with fewer src elements run on the calling thread
+constexpr size_t SCATTER_PARALLEL_MIN = 16384;
 
 Descriptor::~Descriptor() = default;
 
@@ -89,71 +18,162 @@ infiniStatus_t Descriptor::create(
     infiniopTensorDescriptor_t output_desc,
     infiniopTensorDescriptor_t index_desc,
     infiniopTensorDescriptor_t src_desc,
-    int dim) {
+    int dim,
+    infiniopScatterReduce_t reduce) {
 
     auto handle = reinterpret_cast<device::cpu::Handle *>(handle_);
-    auto dtype = input_desc->dtype();
 
-    // Check data types - support all legal types
-    CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_F64, INFINI_DTYPE_BF16,
-                INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
-                INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
-                INFINI_DTYPE_BOOL);
+    auto result = ScatterInfo::create(input_desc, output_desc, index_desc, src_desc, dim);
+    CHECK_RESULT(result);
+    auto info = result.take();
 
-    // Check that input, output and src have same dtype
-    if (input_desc->dtype() != output_desc->dtype() || input_desc->dtype() != src_desc->dtype()) {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    if (reduce < INFINIOP_SCATTER_REDUCE_NONE || reduce > INFINIOP_SCATTER_REDUCE_AMIN) {
+        return INFINI_STATUS_BAD_PARAM;
     }
 
-    // Check that index is integer type
-    auto index_dtype = index_desc->dtype();
-    if (index_dtype != INFINI_DTYPE_I32 && index_dtype != INFINI_DTYPE_I64) {
-        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    auto shape = output_desc->shape();
+    auto copy = utils::RearrangeMeta::create(shape.data(), output_desc->strides().data(), input_desc->strides().data(),
+                                             shape.size(), infiniSizeOf(info.dtype));
+    CHECK_RESULT(copy);
+
+    // Rows and inner blocks never write the same output element. When there are too few of
+    // them for all threads, each one is also split into ranges of the scatter dimension: every
+    // part reads the whole row of indices but only applies the ones that fall into its range.
+    size_t num_threads = op::common_cpu::getMaxThreads();
+    size_t items = info.rows() * CEIL_DIV(info.inner_len, SCATTER_BLOCK);
+    size_t parts = 1;
+    if (items * info.scatter_len * std::min(info.inner_len, SCATTER_BLOCK) >= SCATTER_PARALLEL_MIN && items < num_threads) {
+        parts = std::max<size_t>(1, std::min(info.dim_size, CEIL_DIV(num_threads, items)));
     }
 
-    // Validate dimensions
-    auto input_shape = input_desc->shape();
-    auto output_shape = output_desc->shape();
-    auto src_shape = src_desc->shape();
-    auto index_shape = index_desc->shape();
-    
-    if (dim < 0 || dim >= static_cast<int>(input_shape.size())) {
-        return INFINI_STATUS_BAD_PARAM;
+    *desc_ptr = new Descriptor(
+        std::move(info),
+        reduce,
+        copy.take(),
+        parts,
+        handle->device,
+        handle->device_id);
+    return INFINI_STATUS_SUCCESS;
+}
+
+template <infiniopScatterReduce_t Reduce, typename T>
+inline T combine(const T &dst, const T &val) {
+    if constexpr (Reduce == INFINIOP_SCATTER_REDUCE_NONE) {
+        return val;
+    } else if constexpr (std::is_same_v<T, fp16_t> || std::is_same_v<T, bf16_t>) {
+        return utils::cast<T>(combine<Reduce, float>(utils::cast<float>(dst), utils::cast<float>(val)));
+    } else if constexpr (std::is_same_v<T, bool>) {
+        if constexpr (Reduce == INFINIOP_SCATTER_REDUCE_SUM || Reduce == INFINIOP_SCATTER_REDUCE_AMAX) {
+            return dst || val;
+        } else {
+            return dst && val;
+        }
+    } else if constexpr (std::is_integral_v<T> && (Reduce == INFINIOP_SCATTER_REDUCE_SUM || Reduce == INFINIOP_SCATTER_REDUCE_PROD)) {
+        // integers wrap around on overflow, computed in uint64_t to keep it defined
+        if constexpr (Reduce == INFINIOP_SCATTER_REDUCE_SUM) {
+            return T(uint64_t(dst) + uint64_t(val));
+        } else {
+            return T(uint64_t(dst) * uint64_t(val));
+        }
+    } else if constexpr (Reduce == INFINIOP_SCATTER_REDUCE_SUM) {
+        return dst + val;
+    } else if constexpr (Reduce == INFINIOP_SCATTER_REDUCE_PROD) {
+        return dst * val;
+    } else if constexpr (Reduce == INFINIOP_SCATTER_REDUCE_AMAX) {
+        // NaN propagates, as in PyTorch
+        return (val > dst || val != val) ? val : dst;
+    } else {
+        return (val < dst || val != val) ? val : dst;
     }
-    
-    // Check that input and output have same shape
-    if (input_shape != output_shape) {
-        return INFINI_STATUS_BAD_PARAM;
+}
+
+template <infiniopScatterReduce_t Reduce, typename T, typename Tindex>
+void scatter(const ScatterInfo &info, size_t parts, T *output, const Tindex *index, const T *src) {
+    const size_t blocks = CEIL_DIV(info.inner_len, SCATTER_BLOCK);
+    const size_t part_len = CEIL_DIV(info.dim_size, parts);
+    const size_t row_ndim = info.row_shape.size();
+    const ptrdiff_t items = ptrdiff_t(info.rows() * blocks * parts);
+    const bool parallel = info.rows() * info.scatter_len * info.inner_len >= SCATTER_PARALLEL_MIN;
+
+#pragma omp parallel for schedule(static) if (parallel)
+    for (ptrdiff_t item = 0; item < items; ++item) {
+        size_t part = size_t(item) % parts;
+        size_t rest = size_t(item) / parts;
+        size_t k0 = rest % blocks * SCATTER_BLOCK;
+        size_t row = rest / blocks;
+        size_t kb = std::min(SCATTER_BLOCK, info.inner_len - k0);
+        ptrdiff_t lo = ptrdiff_t(part * part_len);
+        ptrdiff_t hi = std::min(ptrdiff_t(info.dim_size), lo + ptrdiff_t(part_len));
+
+        ptrdiff_t out_offset = ptrdiff_t(k0) * info.out_stride_inner;
+        ptrdiff_t index_offset = ptrdiff_t(k0) * info.index_stride_inner;
+        ptrdiff_t src_offset = ptrdiff_t(k0) * info.src_stride_inner;
+        for (size_t d = row_ndim; d-- > 0;) {
+            ptrdiff_t coord = ptrdiff_t(row % info.row_shape[d]);
+            row /= info.row_shape[d];
+            out_offset += coord * info.row_out_strides[d];
+            index_offset += coord * info.row_index_strides[d];
+            src_offset += coord * info.row_src_strides[d];
+        }
+
+        // walk the scatter dimension in order, so the last duplicate index wins
+        T *out_row = output + out_offset;
+        const Tindex *index_row = index + index_offset;
+        const T *src_row = src + src_offset;
+        for (size_t j = 0; j < info.scatter_len; ++j) {
+            const Tindex *idx = index_row;
+            const T *val = src_row;
+            T *out = out_row;
+            for (size_t k = 0; k < kb; ++k) {
+                ptrdiff_t i = ptrdiff_t(*idx);
+                if (i >= lo && i < hi) {
+                    T &dst = out[i * info.out_stride_scatter];
+                    dst = combine<Reduce>(dst, *val);
+                }
+                idx += info.index_stride_inner;
+                val += info.src_stride_inner;
+                out += info.out_stride_inner;
+            }
+            index_row += info.index_stride_scatter;
+            src_row += info.src_stride_scatter;
+        }
     }
-    
-    // Check that src and index have same shape
-    if (src_shape != index_shape) {
+}
+
+template <typename T, typename Tindex>
+infiniStatus_t calculateScatter(const ScatterInfo &info, infiniopScatterReduce_t reduce, size_t parts,
+                                void *output, const void *index, const void *src) {
+#define SCATTER(REDUCE)                                                                   \
+    case REDUCE:                                                                          \
+        scatter<REDUCE>(info, parts, (T *)output, (const Tindex *)index, (const T *)src); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (reduce) {
+        SCATTER(INFINIOP_SCATTER_REDUCE_NONE);
+        SCATTER(INFINIOP_SCATTER_REDUCE_SUM);
+        SCATTER(INFINIOP_SCATTER_REDUCE_PROD);
+        SCATTER(INFINIOP_SCATTER_REDUCE_AMAX);
+        SCATTER(INFINIOP_SCATTER_REDUCE_AMIN);
+    default:
         return INFINI_STATUS_BAD_PARAM;
     }
 
-    auto desc = new Descriptor();
-    desc->_input_desc = input_desc;
-    desc->_output_desc = output_desc;
-    desc->_index_desc = index_desc;
-    desc->_src_desc = src_desc;
-    desc->_dim = dim;
-    desc->_input_shape = input_shape;
-    desc->_output_shape = output_shape;
-    desc->_src_shape = src_shape;
-    desc->_input_strides = input_desc->getByteStrides();
-    desc->_output_strides = output_desc->getByteStrides();
-    desc->_index_strides = index_desc->getByteStrides();
-    desc->_src_strides = src_desc->getByteStrides();
-    desc->_dtype = dtype;
-    desc->_index_dtype = index_dtype;
-    desc->_handle = handle;
-    desc->device_type = handle_->device;
-    desc->device_id = handle_->device_id;
-
-    *desc_ptr = desc;
-    return INFINI_STATUS_SUCCESS;
+#undef SCATTER
 }
 
+#define CALCULATE_SCATTER(TDATA, TINDEX)                                        \
+    calculateScatter<TDATA, TINDEX>(_info, _reduce, _parts, output, index, src)
+
+#define SCATTER_TYPE(TDATA)                       \
+    switch (_info.index_dtype) {                  \
+    case INFINI_DTYPE_I32:                        \
+        return CALCULATE_SCATTER(TDATA, int32_t); \
+    case INFINI_DTYPE_I64:                        \
+        return CALCULATE_SCATTER(TDATA, int64_t); \
+    default:                                      \
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;    \
+    }
+
 infiniStatus_t Descriptor::calculate(
     void *workspace,
     size_t workspace_size,
@@ -163,292 +183,44 @@ infiniStatus_t Descriptor::calculate(
     const void *src,
     void *stream) const {
 
-    auto input_shape = _input_shape;
-    auto output_shape = _output_shape;
-    auto src_shape = _src_shape;
-    auto input_strides = _input_strides;
-    auto output_strides = _output_strides;
-    auto index_strides = _index_strides;
-    auto src_strides = _src_strides;
-    auto dtype = _dtype;
-    auto index_dtype = _index_dtype;
-    
-    // Call kernel based on data type and index type
-    if (index_dtype == INFINI_DTYPE_I32) {
-        switch (dtype) {
-            case INFINI_DTYPE_F16:
-                return calculate_scatter<fp16_t, int32_t>(
-                     input_shape, output_shape, src_shape,
-                     input_strides, output_strides, index_strides, src_strides,
-                     static_cast<size_t>(_dim),
-                     static_cast<fp16_t*>(output),
-                     static_cast<const fp16_t*>(input),
-                     static_cast<const int32_t*>(index),
-                     static_cast<const fp16_t*>(src));
-                break;
-            case INFINI_DTYPE_F32:
-                return calculate_scatter<float, int32_t>(
-                     input_shape, output_shape, src_shape,
-                     input_strides, output_strides, index_strides, src_strides,
-                     static_cast<size_t>(_dim),
-                     static_cast<float*>(output),
-                     static_cast<const float*>(input),
-                     static_cast<const int32_t*>(index),
-                     static_cast<const float*>(src));
-                 break;
-             case INFINI_DTYPE_F64:
-                 return calculate_scatter<double, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<double*>(output),
-                      static_cast<const double*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const double*>(src));
-                 break;
-             case INFINI_DTYPE_BF16:
-                 return calculate_scatter<bf16_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<bf16_t*>(output),
-                      static_cast<const bf16_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const bf16_t*>(src));
-                 break;
-             case INFINI_DTYPE_I8:
-                 return calculate_scatter<int8_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int8_t*>(output),
-                      static_cast<const int8_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const int8_t*>(src));
-                 break;
-             case INFINI_DTYPE_I16:
-                 return calculate_scatter<int16_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int16_t*>(output),
-                      static_cast<const int16_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const int16_t*>(src));
-                 break;
-             case INFINI_DTYPE_I32:
-                 return calculate_scatter<int32_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int32_t*>(output),
-                      static_cast<const int32_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const int32_t*>(src));
-                 break;
-             case INFINI_DTYPE_I64:
-                 return calculate_scatter<int64_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int64_t*>(output),
-                      static_cast<const int64_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const int64_t*>(src));
-                 break;
-             case INFINI_DTYPE_U8:
-                 return calculate_scatter<uint8_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint8_t*>(output),
-                      static_cast<const uint8_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const uint8_t*>(src));
-                 break;
-             case INFINI_DTYPE_U16:
-                 return calculate_scatter<uint16_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint16_t*>(output),
-                      static_cast<const uint16_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const uint16_t*>(src));
-                 break;
-             case INFINI_DTYPE_U32:
-                 return calculate_scatter<uint32_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint32_t*>(output),
-                      static_cast<const uint32_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const uint32_t*>(src));
-                 break;
-             case INFINI_DTYPE_U64:
-                 return calculate_scatter<uint64_t, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint64_t*>(output),
-                      static_cast<const uint64_t*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const uint64_t*>(src));
-                 break;
-             case INFINI_DTYPE_BOOL:
-                 return calculate_scatter<bool, int32_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<bool*>(output),
-                      static_cast<const bool*>(input),
-                      static_cast<const int32_t*>(index),
-                      static_cast<const bool*>(src));
-                 break;
-             default:
-                 return INFINI_STATUS_BAD_TENSOR_DTYPE;
-        }
-    } else if (index_dtype == INFINI_DTYPE_I64) {
-        switch (dtype) {
-            case INFINI_DTYPE_F16:
-                return calculate_scatter<fp16_t, int64_t>(
-                     input_shape, output_shape, src_shape,
-                     input_strides, output_strides, index_strides, src_strides,
-                     static_cast<size_t>(_dim),
-                     static_cast<fp16_t*>(output),
-                     static_cast<const fp16_t*>(input),
-                     static_cast<const int64_t*>(index),
-                     static_cast<const fp16_t*>(src));
-                break;
-            case INFINI_DTYPE_F32:
-                return calculate_scatter<float, int64_t>(
-                     input_shape, output_shape, src_shape,
-                     input_strides, output_strides, index_strides, src_strides,
-                     static_cast<size_t>(_dim),
-                     static_cast<float*>(output),
-                     static_cast<const float*>(input),
-                     static_cast<const int64_t*>(index),
-                     static_cast<const float*>(src));
-                 break;
-             case INFINI_DTYPE_F64:
-                 return calculate_scatter<double, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<double*>(output),
-                      static_cast<const double*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const double*>(src));
-                 break;
-             case INFINI_DTYPE_BF16:
-                 return calculate_scatter<bf16_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<bf16_t*>(output),
-                      static_cast<const bf16_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const bf16_t*>(src));
-                 break;
-             case INFINI_DTYPE_I8:
-                 return calculate_scatter<int8_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int8_t*>(output),
-                      static_cast<const int8_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const int8_t*>(src));
-                 break;
-             case INFINI_DTYPE_I16:
-                 return calculate_scatter<int16_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int16_t*>(output),
-                      static_cast<const int16_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const int16_t*>(src));
-                 break;
-             case INFINI_DTYPE_I32:
-                 return calculate_scatter<int32_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int32_t*>(output),
-                      static_cast<const int32_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const int32_t*>(src));
-                 break;
-             case INFINI_DTYPE_I64:
-                 return calculate_scatter<int64_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<int64_t*>(output),
-                      static_cast<const int64_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const int64_t*>(src));
-                 break;
-             case INFINI_DTYPE_U8:
-                 return calculate_scatter<uint8_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint8_t*>(output),
-                      static_cast<const uint8_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const uint8_t*>(src));
-                 break;
-             case INFINI_DTYPE_U16:
-                 return calculate_scatter<uint16_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint16_t*>(output),
-                      static_cast<const uint16_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const uint16_t*>(src));
-                 break;
-             case INFINI_DTYPE_U32:
-                 return calculate_scatter<uint32_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint32_t*>(output),
-                      static_cast<const uint32_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const uint32_t*>(src));
-                 break;
-             case INFINI_DTYPE_U64:
-                 return calculate_scatter<uint64_t, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<uint64_t*>(output),
-                      static_cast<const uint64_t*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const uint64_t*>(src));
-                 break;
-             case INFINI_DTYPE_BOOL:
-                 return calculate_scatter<bool, int64_t>(
-                      input_shape, output_shape, src_shape,
-                      input_strides, output_strides, index_strides, src_strides,
-                      static_cast<size_t>(_dim),
-                      static_cast<bool*>(output),
-                      static_cast<const bool*>(input),
-                      static_cast<const int64_t*>(index),
-                      static_cast<const bool*>(src));
-                 break;
-             default:
-                 return INFINI_STATUS_BAD_TENSOR_DTYPE;
-        }
-    } else {
+    // in place when output and input are the same tensor
+    if (output != input) {
+        _copy.launch(output, input);
+    }
+
+    switch (_info.dtype) {
+    case INFINI_DTYPE_F16:
+        SCATTER_TYPE(fp16_t);
+    case INFINI_DTYPE_BF16:
+        SCATTER_TYPE(bf16_t);
+    case INFINI_DTYPE_F32:
+        SCATTER_TYPE(float);
+    case INFINI_DTYPE_F64:
+        SCATTER_TYPE(double);
+    case INFINI_DTYPE_I8:
+        SCATTER_TYPE(int8_t);
+    case INFINI_DTYPE_I16:
+        SCATTER_TYPE(int16_t);
+    case INFINI_DTYPE_I32:
+        SCATTER_TYPE(int32_t);
+    case INFINI_DTYPE_I64:
+        SCATTER_TYPE(int64_t);
+    case INFINI_DTYPE_U8:
+        SCATTER_TYPE(uint8_t);
+    case INFINI_DTYPE_U16:
+        SCATTER_TYPE(uint16_t);
+    case INFINI_DTYPE_U32:
+        SCATTER_TYPE(uint32_t);
+    case INFINI_DTYPE_U64:
+        SCATTER_TYPE(uint64_t);
+    case INFINI_DTYPE_BOOL:
+        SCATTER_TYPE(bool);
+    default:
         return INFINI_STATUS_BAD_TENSOR_DTYPE;
     }
-    
-    return INFINI_STATUS_SUCCESS;
 }
 
-} // namespace op::scatter::cpu
\ No newline at end of file
+#undef SCATTER_TYPE
+#undef CALCULATE_SCATTER
+
+} // namespace op::scatter::cpu
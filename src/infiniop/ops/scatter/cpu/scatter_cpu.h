@@ -1,15 +1,36 @@
 #ifndef __SCATTER_CPU_H__
 #define __SCATTER_CPU_H__
 
-#include "../../../operator.h"
+#include "../../../../utils/rearrange.h"
 #include "../../../devices/cpu/cpu_handle.h"
-#include <vector>
+#include "../../../operator.h"
+#include "../info.h"
+#include "infiniop/ops/scatter.h"
 
 namespace op::scatter::cpu {
 
 class Descriptor : public InfiniopDescriptor {
+    ScatterInfo _info;
+    infiniopScatterReduce_t _reduce;
+    // copies input into output when the scatter is not in place
+    utils::RearrangeMeta _copy;
+    // number of output ranges along the scatter dimension each row is split into
+    size_t _parts;
+
+    Descriptor(
+        ScatterInfo info,
+        infiniopScatterReduce_t reduce,
+        utils::RearrangeMeta copy,
+        size_t parts,
+        infiniDevice_t device_type,
+        int device_id)
+        : InfiniopDescriptor{device_type, device_id},
+          _info(std::move(info)),
+          _reduce(reduce),
+          _copy(std::move(copy)),
+          _parts(parts) {}
+
 public:
-    Descriptor() = default;
     ~Descriptor();
 
     static infiniStatus_t create(
@@ -19,7 +40,8 @@ public:
         infiniopTensorDescriptor_t output_desc,
         infiniopTensorDescriptor_t index_desc,
         infiniopTensorDescriptor_t src_desc,
-        int dim);
+        int dim,
+        infiniopScatterReduce_t reduce = INFINIOP_SCATTER_REDUCE_NONE);
 
     size_t workspaceSize() const { return 0; }
 
@@ -31,25 +53,8 @@ public:
         const void *index,
         const void *src,
         void *stream) const;
-
-private:
-    infiniopTensorDescriptor_t _input_desc;
-    infiniopTensorDescriptor_t _output_desc;
-    infiniopTensorDescriptor_t _index_desc;
-    infiniopTensorDescriptor_t _src_desc;
-    int _dim;
-    std::vector<size_t> _input_shape;
-    std::vector<size_t> _output_shape;
-    std::vector<size_t> _src_shape;
-    std::vector<ptrdiff_t> _input_strides;
-    std::vector<ptrdiff_t> _output_strides;
-    std::vector<ptrdiff_t> _index_strides;
-    std::vector<ptrdiff_t> _src_strides;
-    infiniDtype_t _dtype;
-    infiniDtype_t _index_dtype;
-    device::cpu::Handle *_handle;
 };
 
 } // namespace op::scatter::cpu
 
-#endif // __SCATTER_CPU_H__
\ No newline at end of file
+#endif // __SCATTER_CPU_H__
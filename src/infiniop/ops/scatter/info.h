@@ -0,0 +1,129 @@
+#ifndef __SCATTER_INFO_H__
+#define __SCATTER_INFO_H__
+
+#include "../../../utils.h"
+#include "../../operator.h"
+#include "../../tensor.h"
+#include <vector>
+
+namespace op::scatter {
+
+/**
+ * Loop geometry of a scatter, over the shape of index (and src).
+ *
+ * The index dimensions are split into the scatter dimension, the innermost dimension
+ * (when it is not the scatter dimension) and the remaining "row" dimensions. Two index
+ * positions that differ outside the scatter dimension always write different output
+ * elements, so rows and blocks of the inner dimension can be processed in parallel.
+ * All strides are in elements.
+ */
+class ScatterInfo {
+    ScatterInfo() = default;
+
+public:
+    infiniDtype_t dtype, index_dtype;
+    size_t dim;
+
+    // output.shape[dim], indices outside [0, dim_size) are skipped
+    size_t dim_size;
+
+    size_t scatter_len;
+    ptrdiff_t out_stride_scatter, index_stride_scatter, src_stride_scatter;
+
+    // length 1 when the scatter dimension is the innermost one
+    size_t inner_len;
+    ptrdiff_t out_stride_inner, index_stride_inner, src_stride_inner;
+
+    std::vector<size_t> row_shape;
+    std::vector<ptrdiff_t> row_out_strides, row_index_strides, row_src_strides;
+
+    size_t rows() const {
+        size_t n = 1;
+        for (auto len : row_shape) {
+            n *= len;
+        }
+        return n;
+    }
+
+    static utils::Result<ScatterInfo> create(
+        infiniopTensorDescriptor_t input_desc,
+        infiniopTensorDescriptor_t output_desc,
+        infiniopTensorDescriptor_t index_desc,
+        infiniopTensorDescriptor_t src_desc,
+        int dim) {
+
+        auto dtype = input_desc->dtype();
+        CHECK_DTYPE(dtype, INFINI_DTYPE_F16, INFINI_DTYPE_F32, INFINI_DTYPE_F64, INFINI_DTYPE_BF16,
+                    INFINI_DTYPE_I8, INFINI_DTYPE_I16, INFINI_DTYPE_I32, INFINI_DTYPE_I64,
+                    INFINI_DTYPE_U8, INFINI_DTYPE_U16, INFINI_DTYPE_U32, INFINI_DTYPE_U64,
+                    INFINI_DTYPE_BOOL);
+        if (output_desc->dtype() != dtype || src_desc->dtype() != dtype) {
+            return INFINI_STATUS_BAD_TENSOR_DTYPE;
+        }
+        auto index_dtype = index_desc->dtype();
+        CHECK_DTYPE(index_dtype, INFINI_DTYPE_I32, INFINI_DTYPE_I64);
+
+        auto out_shape = output_desc->shape();
+        auto index_shape = index_desc->shape();
+        size_t ndim = out_shape.size();
+        if (dim < 0 || size_t(dim) >= ndim) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        CHECK_SAME_SHAPE(input_desc->shape(), out_shape);
+        CHECK_SAME_SHAPE(src_desc->shape(), index_shape);
+        if (index_shape.size() != ndim) {
+            return INFINI_STATUS_BAD_TENSOR_SHAPE;
+        }
+        // outside the scatter dimension every index position must address an output element
+        for (size_t d = 0; d < ndim; ++d) {
+            if (d != size_t(dim) && index_shape[d] > out_shape[d]) {
+                return INFINI_STATUS_BAD_TENSOR_SHAPE;
+            }
+        }
+
+        // broadcast output dimensions would make different rows write the same elements
+        CHECK_OR_RETURN(!output_desc->hasBroadcastDim(), INFINI_STATUS_BAD_TENSOR_STRIDES);
+
+        auto out_strides = output_desc->strides();
+        auto index_strides = index_desc->strides();
+        auto src_strides = src_desc->strides();
+
+        ScatterInfo info;
+        info.dtype = dtype;
+        info.index_dtype = index_dtype;
+        info.dim = size_t(dim);
+        info.dim_size = out_shape[dim];
+
+        info.scatter_len = index_shape[dim];
+        info.out_stride_scatter = out_strides[dim];
+        info.index_stride_scatter = index_strides[dim];
+        info.src_stride_scatter = src_strides[dim];
+
+        size_t inner = ndim - 1;
+        if (inner == info.dim) {
+            info.inner_len = 1;
+            info.out_stride_inner = info.index_stride_inner = info.src_stride_inner = 0;
+        } else {
+            info.inner_len = index_shape[inner];
+            info.out_stride_inner = out_strides[inner];
+            info.index_stride_inner = index_strides[inner];
+            info.src_stride_inner = src_strides[inner];
+        }
+
+        for (size_t d = 0; d < ndim; ++d) {
+            if (d == info.dim || (d == inner && inner != info.dim)) {
+                continue;
+            }
+            info.row_shape.push_back(index_shape[d]);
+            info.row_out_strides.push_back(out_strides[d]);
+            info.row_index_strides.push_back(index_strides[d]);
+            info.row_src_strides.push_back(src_strides[d]);
+        }
+
+        return utils::Result<ScatterInfo>(info);
+    }
+};
+
+} // namespace op::scatter
+
+#endif // __SCATTER_INFO_H__
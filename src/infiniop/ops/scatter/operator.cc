@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/scatter.h"
 
 #ifdef ENABLE_CPU_API
@@ -26,6 +29,7 @@ __C infiniStatus_t infiniopCreateScatterDescriptor(
     infiniopTensorDescriptor_t index_desc,
     infiniopTensorDescriptor_t src_desc,
     int dim) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateScatterDescriptor, infiniopDestroyScatterDescriptor, handle, desc_ptr, input_desc, output_desc, index_desc, src_desc, dim);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -66,6 +70,37 @@ __C infiniStatus_t infiniopCreateScatterDescriptor(
 #undef CREATE
 }
 
+__C infiniStatus_t infiniopCreateScatterReduceDescriptor(
+    infiniopHandle_t handle,
+    infiniopScatterDescriptor_t *desc_ptr,
+    infiniopTensorDescriptor_t input_desc,
+    infiniopTensorDescriptor_t output_desc,
+    infiniopTensorDescriptor_t index_desc,
+    infiniopTensorDescriptor_t src_desc,
+    int dim,
+    infiniopScatterReduce_t reduce) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateScatterReduceDescriptor, infiniopDestroyScatterDescriptor, handle, desc_ptr, input_desc, output_desc, index_desc, src_desc, dim, reduce);
+
+    switch (handle->device) {
+
+#ifdef ENABLE_CPU_API
+    case INFINI_DEVICE_CPU:
+        return op::scatter::cpu::Descriptor::create(
+            handle,
+            reinterpret_cast<op::scatter::cpu::Descriptor **>(desc_ptr),
+            input_desc,
+            output_desc,
+            index_desc,
+            src_desc,
+            dim,
+            reduce);
+#endif
+
+    default:
+        return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+    }
+}
+
 __C infiniStatus_t infiniopGetScatterWorkspaceSize(infiniopScatterDescriptor_t desc, size_t *size) {
 
 #define GET(CASE, NAMESPACE)                                                               \
@@ -109,11 +144,13 @@ __C infiniStatus_t infiniopScatter(
     const void *index,
     const void *src,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopScatter, desc, workspace, workspace_size, output, input, index, src, stream);
+    INFINIOP_TRACE(infiniopScatter, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                     \
-    case CASE:                                                                         \
-        return reinterpret_cast<op::scatter::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, output, input, index, src, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                          \
+    case CASE:                                                                                              \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::scatter::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, output, input, index, src, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -142,6 +179,7 @@ __C infiniStatus_t infiniopScatter(
 
 __C infiniStatus_t
 infiniopDestroyScatterDescriptor(infiniopScatterDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/sigmoid_backward.h"
 
 #ifdef ENABLE_CPU_API
@@ -20,6 +23,7 @@ __C infiniStatus_t infiniopCreateSigmoidBackwardDescriptor(
     infiniopTensorDescriptor_t grad_input_desc,
     infiniopTensorDescriptor_t input_desc,
     infiniopTensorDescriptor_t grad_output_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateSigmoidBackwardDescriptor, infiniopDestroySigmoidBackwardDescriptor, handle, desc_ptr, grad_input_desc, input_desc, grad_output_desc);
 
 #define CREATE(CASE, NAMESPACE)                                                     \
     case CASE:                                                                      \
@@ -89,11 +93,13 @@ __C infiniStatus_t infiniopSigmoidBackward(
     const void *input,
     const void *grad_output,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopSigmoidBackward, desc, workspace, workspace_size, grad_input, input, grad_output, stream);
+    INFINIOP_TRACE(infiniopSigmoidBackward, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                     \
-    case CASE:                                                                         \
-        return reinterpret_cast<const op::sigmoid_backward::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, grad_input, {input, grad_output}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                             \
+    case CASE:                                                                                                 \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::sigmoid_backward::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, grad_input, {input, grad_output}, stream))
 
     switch (desc->device_type) {
 
@@ -120,6 +126,7 @@ __C infiniStatus_t infiniopSigmoidBackward(
 }
 
 __C infiniStatus_t infiniopDestroySigmoidBackwardDescriptor(infiniopSigmoidBackwardDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/silu.h"
 
 #ifdef ENABLE_CPU_API
@@ -19,6 +22,7 @@ __C infiniStatus_t infiniopCreateSiluDescriptor(
     infiniopSiluDescriptor_t *desc_ptr,
     infiniopTensorDescriptor_t y_desc,
     infiniopTensorDescriptor_t x_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateSiluDescriptor, infiniopDestroySiluDescriptor, handle, desc_ptr, y_desc, x_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -92,11 +96,13 @@ __C infiniStatus_t infiniopSilu(
     void *y,
     const void *x,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopSilu, desc, workspace, workspace_size, y, x, stream);
+    INFINIOP_TRACE(infiniopSilu, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                          \
-    case CASE:                                                              \
-        return reinterpret_cast<op::silu::NAMESPACE::Descriptor *>(desc)    \
-            ->calculate(workspace, workspace_size, y, {x}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                           \
+    case CASE:                                                                               \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::silu::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, y, {x}, stream))
 
     switch (reinterpret_cast<InfiniopDescriptor *>(desc)->device_type) {
 
@@ -125,6 +131,8 @@ __C infiniStatus_t infiniopSilu(
 
 __C infiniStatus_t
 infiniopDestroySiluDescriptor(infiniopSiluDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
+
 #define DESTROY(CASE, NAMESPACE)                                            \
     case CASE:                                                              \
         delete reinterpret_cast<op::silu::NAMESPACE::Descriptor *>(desc);   \
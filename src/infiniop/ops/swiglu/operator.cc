@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/swiglu.h"
 
 #ifdef ENABLE_CPU_API
@@ -30,6 +33,7 @@ __C infiniStatus_t infiniopCreateSwiGLUDescriptor(
     infiniopTensorDescriptor_t c_desc,
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateSwiGLUDescriptor, infiniopDestroySwiGLUDescriptor, handle, desc_ptr, c_desc, a_desc, b_desc);
 
 #define CREATE(CASE, NAMESPACE)                                               \
     case CASE:                                                                \
@@ -121,11 +125,13 @@ __C infiniStatus_t infiniopSwiGLU(
     const void *a,
     const void *b,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopSwiGLU, desc, workspace, workspace_size, c, a, b, stream);
+    INFINIOP_TRACE(infiniopSwiGLU, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                               \
-    case CASE:                                                                   \
-        return reinterpret_cast<const op::swiglu::NAMESPACE::Descriptor *>(desc) \
-            ->calculate(workspace, workspace_size, c, {a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                   \
+    case CASE:                                                                                       \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<const op::swiglu::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, c, {a, b}, stream))
 
     switch (desc->device_type) {
 
@@ -163,6 +169,7 @@ __C infiniStatus_t infiniopSwiGLU(
 
 __C infiniStatus_t
 infiniopDestroySwiGLUDescriptor(infiniopSwiGLUDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                   \
     case CASE:                                                                    \
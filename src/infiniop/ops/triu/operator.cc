@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/triu.h"
 
 #ifdef ENABLE_CPU_API
@@ -24,6 +27,7 @@ __C infiniStatus_t infiniopCreateTriuDescriptor(
     infiniopTensorDescriptor_t input_desc,
     infiniopTensorDescriptor_t output_desc,
     int diagonal) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateTriuDescriptor, infiniopDestroyTriuDescriptor, handle, desc_ptr, input_desc, output_desc, diagonal);
 
 #define CREATE(CASE, NAMESPACE)                                            \
     case CASE:                                                             \
@@ -103,11 +107,13 @@ __C infiniStatus_t infiniopTriu(
     void *output,
     void *input,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopTriu, desc, workspace, workspace_size, output, input, stream);
+    INFINIOP_TRACE(infiniopTriu, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                                     \
-    case CASE:                                                                         \
-        return reinterpret_cast<op::triu::NAMESPACE::Descriptor *>(desc)->calculate( \
-            workspace, workspace_size, output, input, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                                       \
+    case CASE:                                                                                           \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::triu::NAMESPACE::Descriptor *>(desc)->calculate( \
+            workspace, workspace_size, output, input, stream))
 
     switch (desc->device_type) {
 #ifdef ENABLE_CPU_API
@@ -136,6 +142,7 @@ __C infiniStatus_t infiniopTriu(
 
 __C infiniStatus_t
 infiniopDestroyTriuDescriptor(infiniopTriuDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DESTROY(CASE, NAMESPACE)                                           \
     case CASE:                                                             \
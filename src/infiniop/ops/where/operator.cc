@@ -1,5 +1,8 @@
 #include "../../operator.h"
 #include "../../handle.h"
+#include "../../descriptor_cache.h"
+#include "../../graph.h"
+#include "../../trace.h"
 #include "infiniop/ops/where.h"
 
 #ifdef ENABLE_CPU_API
@@ -21,6 +24,7 @@ __C infiniStatus_t infiniopCreateWhereDescriptor(
     infiniopTensorDescriptor_t a_desc,
     infiniopTensorDescriptor_t b_desc,
     infiniopTensorDescriptor_t c_desc) {
+    INFINIOP_DESCRIPTOR_CACHE(infiniopCreateWhereDescriptor, infiniopDestroyWhereDescriptor, handle, desc_ptr, condition_desc, a_desc, b_desc, c_desc);
 
 #define CREATE(CASE, NAMESPACE)                                             \
     case CASE:                                                              \
@@ -91,11 +95,13 @@ __C infiniStatus_t infiniopWhere(
     const void *b,
     void *c,
     void *stream) {
+    INFINIOP_GRAPH_CAPTURE(infiniopWhere, desc, workspace, workspace_size, condition, a, b, c, stream);
+    INFINIOP_TRACE(infiniopWhere, desc, workspace_size);
 
-#define CALCULATE(CASE, NAMESPACE)                                         \
-    case CASE:                                                              \
-        return reinterpret_cast<op::where::NAMESPACE::Descriptor *>(desc)      \
-            ->calculate(workspace, workspace_size, c, {condition, a, b}, stream)
+#define CALCULATE(CASE, NAMESPACE)                                                            \
+    case CASE:                                                                                \
+        return INFINIOP_GRAPH_CALL(reinterpret_cast<op::where::NAMESPACE::Descriptor *>(desc) \
+            ->calculate(workspace, workspace_size, c, {condition, a, b}, stream))
 
     switch (desc->device_type) {
 
@@ -122,6 +128,7 @@ __C infiniStatus_t infiniopWhere(
 }
 
 __C infiniStatus_t infiniopDestroyWhereDescriptor(infiniopWhereDescriptor_t desc) {
+    INFINIOP_DESCRIPTOR_CACHE_RELEASE(desc);
 
 #define DELETE(CASE, NAMESPACE)                                                 \
     case CASE:                                                                  \
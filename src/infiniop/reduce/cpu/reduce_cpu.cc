@@ -0,0 +1,355 @@
+#include "reduce_cpu.h"
+#include "../../devices/cpu/common_cpu.h"
+#include <limits>
+#include <type_traits>
+
+namespace op::reduce::cpu {
+
+// kept elements accumulated together by the vectorized traversal
+constexpr size_t REDUCE_TILE = 256;
+// reductions over fewer input elements run on the calling thread
+constexpr size_t REDUCE_PARALLEL_MIN = 16384;
+// fewest reduced positions worth giving to a split of their own
+constexpr size_t REDUCE_SPLIT_MIN = 4096;
+
+// independent work items before the reduced positions are split
+static size_t itemCount(const ReduceInfo &info) {
+    if (!info.vectorize_kept) {
+        return info.output_size;
+    }
+    size_t vec_len = info.kept_shape.back();
+    return info.output_size / vec_len * CEIL_DIV(vec_len, REDUCE_TILE);
+}
+
+size_t splitCount(const ReduceInfo &info) {
+    size_t num_threads = op::common_cpu::getMaxThreads();
+    size_t items = itemCount(info);
+    if (items == 0 || items >= num_threads || info.output_size * info.reduce_size < REDUCE_PARALLEL_MIN) {
+        return 1;
+    }
+    return std::max<size_t>(1, std::min(CEIL_DIV(num_threads, items), info.reduce_size / REDUCE_SPLIT_MIN));
+}
+
+size_t partialWorkspaceSize(const ReduceInfo &info, size_t splits) {
+    // one partial value and argmax index per split and output
+    return splits > 1 ? splits * info.output_size * (sizeof(int64_t) + sizeof(double)) : 0;
+}
+
+template <typename Tdst, typename Tsrc>
+inline Tdst convert(const Tsrc &x) {
+    if constexpr (std::is_same_v<Tdst, Tsrc>) {
+        return x;
+    } else {
+        return utils::cast<Tdst>(x);
+    }
+}
+
+template <infiniopReduceMode_t Mode, typename Tacc>
+inline Tacc identity() {
+    if constexpr (Mode == INFINIOP_REDUCE_PROD) {
+        return Tacc(1);
+    } else if constexpr (Mode == INFINIOP_REDUCE_MAX || Mode == INFINIOP_REDUCE_ARGMAX) {
+        return -std::numeric_limits<Tacc>::infinity();
+    } else if constexpr (Mode == INFINIOP_REDUCE_MIN) {
+        return std::numeric_limits<Tacc>::infinity();
+    } else {
+        return Tacc(0);
+    }
+}
+
+// folds one element into the accumulator
+template <infiniopReduceMode_t Mode, typename Tacc>
+inline Tacc step(Tacc acc, Tacc x) {
+    if constexpr (Mode == INFINIOP_REDUCE_NORM2) {
+        return acc + x * x;
+    } else if constexpr (Mode == INFINIOP_REDUCE_PROD) {
+        return acc * x;
+    } else if constexpr (Mode == INFINIOP_REDUCE_MAX) {
+        return x > acc ? x : acc;
+    } else if constexpr (Mode == INFINIOP_REDUCE_MIN) {
+        return x < acc ? x : acc;
+    } else {
+        return acc + x;
+    }
+}
+
+// combines the accumulators of two ranges of reduced positions
+template <infiniopReduceMode_t Mode, typename Tacc>
+inline Tacc merge(Tacc a, Tacc b) {
+    if constexpr (Mode == INFINIOP_REDUCE_NORM2) {
+        return a + b;
+    } else {
+        return step<Mode>(a, b);
+    }
+}
+
+template <infiniopReduceMode_t Mode, typename Tout, typename Tacc>
+inline Tout finish(Tacc acc, int64_t arg, size_t reduce_size) {
+    if constexpr (Mode == INFINIOP_REDUCE_ARGMAX) {
+        return arg;
+    } else if constexpr (Mode == INFINIOP_REDUCE_MEAN) {
+        return convert<Tout>(acc / Tacc(reduce_size));
+    } else if constexpr (Mode == INFINIOP_REDUCE_NORM2) {
+        return convert<Tout>(std::sqrt(acc));
+    } else {
+        return convert<Tout>(acc);
+    }
+}
+
+// Folds `len` elements `stride` apart into acc, the first one being reduced position `first`.
+// Besides argmax the elements are summed (or multiplied, ...) on their own first, so the loop vectorizes.
+template <infiniopReduceMode_t Mode, bool Contiguous, typename T, typename Tacc>
+inline void reduceSegment(const T *x, size_t len, ptrdiff_t stride_, size_t first, Tacc &acc, int64_t &arg) {
+    const ptrdiff_t stride = Contiguous ? 1 : stride_;
+    if constexpr (Mode == INFINIOP_REDUCE_ARGMAX) {
+        for (size_t i = 0; i < len; ++i) {
+            Tacc v = convert<Tacc>(x[ptrdiff_t(i) * stride]);
+            if (v > acc) {
+                acc = v;
+                arg = int64_t(first + i);
+            }
+        }
+    } else if constexpr (Mode == INFINIOP_REDUCE_PROD) {
+        Tacc p = 1;
+#pragma omp simd reduction(* : p)
+        for (size_t i = 0; i < len; ++i) {
+            p *= convert<Tacc>(x[ptrdiff_t(i) * stride]);
+        }
+        acc *= p;
+    } else if constexpr (Mode == INFINIOP_REDUCE_MAX) {
+        Tacc m = acc;
+#pragma omp simd reduction(max : m)
+        for (size_t i = 0; i < len; ++i) {
+            Tacc v = convert<Tacc>(x[ptrdiff_t(i) * stride]);
+            m = v > m ? v : m;
+        }
+        acc = m;
+    } else if constexpr (Mode == INFINIOP_REDUCE_MIN) {
+        Tacc m = acc;
+#pragma omp simd reduction(min : m)
+        for (size_t i = 0; i < len; ++i) {
+            Tacc v = convert<Tacc>(x[ptrdiff_t(i) * stride]);
+            m = v < m ? v : m;
+        }
+        acc = m;
+    } else {
+        Tacc s = 0;
+#pragma omp simd reduction(+ : s)
+        for (size_t i = 0; i < len; ++i) {
+            s = step<Mode>(s, convert<Tacc>(x[ptrdiff_t(i) * stride]));
+        }
+        acc += s;
+    }
+}
+
+// folds the elements at reduced position `pos` of a tile of `n` contiguous kept elements
+template <infiniopReduceMode_t Mode, typename T, typename Tacc>
+inline void accumulateTile(const T *x, size_t n, size_t pos, Tacc *acc, int64_t *arg) {
+    if constexpr (Mode == INFINIOP_REDUCE_ARGMAX) {
+        for (size_t j = 0; j < n; ++j) {
+            Tacc v = convert<Tacc>(x[j]);
+            if (v > acc[j]) {
+                acc[j] = v;
+                arg[j] = int64_t(pos);
+            }
+        }
+    } else {
+#pragma omp simd
+        for (size_t j = 0; j < n; ++j) {
+            acc[j] = step<Mode>(acc[j], convert<Tacc>(x[j]));
+        }
+    }
+}
+
+// input offset of a position of the reduced dimensions other than the innermost one
+inline ptrdiff_t outerReducedOffset(const ReduceInfo &info, size_t pos) {
+    ptrdiff_t offset = 0;
+    for (size_t d = info.reduced_shape.size(); d-- > 1;) {
+        size_t len = info.reduced_shape[d - 1];
+        offset += ptrdiff_t(pos % len) * info.reduced_strides[d - 1];
+        pos /= len;
+    }
+    return offset;
+}
+
+// calls f(input offset, first reduced position, length, stride) for each run of the
+// innermost reduced dimension in the reduced positions [r0, r1)
+template <typename F>
+inline void forEachRun(const ReduceInfo &info, size_t r0, size_t r1, F &&f) {
+    bool flat = info.reduced_shape.empty();
+    size_t inner_len = flat ? 1 : info.reduced_shape.back();
+    ptrdiff_t inner_stride = flat ? 0 : info.reduced_strides.back();
+    for (size_t r = r0; r < r1;) {
+        size_t k = r % inner_len;
+        size_t len = std::min(inner_len - k, r1 - r);
+        f(outerReducedOffset(info, r / inner_len) + ptrdiff_t(k) * inner_stride, r, len, inner_stride);
+        r += len;
+    }
+}
+
+// input and output offsets of a position of the first `ndim` kept dimensions
+inline void keptOffsets(const ReduceInfo &info, size_t ndim, size_t pos, ptrdiff_t &input_offset, ptrdiff_t &output_offset) {
+    input_offset = output_offset = 0;
+    for (size_t d = ndim; d-- > 0;) {
+        ptrdiff_t coord = ptrdiff_t(pos % info.kept_shape[d]);
+        pos /= info.kept_shape[d];
+        input_offset += coord * info.kept_input_strides[d];
+        output_offset += coord * info.kept_output_strides[d];
+    }
+}
+
+template <infiniopReduceMode_t Mode, typename T, typename Tout, typename Tacc>
+void reduceImpl(const ReduceInfo &info, size_t splits, void *workspace, Tout *output, const T *input) {
+    const size_t reduce_size = info.reduce_size;
+    const size_t output_size = info.output_size;
+    const size_t kept_ndim = info.kept_shape.size();
+    const size_t chunk = CEIL_DIV(reduce_size, splits);
+    const bool parallel = output_size * reduce_size >= REDUCE_PARALLEL_MIN;
+
+    // with several splits every one writes its partial result for output q at [split * output_size + q]
+    int64_t *partial_arg = reinterpret_cast<int64_t *>(workspace);
+    Tacc *partial = reinterpret_cast<Tacc *>(partial_arg + splits * output_size);
+    auto store = [&](size_t split, size_t q, ptrdiff_t output_offset, Tacc acc, int64_t arg) {
+        if (splits > 1) {
+            partial[split * output_size + q] = acc;
+            partial_arg[split * output_size + q] = arg;
+        } else {
+            output[output_offset] = finish<Mode, Tout>(acc, arg, reduce_size);
+        }
+    };
+
+    if (!info.vectorize_kept) {
+        const ptrdiff_t items = ptrdiff_t(output_size * splits);
+
+#pragma omp parallel for schedule(static) if (parallel)
+        for (ptrdiff_t item = 0; item < items; ++item) {
+            size_t split = size_t(item) % splits;
+            size_t q = size_t(item) / splits;
+            size_t r0 = std::min(reduce_size, split * chunk);
+            size_t r1 = std::min(reduce_size, r0 + chunk);
+
+            ptrdiff_t input_offset, output_offset;
+            keptOffsets(info, kept_ndim, q, input_offset, output_offset);
+            const T *x = input + input_offset;
+
+            Tacc acc = identity<Mode, Tacc>();
+            int64_t arg = 0;
+            forEachRun(info, r0, r1, [&](ptrdiff_t offset, size_t first, size_t len, ptrdiff_t stride) {
+                if (stride == 1) {
+                    reduceSegment<Mode, true>(x + offset, len, stride, first, acc, arg);
+                } else {
+                    reduceSegment<Mode, false>(x + offset, len, stride, first, acc, arg);
+                }
+            });
+            store(split, q, output_offset, acc, arg);
+        }
+    } else {
+        const size_t vec_len = info.kept_shape.back();
+        const ptrdiff_t vec_output_stride = info.kept_output_strides.back();
+        const size_t tiles = CEIL_DIV(vec_len, REDUCE_TILE);
+        const ptrdiff_t items = ptrdiff_t(output_size / vec_len * tiles * splits);
+
+#pragma omp parallel for schedule(static) if (parallel)
+        for (ptrdiff_t item = 0; item < items; ++item) {
+            size_t split = size_t(item) % splits;
+            size_t rest = size_t(item) / splits;
+            size_t j0 = rest % tiles * REDUCE_TILE;
+            size_t row = rest / tiles;
+            size_t tb = std::min(REDUCE_TILE, vec_len - j0);
+            size_t r0 = std::min(reduce_size, split * chunk);
+            size_t r1 = std::min(reduce_size, r0 + chunk);
+
+            ptrdiff_t input_offset, output_offset;
+            keptOffsets(info, kept_ndim - 1, row, input_offset, output_offset);
+            const T *x = input + input_offset + ptrdiff_t(j0);
+            output_offset += ptrdiff_t(j0) * vec_output_stride;
+
+            Tacc acc[REDUCE_TILE];
+            int64_t arg[REDUCE_TILE];
+            for (size_t j = 0; j < tb; ++j) {
+                acc[j] = identity<Mode, Tacc>();
+                arg[j] = 0;
+            }
+            forEachRun(info, r0, r1, [&](ptrdiff_t offset, size_t first, size_t len, ptrdiff_t stride) {
+                for (size_t k = 0; k < len; ++k) {
+                    accumulateTile<Mode>(x + offset + ptrdiff_t(k) * stride, tb, first + k, acc, arg);
+                }
+            });
+            for (size_t j = 0; j < tb; ++j) {
+                store(split, row * vec_len + j0 + j, output_offset + ptrdiff_t(j) * vec_output_stride, acc[j], arg[j]);
+            }
+        }
+    }
+
+    if (splits == 1) {
+        return;
+    }
+
+    // combine the splits in order, so argmax still finds the first maximum
+#pragma omp parallel for schedule(static) if (output_size >= REDUCE_TILE)
+    for (ptrdiff_t q = 0; q < ptrdiff_t(output_size); ++q) {
+        Tacc acc = partial[q];
+        int64_t arg = partial_arg[q];
+        for (size_t split = 1; split < splits; ++split) {
+            Tacc v = partial[split * output_size + q];
+            if constexpr (Mode == INFINIOP_REDUCE_ARGMAX) {
+                if (v > acc) {
+                    acc = v;
+                    arg = partial_arg[split * output_size + q];
+                }
+            } else {
+                acc = merge<Mode>(acc, v);
+            }
+        }
+        ptrdiff_t input_offset, output_offset;
+        keptOffsets(info, kept_ndim, size_t(q), input_offset, output_offset);
+        output[output_offset] = finish<Mode, Tout>(acc, arg, reduce_size);
+    }
+}
+
+template <typename T>
+infiniStatus_t reduceType(const ReduceInfo &info, infiniopReduceMode_t mode, size_t splits,
+                          void *workspace, void *output, const void *input) {
+    using Tacc = std::conditional_t<std::is_same_v<T, double>, double, float>;
+
+#define REDUCE(MODE, TOUT)                                                                           \
+    case MODE:                                                                                       \
+        reduceImpl<MODE, T, TOUT, Tacc>(info, splits, workspace, (TOUT *)output, (const T *)input); \
+        return INFINI_STATUS_SUCCESS
+
+    switch (mode) {
+        REDUCE(INFINIOP_REDUCE_SUM, T);
+        REDUCE(INFINIOP_REDUCE_MEAN, T);
+        REDUCE(INFINIOP_REDUCE_MAX, T);
+        REDUCE(INFINIOP_REDUCE_MIN, T);
+        REDUCE(INFINIOP_REDUCE_ARGMAX, int64_t);
+        REDUCE(INFINIOP_REDUCE_PROD, T);
+        REDUCE(INFINIOP_REDUCE_NORM2, T);
+    default:
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+#undef REDUCE
+}
+
+infiniStatus_t reduce(const ReduceInfo &info, infiniopReduceMode_t mode, size_t splits,
+                      void *workspace, void *output, const void *input) {
+    if (info.output_size == 0) {
+        return INFINI_STATUS_SUCCESS;
+    }
+
+    switch (info.dtype) {
+    case INFINI_DTYPE_F16:
+        return reduceType<fp16_t>(info, mode, splits, workspace, output, input);
+    case INFINI_DTYPE_BF16:
+        return reduceType<bf16_t>(info, mode, splits, workspace, output, input);
+    case INFINI_DTYPE_F32:
+        return reduceType<float>(info, mode, splits, workspace, output, input);
+    case INFINI_DTYPE_F64:
+        return reduceType<double>(info, mode, splits, workspace, output, input);
+    default:
+        return INFINI_STATUS_BAD_TENSOR_DTYPE;
+    }
+}
+
+} // namespace op::reduce::cpu
@@ -0,0 +1,23 @@
+#ifndef __INFINIOP_REDUCE_ENGINE_CPU_H__
+#define __INFINIOP_REDUCE_ENGINE_CPU_H__
+
+#include "../reduce.h"
+#include "infiniop/ops/reduce.h"
+
+namespace op::reduce::cpu {
+
+// Number of ranges the reduced positions of every output are split into. Above 1 when
+// there are too few outputs to keep all threads busy, the partial results then go
+// through the workspace.
+size_t splitCount(const ReduceInfo &info);
+
+size_t partialWorkspaceSize(const ReduceInfo &info, size_t splits);
+
+// The output has the input dtype, except for INFINIOP_REDUCE_ARGMAX whose output is i64.
+// Half-precision inputs are accumulated in f32.
+infiniStatus_t reduce(const ReduceInfo &info, infiniopReduceMode_t mode, size_t splits,
+                      void *workspace, void *output, const void *input);
+
+} // namespace op::reduce::cpu
+
+#endif // __INFINIOP_REDUCE_ENGINE_CPU_H__
@@ -0,0 +1,228 @@
+#ifndef __INFINIOP_SOFTMAX_CPU_H__
+#define __INFINIOP_SOFTMAX_CPU_H__
+
+#include "../../../utils.h"
+#include "../../devices/cpu/common_cpu.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace op::common_cpu::softmax_op {
+
+// elements of a row converted to f32 and processed together
+constexpr size_t SOFTMAX_BLOCK = 256;
+// rows shorter than this are never split between threads
+constexpr size_t SOFTMAX_SPLIT_MIN = 16384;
+// softmaxes over fewer elements run on the calling thread
+constexpr size_t SOFTMAX_PARALLEL_MIN = 16384;
+
+/**
+ * exp(x) that vectorizes: x = n ln2 + r with |r| <= ln2 / 2, e^r from its Taylor polynomial
+ * of degree 7 and 2^n built in the exponent bits. The relative error is below 1.5e-7 (about
+ * 1 ulp) for x in [-87, 88]; x is clamped to that range, so exp of -inf is 1.6e-38, not 0.
+ * NaN is passed through. The clamp and the NaN test compare the bits as integers, float
+ * comparisons would keep the loops from vectorizing unless the compiler may ignore
+ * floating-point traps.
+ */
+inline float expApprox(float x) {
+    constexpr float LOG2E = 1.44269504f;
+    constexpr float LN2_HI = 0.693145752f;
+    constexpr float LN2_LO = 1.42860677e-6f;
+    // adding 1.5 * 2^23 rounds to an integer that sits in the low mantissa bits
+    constexpr float ROUND = 12582912.0f;
+
+    uint32_t xb;
+    std::memcpy(&xb, &x, sizeof(x));
+    // all ones for NaN
+    const uint32_t nan = 0u - uint32_t((xb & 0x7FFFFFFFu) > 0x7F800000u);
+    const uint32_t input = xb;
+    // negative values order by magnitude as unsigned integers, positive ones as signed
+    // integers; the literals are -87.0f and 88.0f
+    xb = xb > 0xC2AE0000u ? 0xC2AE0000u : xb;
+    xb = int32_t(xb) > 0x42B00000 ? 0x42B00000u : xb;
+    std::memcpy(&x, &xb, sizeof(x));
+
+    float t = x * LOG2E + ROUND;
+    float n = t - ROUND;
+    float r = x - n * LN2_HI - n * LN2_LO;
+    float p = 1.0f + r * (1.0f + r * (1.0f / 2 + r * (1.0f / 6 + r * (1.0f / 24 + r * (1.0f / 120 + r * (1.0f / 720 + r * (1.0f / 5040)))))));
+
+    int32_t tb, rb;
+    std::memcpy(&tb, &t, sizeof(t));
+    std::memcpy(&rb, &ROUND, sizeof(ROUND));
+    int32_t bits = (tb - rb + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(bits));
+    float y = p * scale;
+
+    uint32_t yb;
+    std::memcpy(&yb, &y, sizeof(y));
+    yb = (input & nan) | (yb & ~nan);
+    std::memcpy(&y, &yb, sizeof(y));
+    return y;
+}
+
+// running maximum of a sequence and the sum of exp(x - max) over it
+struct Stats {
+    float max = -std::numeric_limits<float>::infinity();
+    float sum = 0;
+};
+
+inline Stats merge(Stats a, Stats b) {
+    float m = std::max(a.max, b.max);
+    if (m == -std::numeric_limits<float>::infinity()) {
+        return a;
+    }
+    return {m, a.sum * expApprox(a.max - m) + b.sum * expApprox(b.max - m)};
+}
+
+template <typename T>
+inline void loadBlock(float *buf, const T *x, size_t n, ptrdiff_t stride) {
+    for (size_t k = 0; k < n; ++k) {
+        if constexpr (std::is_same_v<T, float>) {
+            buf[k] = x[ptrdiff_t(k) * stride];
+        } else {
+            buf[k] = utils::cast<float>(x[ptrdiff_t(k) * stride]);
+        }
+    }
+}
+
+template <typename T>
+inline void storeBlock(T *y, const float *buf, size_t n, ptrdiff_t stride) {
+    for (size_t k = 0; k < n; ++k) {
+        if constexpr (std::is_same_v<T, float>) {
+            y[ptrdiff_t(k) * stride] = buf[k];
+        } else {
+            y[ptrdiff_t(k) * stride] = utils::cast<T>(buf[k]);
+        }
+    }
+}
+
+/**
+ * Stats of `len` elements in one read: each block is converted to f32, its maximum
+ * found, and the running sum rescaled to the new maximum before the block is added.
+ * The plain sum of the elements is added to `x_sum` when it is given.
+ */
+template <typename T>
+Stats stats(const T *x, size_t len, ptrdiff_t stride, float *x_sum = nullptr) {
+    Stats s;
+    float buf[SOFTMAX_BLOCK];
+    for (size_t j = 0; j < len; j += SOFTMAX_BLOCK) {
+        size_t n = std::min(SOFTMAX_BLOCK, len - j);
+        loadBlock(buf, x + ptrdiff_t(j) * stride, n, stride);
+
+        if (x_sum) {
+            float sum = 0;
+#pragma omp simd reduction(+ : sum)
+            for (size_t k = 0; k < n; ++k) {
+                sum += buf[k];
+            }
+            *x_sum += sum;
+        }
+
+        float m = s.max;
+#pragma omp simd reduction(max : m)
+        for (size_t k = 0; k < n; ++k) {
+            m = buf[k] > m ? buf[k] : m;
+        }
+        if (m == -std::numeric_limits<float>::infinity()) {
+            continue;
+        }
+        float sum = 0;
+#pragma omp simd reduction(+ : sum)
+        for (size_t k = 0; k < n; ++k) {
+            sum += expApprox(buf[k] - m);
+        }
+        s.sum = s.sum * expApprox(s.max - m) + sum;
+        s.max = m;
+    }
+    return s;
+}
+
+// y = exp(x - max) / sum
+template <typename Ty, typename Tx>
+void writeSoftmax(Ty *y, ptrdiff_t y_stride, const Tx *x, ptrdiff_t x_stride, size_t len, Stats s) {
+    float buf[SOFTMAX_BLOCK];
+    float inv = 1.0f / s.sum;
+    for (size_t j = 0; j < len; j += SOFTMAX_BLOCK) {
+        size_t n = std::min(SOFTMAX_BLOCK, len - j);
+        loadBlock(buf, x + ptrdiff_t(j) * x_stride, n, x_stride);
+#pragma omp simd
+        for (size_t k = 0; k < n; ++k) {
+            buf[k] = expApprox(buf[k] - s.max) * inv;
+        }
+        storeBlock(y + ptrdiff_t(j) * y_stride, buf, n, y_stride);
+    }
+}
+
+// y = x - max - log(sum)
+template <typename Ty, typename Tx>
+void writeLogSoftmax(Ty *y, ptrdiff_t y_stride, const Tx *x, ptrdiff_t x_stride, size_t len, Stats s) {
+    float buf[SOFTMAX_BLOCK];
+    float shift = s.max + std::log(s.sum);
+    for (size_t j = 0; j < len; j += SOFTMAX_BLOCK) {
+        size_t n = std::min(SOFTMAX_BLOCK, len - j);
+        loadBlock(buf, x + ptrdiff_t(j) * x_stride, n, x_stride);
+#pragma omp simd
+        for (size_t k = 0; k < n; ++k) {
+            buf[k] -= shift;
+        }
+        storeBlock(y + ptrdiff_t(j) * y_stride, buf, n, y_stride);
+    }
+}
+
+// Number of ranges each row is split into, above 1 only for long rows when there are
+// fewer rows than threads. The partial stats then need `rows * parts` Stats of workspace.
+inline size_t splitCount(size_t rows, size_t len) {
+    size_t num_threads = getMaxThreads();
+    if (rows == 0 || rows >= num_threads || len < 2 * SOFTMAX_SPLIT_MIN) {
+        return 1;
+    }
+    return std::min(CEIL_DIV(num_threads, rows), len / SOFTMAX_SPLIT_MIN);
+}
+
+// [begin, end) of `part` when `len` elements are split into `parts` ranges
+inline std::pair<size_t, size_t> partRange(size_t len, size_t part, size_t parts) {
+    size_t chunk = CEIL_DIV(len, parts);
+    size_t begin = std::min(len, part * chunk);
+    return {begin, std::min(len, begin + chunk)};
+}
+
+/**
+ * Drives a row-wise softmax. `stats_fn(row, part)` returns the stats of a part of a row and
+ * `write_fn(row, part, stats)` writes that part given the stats of the whole row. With one
+ * part a row is written right after it is read, while it is still in cache; otherwise the
+ * partial stats go through `partial` and are merged by every part of the row. The stats are
+ * Stats or any type with a `merge` of its own whose value-initialized state is empty.
+ */
+template <typename S, typename StatsFn, typename WriteFn>
+void rowwise(size_t rows, size_t parts, bool parallel, S *partial, StatsFn &&stats_fn, WriteFn &&write_fn) {
+    if (parts == 1) {
+#pragma omp parallel for schedule(static) if (parallel)
+        for (ptrdiff_t row = 0; row < ptrdiff_t(rows); ++row) {
+            write_fn(size_t(row), size_t(0), stats_fn(size_t(row), size_t(0)));
+        }
+        return;
+    }
+
+    const ptrdiff_t items = ptrdiff_t(rows * parts);
+#pragma omp parallel for schedule(static) if (parallel)
+    for (ptrdiff_t item = 0; item < items; ++item) {
+        partial[item] = stats_fn(size_t(item) / parts, size_t(item) % parts);
+    }
+#pragma omp parallel for schedule(static) if (parallel)
+    for (ptrdiff_t item = 0; item < items; ++item) {
+        size_t row = size_t(item) / parts;
+        S s{};
+        for (size_t part = 0; part < parts; ++part) {
+            s = merge(s, partial[row * parts + part]);
+        }
+        write_fn(row, size_t(item) % parts, s);
+    }
+}
+
+} // namespace op::common_cpu::softmax_op
+
+#endif // __INFINIOP_SOFTMAX_CPU_H__
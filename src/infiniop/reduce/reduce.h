@@ -0,0 +1,160 @@
+#ifndef __INFINIOP_REDUCE_H__
+#define __INFINIOP_REDUCE_H__
+
+#include "../../utils.h"
+#include "../operator.h"
+#include "../tensor.h"
+#include <algorithm>
+#include <vector>
+
+namespace op::reduce {
+
+/**
+ * Loop geometry of a reduction of input over a set of axes.
+ *
+ * Dimensions of length 1 are dropped, and neighbouring dimensions that can be walked
+ * as one are merged, separately for the kept and the reduced dimensions. The reduced
+ * dimensions stay in axis order, so walking them in row-major order visits the
+ * reduced positions in the order of their flattened index.
+ *
+ * Two traversals are planned:
+ * - the reduced elements of one output are walked with the innermost reduced
+ *   dimension as the inner loop, which is the fast one when it is contiguous;
+ * - when the innermost reduced dimension is strided but a kept dimension is
+ *   contiguous in input (`vectorize_kept`), a tile of that kept dimension is
+ *   accumulated at once for every reduced position. That dimension is then the
+ *   last kept one.
+ *
+ * All strides are in elements.
+ */
+class ReduceInfo {
+    ReduceInfo() = default;
+
+public:
+    infiniDtype_t dtype;
+
+    size_t output_size;
+    // number of reduced elements per output
+    size_t reduce_size;
+
+    std::vector<size_t> kept_shape;
+    std::vector<ptrdiff_t> kept_input_strides, kept_output_strides;
+
+    std::vector<size_t> reduced_shape;
+    std::vector<ptrdiff_t> reduced_strides;
+
+    bool vectorize_kept;
+
+    /**
+     * `naxes == 0` reduces every axis. With `keepdim` the output has the rank of input
+     * and length 1 on the reduced axes, otherwise the reduced axes are dropped.
+     */
+    static utils::Result<ReduceInfo> create(
+        infiniopTensorDescriptor_t output_desc,
+        infiniopTensorDescriptor_t input_desc,
+        const size_t *axes,
+        size_t naxes,
+        bool keepdim) {
+
+        auto input_shape = input_desc->shape();
+        auto input_strides = input_desc->strides();
+        size_t ndim = input_shape.size();
+
+        std::vector<bool> reduced(ndim, naxes == 0);
+        for (size_t i = 0; i < naxes; ++i) {
+            if (axes[i] >= ndim || reduced[axes[i]]) {
+                return INFINI_STATUS_BAD_PARAM;
+            }
+            reduced[axes[i]] = true;
+        }
+
+        // the output dimension each input dimension maps to, if any
+        std::vector<size_t> output_shape;
+        std::vector<size_t> output_dim(ndim);
+        for (size_t d = 0; d < ndim; ++d) {
+            output_dim[d] = output_shape.size();
+            if (!reduced[d]) {
+                output_shape.push_back(input_shape[d]);
+            } else if (keepdim) {
+                output_shape.push_back(1);
+            }
+        }
+        CHECK_SAME_SHAPE(output_desc->shape(), output_shape);
+        auto output_strides = output_desc->strides();
+
+        ReduceInfo info;
+        info.dtype = input_desc->dtype();
+        info.output_size = 1;
+        info.reduce_size = 1;
+
+        for (size_t d = 0; d < ndim; ++d) {
+            size_t len = input_shape[d];
+            if (reduced[d]) {
+                info.reduce_size *= len;
+                if (len == 1) {
+                    continue;
+                }
+                if (!info.reduced_shape.empty() && info.reduced_strides.back() == ptrdiff_t(len) * input_strides[d]) {
+                    info.reduced_shape.back() *= len;
+                    info.reduced_strides.back() = input_strides[d];
+                } else {
+                    info.reduced_shape.push_back(len);
+                    info.reduced_strides.push_back(input_strides[d]);
+                }
+            } else {
+                info.output_size *= len;
+                if (len != 1) {
+                    info.kept_shape.push_back(len);
+                    info.kept_input_strides.push_back(input_strides[d]);
+                    info.kept_output_strides.push_back(output_strides[output_dim[d]]);
+                }
+            }
+        }
+
+        // vectorize across the last kept dimension that is contiguous in input
+        size_t vec_dim = info.kept_shape.size();
+        for (size_t i = 0; i < info.kept_shape.size(); ++i) {
+            if (info.kept_input_strides[i] == 1) {
+                vec_dim = i;
+            }
+        }
+        info.vectorize_kept = vec_dim < info.kept_shape.size()
+                           && !info.reduced_shape.empty()
+                           && info.reduced_strides.back() != 1;
+        if (info.vectorize_kept) {
+            auto rotate = [vec_dim](auto &v) {
+                std::rotate(v.begin() + vec_dim, v.begin() + vec_dim + 1, v.end());
+            };
+            rotate(info.kept_shape);
+            rotate(info.kept_input_strides);
+            rotate(info.kept_output_strides);
+        }
+
+        // merge kept dimensions that are contiguous with each other in both input and output
+        size_t merged = 0;
+        for (size_t i = 0; i < info.kept_shape.size(); ++i) {
+            ptrdiff_t len = ptrdiff_t(info.kept_shape[i]);
+            if (merged > 0
+                && info.kept_input_strides[merged - 1] == len * info.kept_input_strides[i]
+                && info.kept_output_strides[merged - 1] == len * info.kept_output_strides[i]) {
+                info.kept_shape[merged - 1] *= info.kept_shape[i];
+                info.kept_input_strides[merged - 1] = info.kept_input_strides[i];
+                info.kept_output_strides[merged - 1] = info.kept_output_strides[i];
+            } else {
+                info.kept_shape[merged] = info.kept_shape[i];
+                info.kept_input_strides[merged] = info.kept_input_strides[i];
+                info.kept_output_strides[merged] = info.kept_output_strides[i];
+                ++merged;
+            }
+        }
+        info.kept_shape.resize(merged);
+        info.kept_input_strides.resize(merged);
+        info.kept_output_strides.resize(merged);
+
+        return utils::Result<ReduceInfo>(info);
+    }
+};
+
+} // namespace op::reduce
+
+#endif // __INFINIOP_REDUCE_H__
@@ -0,0 +1,209 @@
+#include "trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace op::trace {
+
+std::atomic<bool> active{false};
+thread_local bool suppressed = false;
+
+namespace {
+
+constexpr size_t DEFAULT_EVENTS_PER_THREAD = 1 << 16;
+
+// An event and its sequence number: odd while the event is being written, 2 * (n + 1) once it
+// holds the event n of its ring. Readers keep the copies made under an unchanged, expected number.
+struct Slot {
+    std::atomic<uint64_t> seq{0};
+    Event event;
+};
+
+// Calls recorded by one thread, overwriting the oldest once full. Only the owning thread writes,
+// `head` counts the events written so far.
+struct Ring {
+    std::unique_ptr<Slot[]> slots;
+    size_t size;
+    std::atomic<size_t> head{0};
+    size_t tid;
+};
+
+// guards the rings and the signatures, taken when a thread records its first call of a trace
+std::mutex mutex;
+std::vector<std::unique_ptr<Ring>> rings;
+std::unordered_map<std::string, std::unique_ptr<Signature>> signatures;
+size_t events_per_thread = DEFAULT_EVENTS_PER_THREAD;
+uint64_t trace_start = 0;
+// bumped by every start, so threads drop the rings of the previous trace
+std::atomic<uint64_t> generation{0};
+
+thread_local Ring *thread_ring = nullptr;
+thread_local uint64_t thread_generation = 0;
+
+Ring *ring() {
+    auto current = generation.load(std::memory_order_acquire);
+    if (thread_ring == nullptr || thread_generation != current) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto ring = std::make_unique<Ring>();
+        ring->slots = std::make_unique<Slot[]>(events_per_thread);
+        ring->size = events_per_thread;
+        ring->tid = rings.size();
+        thread_ring = ring.get();
+        thread_generation = current;
+        rings.push_back(std::move(ring));
+    }
+    return thread_ring;
+}
+
+// Calls `f` on the events recorded so far. The threads may keep recording meanwhile, the events
+// overwritten before they are read are skipped.
+template <typename F>
+void forEachEvent(F f) {
+    for (const auto &ring : rings) {
+        size_t head = ring->head.load(std::memory_order_acquire);
+        size_t size = ring->size;
+        for (size_t i = head > size ? head - size : 0; i < head; ++i) {
+            const Slot &slot = ring->slots[i % size];
+            uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq != 2 * (i + 1)) {
+                continue;
+            }
+            Event event = slot.event;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq) {
+                continue;
+            }
+            f(*ring, event);
+        }
+    }
+}
+
+// writes `s` as the contents of a JSON string
+void writeEscaped(std::ostream &out, const std::string &s) {
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+}
+
+} // namespace
+
+uint64_t now() {
+    return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch())
+                        .count());
+}
+
+const Signature *intern(std::string tensors) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &signature = signatures[tensors];
+    if (!signature) {
+        signature = std::make_unique<Signature>(Signature{std::move(tensors)});
+    }
+    return signature.get();
+}
+
+void record(const Event &event) {
+    Ring *r = ring();
+    size_t head = r->head.load(std::memory_order_relaxed);
+    Slot &slot = r->slots[head % r->size];
+    slot.seq.store(2 * head + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = event;
+    slot.seq.store(2 * (head + 1), std::memory_order_release);
+    r->head.store(head + 1, std::memory_order_release);
+}
+
+} // namespace op::trace
+
+__C infiniStatus_t infiniopStartTrace(size_t events_per_thread) {
+    using namespace op::trace;
+    std::lock_guard<std::mutex> lock(mutex);
+    // signatures stay, descriptors created before keep pointing to theirs
+    rings.clear();
+    op::trace::events_per_thread = events_per_thread != 0 ? events_per_thread : DEFAULT_EVENTS_PER_THREAD;
+    trace_start = now();
+    generation.fetch_add(1, std::memory_order_release);
+    active.store(true, std::memory_order_relaxed);
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopStopTrace() {
+    op::trace::active.store(false, std::memory_order_relaxed);
+    return INFINI_STATUS_SUCCESS;
+}
+
+__C infiniStatus_t infiniopExportTrace(const char *path) {
+    if (path == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    using namespace op::trace;
+    std::ofstream out(path);
+    if (!out) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    char time[64];
+    forEachEvent([&](const Ring &ring, const Event &event) {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        // microseconds since the start of the trace
+        snprintf(time, sizeof(time), "\"ts\":%.3f,\"dur\":%.3f",
+                 double(event.start - trace_start) / 1e3, double(event.end - event.start) / 1e3);
+        out << "{\"name\":\"" << event.op << "\",\"cat\":\"infiniop\",\"ph\":\"X\"," << time
+            << ",\"pid\":0,\"tid\":" << ring.tid << ",\"args\":{\"device\":" << int(event.device)
+            << ",\"device_id\":" << event.device_id << ",\"workspace\":" << event.workspace_size
+            << ",\"bytes\":" << event.bytes;
+        if (event.signature != nullptr) {
+            out << ",\"tensors\":\"";
+            writeEscaped(out, event.signature->tensors);
+            out << "\"";
+        }
+        out << "}}";
+    });
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    return out ? INFINI_STATUS_SUCCESS : INFINI_STATUS_INTERNAL_ERROR;
+}
+
+__C infiniStatus_t infiniopGetTraceSummary(infiniopTraceSummary_t *entries, size_t *count) {
+    if (count == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+    using namespace op::trace;
+    std::map<std::string, infiniopTraceSummary_t> summary;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        forEachEvent([&](const Ring &, const Event &event) {
+            auto &entry = summary[event.op];
+            entry.count += 1;
+            entry.total_us += double(event.end - event.start) / 1e3;
+            entry.bytes += event.bytes;
+        });
+    }
+    if (entries == nullptr) {
+        *count = summary.size();
+        return INFINI_STATUS_SUCCESS;
+    }
+
+    std::vector<infiniopTraceSummary_t> sorted;
+    for (auto &[op, entry] : summary) {
+        strncpy(entry.op, op.c_str(), sizeof(entry.op) - 1);
+        sorted.push_back(entry);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) { return a.total_us > b.total_us; });
+    *count = std::min(*count, sorted.size());
+    std::copy(sorted.begin(), sorted.begin() + *count, entries);
+    return INFINI_STATUS_SUCCESS;
+}
@@ -0,0 +1,118 @@
+#ifndef __INFINIOP_TRACE_H__
+#define __INFINIOP_TRACE_H__
+
+#include "infiniop/trace.h"
+#include "operator.h"
+#include "tensor.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace op::trace {
+
+// the tensors a descriptor was created for, shared by the descriptors created alike
+struct Signature {
+    // "F16(4,8) F16(4,8)", a null tensor descriptor shows as "-"
+    std::string tensors;
+};
+
+extern std::atomic<bool> active;
+
+// set while the calling thread's entry points are not to be traced, as in graph finalization
+extern thread_local bool suppressed;
+
+inline bool enabled() {
+    return active.load(std::memory_order_relaxed);
+}
+
+uint64_t now();
+
+const Signature *intern(std::string tensors);
+
+// bytes of the tensor descriptors among `args`, cheap enough for every create
+template <typename... Args>
+size_t tensorBytes(Args... args) {
+    size_t bytes = 0;
+    auto add = [&bytes](auto arg) {
+        if constexpr (std::is_same_v<decltype(arg), infiniopTensorDescriptor_t>) {
+            if (arg != nullptr) {
+                bytes += arg->numel() * infiniSizeOf(arg->dtype());
+            }
+        }
+    };
+    (add(args), ...);
+    return bytes;
+}
+
+// the signature of the tensor descriptors among `args`
+template <typename... Args>
+const Signature *describe(Args... args) {
+    std::string tensors;
+    auto add = [&tensors](auto arg) {
+        if constexpr (std::is_same_v<decltype(arg), infiniopTensorDescriptor_t>) {
+            if (!tensors.empty()) {
+                tensors += ' ';
+            }
+            if (arg == nullptr) {
+                tensors += '-';
+                return;
+            }
+            tensors += infiniDtypeToString(arg->dtype());
+            tensors += '(';
+            for (size_t i = 0; i < arg->ndim(); ++i) {
+                tensors += (i ? "," : "") + std::to_string(arg->dim(i));
+            }
+            tensors += ')';
+        }
+    };
+    (add(args), ...);
+    return intern(std::move(tensors));
+}
+
+struct Event {
+    // operator name, static
+    const char *op;
+    // null for descriptors created while not tracing
+    const Signature *signature;
+    size_t bytes;
+    infiniDevice_t device;
+    int device_id;
+    size_t workspace_size;
+    uint64_t start, end;
+};
+
+void record(const Event &event);
+
+// records the call of an operator entry point over its lifetime
+class Scope {
+    Event _event;
+    bool _active = false;
+
+public:
+    Scope(const char *op, const InfiniopDescriptor *desc, size_t workspace_size) {
+        if (!enabled() || suppressed) {
+            return;
+        }
+        _event = {op, desc->trace_signature, desc->trace_bytes, desc->device_type, desc->device_id, workspace_size, now(), 0};
+        _active = true;
+    }
+
+    ~Scope() {
+        if (_active) {
+            _event.end = now();
+            record(_event);
+        }
+    }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+};
+
+} // namespace op::trace
+
+// Placed in an operator entry point after INFINIOP_GRAPH_CAPTURE, times the call while tracing.
+#define INFINIOP_TRACE(FN, DESC, WORKSPACE_SIZE) \
+    op::trace::Scope trace_scope_(#FN + sizeof("infiniop") - 1, reinterpret_cast<const InfiniopDescriptor *>(DESC), WORKSPACE_SIZE)
+
+#endif // __INFINIOP_TRACE_H__
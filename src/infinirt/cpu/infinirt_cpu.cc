@@ -1,4 +1,6 @@
 #include "infinirt_cpu.h"
+#include "memory_cpu.h"
+#include "numa_cpu.h"
 #include <cstdlib>
 #include <cstring>
 
@@ -54,6 +56,14 @@ infiniStatus_t eventDestroy(infinirtEvent_t event) {
 }
 
 infiniStatus_t mallocDevice(void **p_ptr, size_t size) {
+    if (numa::policy() != INFINIRT_MEM_POLICY_DEFAULT || memory::hugePages() != INFINIRT_HUGE_PAGES_NONE) {
+        size_t length, page_size;
+        auto status = memory::map(p_ptr, size, &length, &page_size);
+        if (status == INFINI_STATUS_SUCCESS) {
+            numa::place(*p_ptr, length, page_size);
+        }
+        return status;
+    }
     *p_ptr = std::malloc(size);
     return INFINI_STATUS_SUCCESS;
 }
@@ -63,6 +73,9 @@ infiniStatus_t mallocHost(void **p_ptr, size_t size) {
 }
 
 infiniStatus_t freeDevice(void *ptr) {
+    if (memory::unmap(ptr)) {
+        return INFINI_STATUS_SUCCESS;
+    }
     std::free(ptr);
     return INFINI_STATUS_SUCCESS;
 }
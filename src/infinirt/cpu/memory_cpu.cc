@@ -0,0 +1,238 @@
+#include "memory_cpu.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace infinirt::cpu::memory {
+
+namespace {
+
+infinirtHugePages_t defaultMode() {
+    static const infinirtHugePages_t mode = [] {
+        const char *name = std::getenv("INFINIRT_HUGE_PAGES");
+        if (name == nullptr) {
+            return INFINIRT_HUGE_PAGES_NONE;
+        }
+        if (std::strcmp(name, "thp") == 0) {
+            return INFINIRT_HUGE_PAGES_TRANSPARENT;
+        }
+        if (std::strcmp(name, "2m") == 0) {
+            return INFINIRT_HUGE_PAGES_2M;
+        }
+        if (std::strcmp(name, "1g") == 0) {
+            return INFINIRT_HUGE_PAGES_1G;
+        }
+        return INFINIRT_HUGE_PAGES_NONE;
+    }();
+    return mode;
+}
+
+thread_local infinirtHugePages_t CURRENT_MODE = defaultMode();
+
+// the mappings and their lengths, `free` takes the other allocations
+std::mutex mappings_mutex;
+std::unordered_map<void *, size_t> mappings;
+std::atomic<bool> any_mapping{false};
+
+constexpr size_t SIZE_2M = size_t(1) << 21;
+constexpr size_t SIZE_1G = size_t(1) << 30;
+
+size_t roundUp(size_t size, size_t unit) {
+    return (size + unit - 1) / unit * unit;
+}
+
+#ifdef __linux__
+// the page size encoding of MAP_HUGETLB, from linux/mman.h
+constexpr int HUGE_2M = 21 << 26;
+constexpr int HUGE_1G = 30 << 26;
+
+void *tryMap(size_t length, int flags) {
+    void *ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+// a mapping aligned to 2 MiB and asked to be backed by transparent huge pages, null on failure
+void *mapTransparent(size_t length) {
+    auto reserved = static_cast<char *>(tryMap(length + SIZE_2M, 0));
+    if (reserved == nullptr) {
+        return nullptr;
+    }
+    auto aligned = reinterpret_cast<char *>(roundUp(reinterpret_cast<uintptr_t>(reserved), SIZE_2M));
+    if (aligned != reserved) {
+        munmap(reserved, aligned - reserved);
+    }
+    munmap(aligned + length, reserved + SIZE_2M - aligned);
+#ifdef MADV_HUGEPAGE
+    madvise(aligned, length, MADV_HUGEPAGE);
+#endif
+    return aligned;
+}
+
+// "AnonHugePages:      2048 kB" -> 2097152 for the fields counting huge pages, 0 for the others
+size_t hugeField(const std::string &line) {
+    static const char *const FIELDS[] = {
+        "AnonHugePages:", "ShmemPmdMapped:", "FilePmdMapped:", "Shared_Hugetlb:", "Private_Hugetlb:"};
+    for (const char *field : FIELDS) {
+        if (line.compare(0, std::strlen(field), field) == 0) {
+            return std::strtoull(line.c_str() + std::strlen(field), nullptr, 10) * 1024;
+        }
+    }
+    return 0;
+}
+#endif
+
+} // namespace
+
+infiniStatus_t setHugePages(infinirtHugePages_t mode) {
+    switch (mode) {
+    case INFINIRT_HUGE_PAGES_NONE:
+    case INFINIRT_HUGE_PAGES_TRANSPARENT:
+    case INFINIRT_HUGE_PAGES_2M:
+    case INFINIRT_HUGE_PAGES_1G:
+        CURRENT_MODE = mode;
+        return INFINI_STATUS_SUCCESS;
+    default:
+        return INFINI_STATUS_BAD_PARAM;
+    }
+}
+
+infinirtHugePages_t hugePages() {
+    return CURRENT_MODE;
+}
+
+infiniStatus_t map(void **p_ptr, size_t size, size_t *length, size_t *page_size) {
+    size = std::max(size, (size_t)1);
+#ifdef __linux__
+    const size_t base_page = (size_t)sysconf(_SC_PAGESIZE);
+    void *ptr = nullptr;
+    // every mode falls through to the next smaller pages, and a page size is only used by the
+    // allocations filling at least one page of it
+    switch (CURRENT_MODE) {
+    case INFINIRT_HUGE_PAGES_1G:
+        if (size >= SIZE_1G) {
+            *length = roundUp(size, SIZE_1G);
+            *page_size = SIZE_1G;
+            if ((ptr = tryMap(*length, MAP_HUGETLB | HUGE_1G)) != nullptr) {
+                break;
+            }
+        }
+        // fall through
+    case INFINIRT_HUGE_PAGES_2M:
+        if (size >= SIZE_2M) {
+            *length = roundUp(size, SIZE_2M);
+            *page_size = SIZE_2M;
+            if ((ptr = tryMap(*length, MAP_HUGETLB | HUGE_2M)) != nullptr) {
+                break;
+            }
+        }
+        // fall through
+    case INFINIRT_HUGE_PAGES_TRANSPARENT:
+        if (size >= SIZE_2M) {
+            *length = roundUp(size, SIZE_2M);
+            *page_size = base_page;
+            ptr = mapTransparent(*length);
+        }
+        break;
+    default:
+        break;
+    }
+    if (ptr == nullptr) {
+        *length = roundUp(size, base_page);
+        *page_size = base_page;
+        ptr = tryMap(*length, 0);
+    }
+    if (ptr == nullptr) {
+        *p_ptr = nullptr;
+        return INFINI_STATUS_INTERNAL_ERROR;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mappings_mutex);
+        mappings[ptr] = *length;
+    }
+    any_mapping.store(true, std::memory_order_release);
+    *p_ptr = ptr;
+#else
+    // no mapping of our own to make, the allocation is an ordinary one
+    *p_ptr = std::malloc(size);
+    *length = size;
+    *page_size = 4096;
+#endif
+    return INFINI_STATUS_SUCCESS;
+}
+
+bool unmap(void *ptr) {
+    if (!any_mapping.load(std::memory_order_acquire)) {
+        return false;
+    }
+    size_t length = 0;
+    {
+        std::lock_guard<std::mutex> lock(mappings_mutex);
+        auto it = mappings.find(ptr);
+        if (it == mappings.end()) {
+            return false;
+        }
+        length = it->second;
+        mappings.erase(it);
+    }
+#ifdef __linux__
+    munmap(ptr, length);
+#else
+    (void)length;
+#endif
+    return true;
+}
+
+infiniStatus_t hugePageBytes(const void *ptr, size_t size, size_t *bytes) {
+    std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+    if (ptr != nullptr) {
+        ranges.emplace_back(reinterpret_cast<uintptr_t>(ptr), reinterpret_cast<uintptr_t>(ptr) + size);
+    } else {
+        std::lock_guard<std::mutex> lock(mappings_mutex);
+        for (const auto &mapping : mappings) {
+            auto begin = reinterpret_cast<uintptr_t>(mapping.first);
+            ranges.emplace_back(begin, begin + mapping.second);
+        }
+    }
+    *bytes = 0;
+#ifdef __linux__
+    // The kernel reports huge pages per mapping of the process. Mappings made next to each other
+    // with the same flags are merged into one, so a mapping only counts up to the bytes it shares
+    // with the ranges.
+    std::ifstream smaps("/proc/self/smaps");
+    std::string line;
+    size_t overlap = 0, huge = 0;
+    while (std::getline(smaps, line)) {
+        unsigned long begin, end;
+        char dash;
+        // the first line of a mapping is "begin-end perms ...", the field lines "Name: value"
+        if (line.find(':') > line.find(' ') && std::sscanf(line.c_str(), "%lx%c%lx", &begin, &dash, &end) == 3 && dash == '-') {
+            *bytes += std::min(huge, overlap);
+            overlap = huge = 0;
+            for (const auto &range : ranges) {
+                uintptr_t lo = std::max<uintptr_t>(range.first, begin), hi = std::min<uintptr_t>(range.second, end);
+                overlap += hi > lo ? hi - lo : 0;
+            }
+        } else if (overlap > 0) {
+            huge += hugeField(line);
+        }
+    }
+    *bytes += std::min(huge, overlap);
+#endif
+    return INFINI_STATUS_SUCCESS;
+}
+
+} // namespace infinirt::cpu::memory
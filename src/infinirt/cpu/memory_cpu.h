@@ -0,0 +1,31 @@
+#ifndef __INFINIRT_MEMORY_CPU_H__
+#define __INFINIRT_MEMORY_CPU_H__
+#include "infinirt.h"
+#include <cstddef>
+
+/**
+ * Host allocations made as mappings of their own, for the allocations that ask for huge pages or
+ * for a NUMA placement; the others stay with malloc. Each huge page mode falls back to the next
+ * smaller pages when the system cannot provide it: 1 GiB to 2 MiB hugetlbfs pages, those to
+ * transparent huge pages, and those to base pages.
+ */
+namespace infinirt::cpu::memory {
+
+// the huge page mode of the allocations made by the calling thread from now on, initially the one
+// INFINIRT_HUGE_PAGES names: none, thp, 2m or 1g
+infiniStatus_t setHugePages(infinirtHugePages_t mode);
+infinirtHugePages_t hugePages();
+
+// maps at least `size` bytes under the calling thread's mode; `length` and `page_size` are those
+// of the mapping made
+infiniStatus_t map(void **p_ptr, size_t size, size_t *length, size_t *page_size);
+
+// unmaps `ptr` if `map` returned it, false otherwise
+bool unmap(void *ptr);
+
+// bytes of [ptr, ptr + size) backed by huge pages, of every live mapping made by `map` for null
+infiniStatus_t hugePageBytes(const void *ptr, size_t size, size_t *bytes);
+
+} // namespace infinirt::cpu::memory
+
+#endif // __INFINIRT_MEMORY_CPU_H__
@@ -0,0 +1,236 @@
+#include "numa_cpu.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace infinirt::cpu::numa {
+
+namespace {
+
+// node ids are bounded by the kernel's MAX_NUMNODES, 1024 at most
+constexpr int MAX_NODES = 1024;
+
+struct Topology {
+    // the CPUs of every node, within those of the process
+    std::vector<std::vector<int>> node_cpus;
+    std::vector<int> process_cpus;
+};
+
+// "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+std::vector<int> parseList(const std::string &list) {
+    std::vector<int> ids;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        if (range.empty() || range[0] < '0' || range[0] > '9') {
+            continue;
+        }
+        auto dash = range.find('-');
+        int first = std::atoi(range.c_str());
+        int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+        for (int id = first; id <= last; ++id) {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+std::string readLine(const std::string &path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+Topology detect() {
+    Topology topology;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                topology.process_cpus.push_back(cpu);
+            }
+        }
+    }
+    for (int node : parseList(readLine("/sys/devices/system/node/online"))) {
+        if (node >= MAX_NODES) {
+            break;
+        }
+        topology.node_cpus.resize(node + 1);
+        auto cpus = parseList(readLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+        for (int cpu : cpus) {
+            if (std::binary_search(topology.process_cpus.begin(), topology.process_cpus.end(), cpu)) {
+                topology.node_cpus[node].push_back(cpu);
+            }
+        }
+    }
+#else
+    for (unsigned cpu = 0; cpu < std::thread::hardware_concurrency(); ++cpu) {
+        topology.process_cpus.push_back((int)cpu);
+    }
+#endif
+    if (topology.node_cpus.empty()) {
+        topology.node_cpus.push_back(topology.process_cpus);
+    }
+    return topology;
+}
+
+const Topology &topology() {
+    static const Topology topology = detect();
+    return topology;
+}
+
+thread_local infinirtMemPolicy_t CURRENT_POLICY = INFINIRT_MEM_POLICY_DEFAULT;
+thread_local int CURRENT_NODE = 0;
+
+#ifdef __linux__
+constexpr int MPOL_BIND_ = 2;
+constexpr int MPOL_INTERLEAVE_ = 3;
+
+// best effort: without NUMA support in the kernel the pages simply stay where they are touched
+void bindMemory(void *ptr, size_t length, int mode, const std::vector<int> &nodes) {
+    unsigned long mask[MAX_NODES / (8 * sizeof(unsigned long))] = {};
+    for (int node : nodes) {
+        mask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+    }
+    // the kernel reads one bit less than `maxnode`
+    syscall(SYS_mbind, ptr, length, mode, mask, (unsigned long)MAX_NODES + 1, 0);
+}
+
+// writes one byte per page so that they are allocated now, by a thread of `node` unless it is -1,
+// which leaves first touch to the calling thread
+void touch(char *ptr, size_t length, size_t page_size, int node) {
+    if (node >= 0) {
+        bindThread(node);
+    }
+    for (size_t offset = 0; offset < length; offset += page_size) {
+        ptr[offset] = 0;
+    }
+}
+#endif
+
+} // namespace
+
+int nodeCount() {
+    return (int)topology().node_cpus.size();
+}
+
+infiniStatus_t cpuCount(int node, int *count) {
+    if (node < -1 || node >= nodeCount()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    *count = (int)(node == -1 ? topology().process_cpus : topology().node_cpus[node]).size();
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t bindThread(int node) {
+    if (node < -1 || node >= nodeCount()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    const auto &cpus = node == -1 ? topology().process_cpus : topology().node_cpus[node];
+    if (cpus.empty()) {
+        return INFINI_STATUS_BAD_PARAM;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        CPU_SET(cpu, &set);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        return INFINI_STATUS_INTERNAL_ERROR;
+    }
+#endif
+    return INFINI_STATUS_SUCCESS;
+}
+
+infiniStatus_t setPolicy(infinirtMemPolicy_t policy, int node) {
+    switch (policy) {
+    case INFINIRT_MEM_POLICY_DEFAULT:
+    case INFINIRT_MEM_POLICY_LOCAL:
+    case INFINIRT_MEM_POLICY_INTERLEAVE:
+    case INFINIRT_MEM_POLICY_PARTITION:
+        break;
+    case INFINIRT_MEM_POLICY_BIND:
+        if (node < 0 || node >= nodeCount()) {
+            return INFINI_STATUS_BAD_PARAM;
+        }
+        break;
+    default:
+        return INFINI_STATUS_BAD_PARAM;
+    }
+    CURRENT_POLICY = policy;
+    CURRENT_NODE = node;
+    return INFINI_STATUS_SUCCESS;
+}
+
+infinirtMemPolicy_t policy() {
+    return CURRENT_POLICY;
+}
+
+void place(void *ptr, size_t length, size_t page_size) {
+#ifdef __linux__
+    char *bytes = static_cast<char *>(ptr);
+
+    // the nodes having CPUs to touch their share of the pages
+    std::vector<int> nodes;
+    for (int node = 0; node < nodeCount(); ++node) {
+        if (!topology().node_cpus[node].empty()) {
+            nodes.push_back(node);
+        }
+    }
+
+    switch (CURRENT_POLICY) {
+    case INFINIRT_MEM_POLICY_LOCAL:
+        touch(bytes, length, page_size, -1);
+        break;
+    case INFINIRT_MEM_POLICY_BIND:
+        bindMemory(ptr, length, MPOL_BIND_, {CURRENT_NODE});
+        std::thread(touch, bytes, length, page_size, CURRENT_NODE).join();
+        break;
+    case INFINIRT_MEM_POLICY_INTERLEAVE:
+        bindMemory(ptr, length, MPOL_INTERLEAVE_, nodes);
+        touch(bytes, length, page_size, -1);
+        break;
+    case INFINIRT_MEM_POLICY_PARTITION: {
+        // one contiguous block per node, in the order of the nodes, each touched by its node
+        std::vector<std::thread> threads;
+        const size_t pages = length / page_size;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            size_t begin = pages * i / nodes.size() * page_size;
+            size_t end = pages * (i + 1) / nodes.size() * page_size;
+            if (begin == end) {
+                continue;
+            }
+            bindMemory(bytes + begin, end - begin, MPOL_BIND_, {nodes[i]});
+            threads.emplace_back(touch, bytes + begin, end - begin, page_size, nodes[i]);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        break;
+    }
+    default:
+        break;
+    }
+#else
+    (void)ptr;
+    (void)length;
+    (void)page_size;
+#endif
+}
+
+} // namespace infinirt::cpu::numa
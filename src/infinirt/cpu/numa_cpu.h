@@ -0,0 +1,35 @@
+#ifndef __INFINIRT_NUMA_CPU_H__
+#define __INFINIRT_NUMA_CPU_H__
+#include "infinirt.h"
+#include <cstddef>
+
+/**
+ * NUMA placement of host memory and threads.
+ *
+ * The topology is read once from /sys/devices/system/node. Where it is not available, such as
+ * outside Linux or on a kernel built without NUMA, the machine is seen as a single node holding
+ * every CPU of the process, so every policy still allocates, only without placement. The
+ * mappings themselves are made by memory_cpu.h.
+ */
+namespace infinirt::cpu::numa {
+
+// nodes are numbered from 0 to nodeCount() - 1, some may have no CPU
+int nodeCount();
+
+// the CPUs of `node` the process may run on, every such CPU for -1
+infiniStatus_t cpuCount(int node, int *count);
+
+// binds the calling thread to the CPUs of `node`, or back to those of the process for -1
+infiniStatus_t bindThread(int node);
+
+// the policy of the allocations made by the calling thread from now on
+infiniStatus_t setPolicy(infinirtMemPolicy_t policy, int node);
+infinirtMemPolicy_t policy();
+
+// places the pages of a fresh mapping, made of pages of `page_size` bytes, under the calling
+// thread's policy, and touches them unless the policy is the default one
+void place(void *ptr, size_t length, size_t page_size);
+
+} // namespace infinirt::cpu::numa
+
+#endif // __INFINIRT_NUMA_CPU_H__
@@ -3,6 +3,8 @@
 #include "ascend/infinirt_ascend.h"
 #include "bang/infinirt_bang.h"
 #include "cpu/infinirt_cpu.h"
+#include "cpu/memory_cpu.h"
+#include "cpu/numa_cpu.h"
 #include "cuda/infinirt_cuda.cuh"
 #include "kunlun/infinirt_kunlun.h"
 #include "metax/infinirt_metax.h"
@@ -170,3 +172,61 @@ __C infiniStatus_t infinirtMallocAsync(void **p_ptr, size_t size, infinirtStream
 __C infiniStatus_t infinirtFreeAsync(void *ptr, infinirtStream_t stream) {
     INFINIRT_CALL_DEVICE_API(freeAsync, (ptr, stream));
 }
+
+__C infiniStatus_t infinirtGetNumaNodeCount(int *count) {
+    if (count == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+#ifdef ENABLE_CPU_API
+    *count = infinirt::cpu::numa::nodeCount();
+    return INFINI_STATUS_SUCCESS;
+#else
+    return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+#endif
+}
+
+__C infiniStatus_t infinirtGetNumaNodeCpuCount(int node, int *count) {
+    if (count == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+#ifdef ENABLE_CPU_API
+    return infinirt::cpu::numa::cpuCount(node, count);
+#else
+    return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+#endif
+}
+
+__C infiniStatus_t infinirtBindThreadToNumaNode(int node) {
+#ifdef ENABLE_CPU_API
+    return infinirt::cpu::numa::bindThread(node);
+#else
+    return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+#endif
+}
+
+__C infiniStatus_t infinirtSetMemPolicy(infinirtMemPolicy_t policy, int node) {
+#ifdef ENABLE_CPU_API
+    return infinirt::cpu::numa::setPolicy(policy, node);
+#else
+    return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+#endif
+}
+
+__C infiniStatus_t infinirtSetHugePages(infinirtHugePages_t mode) {
+#ifdef ENABLE_CPU_API
+    return infinirt::cpu::memory::setHugePages(mode);
+#else
+    return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+#endif
+}
+
+__C infiniStatus_t infinirtGetHugePageBytes(const void *ptr, size_t size, size_t *bytes) {
+    if (bytes == nullptr) {
+        return INFINI_STATUS_NULL_POINTER;
+    }
+#ifdef ENABLE_CPU_API
+    return infinirt::cpu::memory::hugePageBytes(ptr, size, bytes);
+#else
+    return INFINI_STATUS_DEVICE_TYPE_NOT_SUPPORTED;
+#endif
+}
@@ -0,0 +1,124 @@
+import ctypes
+import os
+import subprocess
+import sys
+import tempfile
+
+import torch
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    check_error,
+    get_args,
+    create_handle,
+    destroy_handle,
+    InfiniDtype,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # a_shape, b_shape, c_shape
+    ((64, 256), (256, 128), (64, 128)),
+    ((3, 16, 64), (3, 64, 512), (3, 16, 512)),
+]
+
+# shapes converted from F32 to F16, the CPU Cast tunes the chunks its threads take
+_CAST_TEST_CASES_ = [
+    (1 << 20,),
+]
+
+DEBUG = False
+
+
+def gemm(handle, a_shape, b_shape, c_shape):
+    """Creates a CPU GEMM descriptor, which selects its tiling and schedule, and checks a call."""
+    a = TestTensor(a_shape, None, InfiniDtype.F32, InfiniDeviceEnum.CPU)
+    b = TestTensor(b_shape, None, InfiniDtype.F32, InfiniDeviceEnum.CPU)
+    c = TestTensor(c_shape, None, InfiniDtype.F32, InfiniDeviceEnum.CPU, mode="zeros")
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateGemmDescriptor(
+            handle, ctypes.byref(descriptor), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+    check_error(
+        LIBINFINIOP.infiniopGemm(
+            descriptor, None, 0, c.data(), a.data(), b.data(), 1.0, 0.0, None
+        )
+    )
+    ans = torch.matmul(a.torch_tensor(), b.torch_tensor())
+    assert torch.allclose(c.actual_tensor(), ans, atol=0, rtol=1e-3)
+    check_error(LIBINFINIOP.infiniopDestroyGemmDescriptor(descriptor))
+
+
+def cast(handle, shape):
+    """Creates a CPU Cast descriptor, which selects its chunk, and checks a call."""
+    x = TestTensor(shape, None, InfiniDtype.F32, InfiniDeviceEnum.CPU)
+    y = TestTensor(shape, None, InfiniDtype.F16, InfiniDeviceEnum.CPU, mode="zeros")
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateCastDescriptor(
+            handle, ctypes.byref(descriptor), y.descriptor, x.descriptor
+        )
+    )
+    check_error(LIBINFINIOP.infiniopCast(descriptor, None, 0, y.data(), x.data(), None))
+    # the conversion truncates, PyTorch rounds
+    assert torch.allclose(y.actual_tensor(), x.torch_tensor().to(torch.float16), atol=1e-3, rtol=1e-3)
+    check_error(LIBINFINIOP.infiniopDestroyCastDescriptor(descriptor))
+
+
+def run_tuned(cache):
+    """Runs the GEMM cases in a new process with tuning enabled and `cache` as the tuning file."""
+    env = dict(os.environ, INFINIOP_AUTOTUNE="1", INFINIOP_TUNING_CACHE=cache)
+    subprocess.run([sys.executable, __file__, "--cpu"], env=env, check=True)
+    with open(cache) as f:
+        return f.read()
+
+
+def test():
+    print("Testing Autotune with a temporary tuning cache")
+    with tempfile.TemporaryDirectory() as directory:
+        cache = os.path.join(directory, "tuning_cache.tsv")
+
+        # lines are "model\tthreads\tkernel\tbucket\tcandidate", a tiling and a schedule per
+        # GEMM case and a chunk per Cast case
+        first = run_tuned(cache)
+        if DEBUG:
+            print(first)
+        lines = [line.split("\t") for line in first.splitlines()]
+        assert len(lines) == 2 * len(_TEST_CASES_) + len(_CAST_TEST_CASES_)
+        assert all(len(fields) == 5 for fields in lines)
+        kernels = [fields[2] for fields in lines]
+        assert kernels.count("gemm") == kernels.count("gemm_schedule") == len(_TEST_CASES_)
+        assert kernels.count("cast") == len(_CAST_TEST_CASES_)
+
+        # a later process reads the choices back instead of measuring again
+        assert run_tuned(cache) == first
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    if os.environ.get("INFINIOP_AUTOTUNE") == "1":
+        # the process started by `run_tuned`
+        LIBINFINIOP.infinirtSetDevice(InfiniDeviceEnum.CPU, ctypes.c_int(0))
+        handle = create_handle()
+        for a_shape, b_shape, c_shape in _TEST_CASES_:
+            gemm(handle, a_shape, b_shape, c_shape)
+        for shape in _CAST_TEST_CASES_:
+            cast(handle, shape)
+        destroy_handle(handle)
+    else:
+        test()
+
+    print("\033[92mTest passed!\033[0m")
@@ -36,6 +36,13 @@ _TEST_STRIDES_ = [
     # Add some non-contiguous strides for specific shapes
 ]
 
+# shape, input stride, output stride
+_STRIDED_CASES_ = [
+    ((13, 4), (10, 1), None),
+    ((32, 32), (1, 32), None),
+    ((16, 5632), None, (6000, 1)),
+]
+
 # Define type conversion test matrix
 _TYPE_CONVERSIONS_ = [
     # Integer to integer conversions
@@ -75,14 +82,18 @@ _TYPE_CONVERSIONS_ = [
     (InfiniDtype.F64, InfiniDtype.F16),
     (InfiniDtype.BF16, InfiniDtype.F32),
     (InfiniDtype.F32, InfiniDtype.BF16),
+    (InfiniDtype.BF16, InfiniDtype.F16),
+    (InfiniDtype.F16, InfiniDtype.BF16),
+    (InfiniDtype.BF16, InfiniDtype.I32),
+    (InfiniDtype.I64, InfiniDtype.BF16),
 ]
 
-# Form the test cases
+# Form the test cases, the output dtype is passed by test_operator
 _TEST_CASES = []
-for input_dtype, output_dtype in _TYPE_CONVERSIONS_:
-    for shape in _TEST_SHAPES_:
-        for stride in _TEST_STRIDES_:
-            _TEST_CASES.append((shape, stride, stride, input_dtype, output_dtype))
+for shape in _TEST_SHAPES_:
+    for stride in _TEST_STRIDES_:
+        _TEST_CASES.append((shape, stride, stride))
+_TEST_CASES.extend(_STRIDED_CASES_)
 
 # Tolerance map for different data types
 _TOLERANCE_MAP = {
@@ -208,7 +219,7 @@ if __name__ == "__main__":
     NUM_ITERATIONS = args.num_iterations
 
     print(f"\033[94mRunning Cast operator tests...\033[0m")
-    print(f"Total test cases: {len(_TEST_CASES)}")
+    print(f"Total test cases: {len(_TEST_CASES) * len(_TYPE_CONVERSIONS_)}")
     print(f"Type conversions tested: {len(_TYPE_CONVERSIONS_)}")
     print("\nType conversion matrix:")
     for i, (input_dtype, output_dtype) in enumerate(_TYPE_CONVERSIONS_):
@@ -217,6 +228,12 @@ if __name__ == "__main__":
 
     for device in get_test_devices(args):
         print(f"\033[93mTesting on device: {InfiniDeviceNames[device]}\033[0m")
-        test_operator(device, test, _TEST_CASES, [])  # Empty dtype list since we handle dtypes in test cases
+        for input_dtype, output_dtype in _TYPE_CONVERSIONS_:
+            test_operator(
+                device,
+                test,
+                [case + (input_dtype,) for case in _TEST_CASES],
+                [output_dtype],
+            )
 
     print("\033[92mAll Cast tests passed!\033[0m")
\ No newline at end of file
@@ -1,5 +1,6 @@
 import torch
 import ctypes
+import functools
 from ctypes import c_uint64
 from libinfiniop import (
     LIBINFINIOP,
@@ -32,6 +33,7 @@ _TEST_CASES_ = [
     ((32, 20, 512), None, None),
     ((32, 20, 512), (20480, 512, 1), None),
     ((28, 15, 15), None, None),
+    ((1, 4, 40000), None, None),
 ]
 
 # Data types used for testing
@@ -61,6 +63,12 @@ _TEST_CASES = [
     for inplace_item in _INPLACE
 ]
 
+# a NaN in the last row, which has no masked position, turns the whole row into NaN
+_NAN_TEST_CASES = [
+    ((4, 9), None, None, Inplace.OUT_OF_PLACE),
+    ((2, 3, 40000), None, None, Inplace.INPLACE_X),
+]
+
 DEBUG = False
 PROFILE = False
 NUM_PRERUN = 10
@@ -83,12 +91,17 @@ def test(
     inplace=Inplace.OUT_OF_PLACE,
     dtype=InfiniDtype.F16,
     sync=None,
+    nan_row=False,
 ):
     print(
-        f"Testing CausalSoftmax on {InfiniDeviceNames[device]} with shape:{shape} x_stride:{x_stride} y_stride:{y_stride} dtype:{InfiniDtypeNames[dtype]} inplace:{inplace}"
+        f"Testing CausalSoftmax on {InfiniDeviceNames[device]} with shape:{shape} x_stride:{x_stride} y_stride:{y_stride} dtype:{InfiniDtypeNames[dtype]} inplace:{inplace} nan_row:{nan_row}"
     )
 
     x = TestTensor(shape, x_stride, dtype, device)
+    if nan_row:
+        torch_x = x.torch_tensor().clone()
+        torch_x[..., -1, 1] = torch.nan
+        x = TestTensor.from_torch(torch_x, dtype, device)
     ans = causal_softmax(x.torch_tensor())
 
     if inplace == Inplace.INPLACE_X:
@@ -138,7 +151,9 @@ def test(
     atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
     if DEBUG:
         debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
-    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+    if nan_row:
+        assert torch.isnan(y.actual_tensor()[..., -1, :]).all()
+    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol, equal_nan=nan_row)
 
     # Profiling workflow
     if PROFILE:
@@ -161,5 +176,6 @@ if __name__ == "__main__":
 
     for device in get_test_devices(args):
         test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+        test_operator(device, functools.partial(test, nan_row=True), _NAN_TEST_CASES, _TENSOR_DTYPES)
 
     print("\033[92mTest passed!\033[0m")
@@ -15,6 +15,7 @@ from libinfiniop import (
     TestWorkspace,
     InfiniDtype,
     InfiniDtypeNames,
+    InfiniDeviceEnum,
     InfiniDeviceNames,
     infiniopOperatorDescriptor_t,
 )
@@ -30,7 +31,7 @@ PROFILE = False
 NUM_PRERUN = 10
 NUM_ITERATIONS = 1000
 _TEST_CASES = [
-    # x_shape, x_stride, w_shape, w_stride, pads, strides, dilations, x_strides
+    # x_shape, x_stride, w_shape, w_stride, pads, strides, dilations, groups
     (
         (32, 3, 4),
         (12, 4, 1),
@@ -39,6 +40,7 @@ _TEST_CASES = [
         (1,),
         (1,),
         (1,),
+        1,
     ),
     (
         (1, 3, 4, 4),
@@ -48,6 +50,7 @@ _TEST_CASES = [
         (1, 1),
         (1, 2),
         (2, 1),
+        1,
     ),
     (
         (32, 3, 32, 32),
@@ -57,6 +60,7 @@ _TEST_CASES = [
         (2, 2),
         (2, 2),
         (1, 1),
+        1,
     ),
     (
         (1, 1, 4, 4, 4),
@@ -66,6 +70,7 @@ _TEST_CASES = [
         (1, 1, 1),
         (1, 1, 1),
         (1, 1, 1),
+        1,
     ),
     (
         (32, 3, 32, 32, 32),
@@ -75,6 +80,81 @@ _TEST_CASES = [
         (3, 2, 2),
         (4, 3, 3),
         (2, 2, 1),
+        1,
+    ),
+    # channels-last input, the output is laid out the same way
+    (
+        (2, 16, 14, 14),
+        (14 * 14 * 16, 1, 14 * 16, 16),
+        (32, 16, 3, 3),
+        (144, 9, 3, 1),
+        (1, 1),
+        (1, 1),
+        (1, 1),
+        1,
+    ),
+    (
+        (1, 8, 9, 9, 9),
+        (9 * 9 * 9 * 8, 1, 9 * 9 * 8, 9 * 8, 8),
+        (16, 8, 3, 3, 3),
+        (216, 27, 9, 3, 1),
+        (1, 0, 1),
+        (2, 1, 1),
+        (1, 1, 2),
+        1,
+    ),
+    # 3x3 stride-1 convolutions (Winograd on CPU)
+    (
+        (2, 16, 15, 13),
+        (16 * 15 * 13, 15 * 13, 13, 1),
+        (24, 16, 3, 3),
+        (144, 9, 3, 1),
+        (0, 1),
+        (1, 1),
+        (1, 1),
+        1,
+    ),
+    # pointwise and grouped pointwise convolutions
+    (
+        (2, 32, 14, 14),
+        (14 * 14 * 32, 1, 14 * 32, 32),
+        (48, 32, 1, 1),
+        (32, 1, 1, 1),
+        (0, 0),
+        (1, 1),
+        (1, 1),
+        1,
+    ),
+    (
+        (2, 32, 7, 9),
+        (32 * 7 * 9, 7 * 9, 9, 1),
+        (48, 8, 1, 1),
+        (8, 1, 1, 1),
+        (0, 0),
+        (1, 1),
+        (1, 1),
+        4,
+    ),
+    # depthwise convolutions, with and without a channel multiplier
+    (
+        (2, 12, 17, 19),
+        (12 * 17 * 19, 17 * 19, 19, 1),
+        (12, 1, 3, 3),
+        (9, 9, 3, 1),
+        (1, 1),
+        (1, 1),
+        (1, 1),
+        12,
+    ),
+    (
+        (2, 12, 17, 19),
+        (12 * 17 * 19, 1, 19 * 12, 12),
+        (24, 1, 5, 3),
+        (15, 15, 3, 1),
+        (2, 0),
+        (2, 3),
+        (1, 2),
+        12,
     ),
 ]
 
@@ -95,24 +175,42 @@ NUM_PRERUN = 10
 NUM_ITERATIONS = 1000
 
 
-def conv(x, w, stride, padding, dilation, y_tensor, bias=None):
+def conv(x, w, stride, padding, dilation, groups, y_tensor, bias=None):
     match len(x.shape) - 2:
         case 1:
             y_tensor.copy_(
                 F.conv1d(
-                    x, w, bias=bias, stride=stride, padding=padding, dilation=dilation
+                    x,
+                    w,
+                    bias=bias,
+                    stride=stride,
+                    padding=padding,
+                    dilation=dilation,
+                    groups=groups,
                 )
             )
         case 2:
             y_tensor.copy_(
                 F.conv2d(
-                    x, w, bias=bias, stride=stride, padding=padding, dilation=dilation
+                    x,
+                    w,
+                    bias=bias,
+                    stride=stride,
+                    padding=padding,
+                    dilation=dilation,
+                    groups=groups,
                 )
             )
         case 3:
             y_tensor.copy_(
                 F.conv3d(
-                    x, w, bias=bias, stride=stride, padding=padding, dilation=dilation
+                    x,
+                    w,
+                    bias=bias,
+                    stride=stride,
+                    padding=padding,
+                    dilation=dilation,
+                    groups=groups,
                 )
             )
         case _:
@@ -150,6 +248,18 @@ def inferShapeStride(
     return output_shape, output_strides
 
 
+# strides of a channels-last tensor of the given (N, C, spatial...) shape
+def channelsLastStrides(shape: Tuple[int, ...]) -> Tuple[int, ...]:
+    strides = [0] * len(shape)
+    strides[1] = 1
+    acc = shape[1]
+    for i in reversed(range(2, len(shape))):
+        strides[i] = acc
+        acc *= shape[i]
+    strides[0] = acc
+    return tuple(strides)
+
+
 # convert a python tuple to a ctype void pointer
 def tuple_to_void_p(py_tuple: Tuple):
     array = ctypes.c_int64 * len(py_tuple)
@@ -167,6 +277,7 @@ def test(
     pads,
     strides,
     dilations,
+    groups,
     tensor_dtype=InfiniDtype.F16,
     sync=None,
 ):
@@ -174,6 +285,8 @@ def test(
     x = TestTensor(x_shape, x_stride, dt=tensor_dtype, device=device, scale=0.01)
     w = TestTensor(w_shape, w_stride, dt=tensor_dtype, device=device, scale=0.01)
     y_shape, y_stride = inferShapeStride(x_shape, w_shape, pads, strides, dilations)
+    if x_stride is not None and x_stride[1] == 1:
+        y_stride = channelsLastStrides(y_shape)
     y = TestTensor(y_shape, y_stride, dt=tensor_dtype, device=device)
 
     b = (
@@ -182,7 +295,7 @@ def test(
         else None
     )
     print(
-        f"Testing Conv on {InfiniDeviceNames[device]} with x_shape: {x_shape}, w_shape: {w_shape}, b_shape: {w_shape[0]}, pads: {pads}, strides: {strides}, dilations: {dilations}, x_stride: {x_stride} dtype:{InfiniDtypeNames[tensor_dtype]}"
+        f"Testing Conv on {InfiniDeviceNames[device]} with x_shape: {x_shape}, w_shape: {w_shape}, b_shape: {w_shape[0]}, pads: {pads}, strides: {strides}, dilations: {dilations}, groups: {groups}, x_stride: {x_stride} dtype:{InfiniDtypeNames[tensor_dtype]}"
     )
     conv(
         x.torch_tensor(),
@@ -190,6 +303,7 @@ def test(
         strides,
         pads,
         dilations,
+        groups,
         y.torch_tensor(),
         b.torch_tensor() if b is not None else None,
     )
@@ -210,6 +324,7 @@ def test(
             tuple_to_void_p(strides),
             tuple_to_void_p(dilations),
             len(pads),
+            groups,
         )
     )
 
@@ -246,10 +361,34 @@ def test(
         debug(y.actual_tensor(), y.torch_tensor(), atol=atol, rtol=rtol)
     assert torch.allclose(y.actual_tensor(), y.torch_tensor(), atol=atol, rtol=rtol)
 
+    # weights packed once give the result of the weights packed per call
+    if device == InfiniDeviceEnum.CPU:
+        per_call = y.actual_tensor().clone()
+        packed_w = ctypes.c_void_p()
+        check_error(
+            LIBINFINIOP.infiniopCreateConvPackedWeights(
+                descriptor, ctypes.byref(packed_w), w.data()
+            )
+        )
+        check_error(
+            LIBINFINIOP.infiniopConvPacked(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x.data(),
+                packed_w,
+                b.data() if b is not None else None,
+                None,
+            )
+        )
+        assert torch.equal(y.actual_tensor(), per_call)
+        check_error(LIBINFINIOP.infiniopDestroyConvPackedWeights(packed_w))
+
     # Profiling workflow
     if PROFILE:
         # fmt: off
-        profile_operation("PyTorch", lambda: conv(x.torch_tensor(), w.torch_tensor(), strides, pads, dilations, b.torch_tensor() if b is not None else None), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("PyTorch", lambda: conv(x.torch_tensor(), w.torch_tensor(), strides, pads, dilations, groups, y.torch_tensor(), b.torch_tensor() if b is not None else None), device, NUM_PRERUN, NUM_ITERATIONS)
         profile_operation("    lib", lambda: lib_conv(), device, NUM_PRERUN, NUM_ITERATIONS)
         # fmt: on
     check_error(LIBINFINIOP.infiniopDestroyConvDescriptor(descriptor))
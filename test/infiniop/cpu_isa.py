@@ -0,0 +1,112 @@
+import ctypes
+import os
+import subprocess
+import sys
+import tempfile
+
+import torch
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    check_error,
+    get_args,
+    get_tolerance,
+    create_handle,
+    destroy_handle,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceEnum,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # a_shape, b_shape, c_shape; widths off the vector widths walk the tails of the kernels
+    ((37, 131), (131, 77), (37, 77)),
+    ((2, 64, 512), (2, 512, 256), (2, 64, 256)),
+]
+
+# F16 and BF16 operands go through the conversions of the level
+_TENSOR_DTYPES = [InfiniDtype.F32, InfiniDtype.F16, InfiniDtype.BF16]
+
+# the levels differ in the order and fusing of the accumulations, and so in the last bits
+_TOLERANCE_MAP = {
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-5},
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 2e-3},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 1e-2},
+}
+
+# the values of INFINIOP_CPU_ISA; those above the level of the CPU run at that level
+_LEVELS = ["baseline", "sse4.2", "avx2", "avx512"]
+
+DEBUG = False
+
+
+def gemm(handle, a_shape, b_shape, c_shape, dtype):
+    a = TestTensor(a_shape, None, dtype, InfiniDeviceEnum.CPU)
+    b = TestTensor(b_shape, None, dtype, InfiniDeviceEnum.CPU)
+    c = TestTensor(c_shape, None, dtype, InfiniDeviceEnum.CPU, mode="zeros")
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateGemmDescriptor(
+            handle, ctypes.byref(descriptor), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+    check_error(
+        LIBINFINIOP.infiniopGemm(
+            descriptor, None, 0, c.data(), a.data(), b.data(), 1.0, 0.0, None
+        )
+    )
+    check_error(LIBINFINIOP.infiniopDestroyGemmDescriptor(descriptor))
+    return c.actual_tensor().float().clone()
+
+
+def run_level(level, directory):
+    """Runs the GEMM cases in a new process with INFINIOP_CPU_ISA set to `level`."""
+    output = os.path.join(directory, f"{level}.pt")
+    env = dict(os.environ, INFINIOP_CPU_ISA=level, CPU_ISA_TEST_OUTPUT=output)
+    subprocess.run([sys.executable, __file__, "--cpu"], env=env, check=True)
+    return torch.load(output)
+
+
+def test():
+    with tempfile.TemporaryDirectory() as directory:
+        expected = run_level("baseline", directory)
+        for level in _LEVELS[1:]:
+            print(f"Testing CPU ISA {level} against baseline")
+            results = run_level(level, directory)
+            cases = [(case, dtype) for case in _TEST_CASES_ for dtype in _TENSOR_DTYPES]
+            for (case, dtype), actual, ans in zip(cases, results, expected):
+                atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+                if DEBUG:
+                    print(case, InfiniDtypeNames[dtype], (actual - ans).abs().max().item())
+                assert torch.allclose(actual, ans, atol=atol, rtol=rtol)
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    output = os.environ.get("CPU_ISA_TEST_OUTPUT")
+    if output is not None:
+        # the process started by `run_level`, same inputs at every level
+        torch.manual_seed(0)
+        LIBINFINIOP.infinirtSetDevice(InfiniDeviceEnum.CPU, ctypes.c_int(0))
+        handle = create_handle()
+        results = [
+            gemm(handle, a_shape, b_shape, c_shape, dtype)
+            for a_shape, b_shape, c_shape in _TEST_CASES_
+            for dtype in _TENSOR_DTYPES
+        ]
+        destroy_handle(handle)
+        torch.save(results, output)
+    else:
+        test()
+
+    print("\033[92mTest passed!\033[0m")
@@ -0,0 +1,184 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceEnum,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # logits shape, logits strides, target dtype, ignore_index, label_smoothing
+    ((7, 13), None, InfiniDtype.I64, -100, 0.0),
+    ((64, 1000), None, InfiniDtype.I32, -100, 0.1),
+    ((4, 16, 512), None, InfiniDtype.I64, 3, 0.0),
+    ((16, 512), (1024, 1), InfiniDtype.I64, -100, 0.2),
+    ((32, 32000), None, InfiniDtype.I64, 0, 0.1),
+    ((2, 151936), None, InfiniDtype.I32, -100, 0.0),
+]
+
+# Values match infiniopCrossEntropyReduction_t
+_REDUCTIONS = {
+    "none": 0,
+    "mean": 1,
+    "sum": 2,
+}
+
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 5e-2},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-4},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def cross_entropy_torch(logits, target, reduction, ignore_index, label_smoothing):
+    # autograd on a float copy gives the reference gradient of the reduced loss
+    x = logits.detach().float().requires_grad_(True)
+    loss = torch.nn.functional.cross_entropy(
+        x.reshape(-1, x.shape[-1]),
+        target.reshape(-1).long(),
+        ignore_index=ignore_index,
+        reduction=reduction,
+        label_smoothing=label_smoothing,
+    )
+    if reduction == "none":
+        loss = loss.reshape(target.shape)
+    loss.sum().backward()
+    return loss.detach().to(logits.dtype), x.grad.to(logits.dtype)
+
+
+def test(
+    handle,
+    device,
+    shape,
+    strides,
+    target_dtype,
+    ignore_index,
+    label_smoothing,
+    dtype=InfiniDtype.F32,
+    sync=None,
+):
+    # only the CPU backend implements the fused cross entropy
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    classes = shape[-1]
+    target_torch_tensor = torch.randint(0, classes, shape[:-1], dtype=torch.int64)
+    # every fifth row is ignored
+    target_torch_tensor.view(-1)[2::5] = ignore_index
+
+    for reduction, reduction_value in _REDUCTIONS.items():
+        print(
+            f"Testing CrossEntropy on {InfiniDeviceNames[device]} with shape:{shape} strides:{strides} "
+            f"target_dtype:{InfiniDtypeNames[target_dtype]} ignore_index:{ignore_index} "
+            f"label_smoothing:{label_smoothing} reduction:{reduction} dtype:{InfiniDtypeNames[dtype]}"
+        )
+
+        logits = TestTensor(shape, strides, dtype, device, scale=8, bias=-4)
+        target = TestTensor.from_torch(target_torch_tensor, target_dtype, device)
+        loss_shape = shape[:-1] if reduction == "none" else ()
+        loss = TestTensor(loss_shape, None, dtype, device, mode="zeros")
+        grad_logits = TestTensor(shape, strides, dtype, device, mode="zeros")
+
+        expected_loss, expected_grad = cross_entropy_torch(
+            logits.torch_tensor(), target_torch_tensor, reduction, ignore_index, label_smoothing
+        )
+
+        if sync is not None:
+            sync()
+
+        descriptor = infiniopOperatorDescriptor_t()
+        check_error(
+            LIBINFINIOP.infiniopCreateCrossEntropyDescriptor(
+                handle,
+                ctypes.byref(descriptor),
+                loss.descriptor,
+                grad_logits.descriptor,
+                logits.descriptor,
+                target.descriptor,
+                reduction_value,
+                ignore_index,
+                label_smoothing,
+            )
+        )
+
+        # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+        for tensor in [loss, grad_logits, logits, target]:
+            tensor.destroy_desc()
+
+        workspace_size = c_uint64(0)
+        check_error(
+            LIBINFINIOP.infiniopGetCrossEntropyWorkspaceSize(
+                descriptor, ctypes.byref(workspace_size)
+            )
+        )
+        workspace = TestWorkspace(workspace_size.value, device)
+
+        def lib_cross_entropy():
+            check_error(
+                LIBINFINIOP.infiniopCrossEntropy(
+                    descriptor,
+                    workspace.data(),
+                    workspace.size(),
+                    loss.data(),
+                    grad_logits.data(),
+                    logits.data(),
+                    target.data(),
+                    None,
+                )
+            )
+
+        lib_cross_entropy()
+
+        atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+        if DEBUG:
+            debug(loss.actual_tensor(), expected_loss, atol=atol, rtol=rtol)
+            debug(grad_logits.actual_tensor(), expected_grad, atol=atol, rtol=rtol)
+        assert torch.allclose(loss.actual_tensor(), expected_loss, atol=atol, rtol=rtol)
+        assert torch.allclose(grad_logits.actual_tensor(), expected_grad, atol=atol, rtol=rtol)
+
+        if PROFILE:
+            # fmt: off
+            profile_operation("PyTorch", lambda: cross_entropy_torch(logits.torch_tensor(), target_torch_tensor, reduction, ignore_index, label_smoothing), device, NUM_PRERUN, NUM_ITERATIONS)
+            profile_operation("    lib", lambda: lib_cross_entropy(), device, NUM_PRERUN, NUM_ITERATIONS)
+            # fmt: on
+
+        check_error(LIBINFINIOP.infiniopDestroyCrossEntropyDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES_, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
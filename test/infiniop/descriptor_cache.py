@@ -0,0 +1,118 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shapes created in turn, cache capacity
+    ([(13, 4), (13, 4), (2, 3, 5), (13, 4)], 4),
+    ([(1, 4096), (2, 4096), (3, 4096), (1, 4096), (2, 4096)], 2),
+]
+
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.F32]
+
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-3},
+    InfiniDtype.F32: {"atol": 1e-7, "rtol": 1e-7},
+}
+
+DEBUG = False
+
+
+def cache_stats(handle):
+    hits, misses, size = c_uint64(0), c_uint64(0), c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetDescriptorCacheStats(
+            handle, ctypes.byref(hits), ctypes.byref(misses), ctypes.byref(size)
+        )
+    )
+    return hits.value, misses.value, size.value
+
+
+def test(handle, device, shapes, capacity, dtype=InfiniDtype.F16, sync=None):
+    print(
+        f"Testing DescriptorCache on {InfiniDeviceNames[device]} with shapes:{shapes} capacity:{capacity} "
+        f"dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    check_error(LIBINFINIOP.infiniopSetDescriptorCacheCapacity(handle, capacity))
+
+    # the shapes the cache holds, most recently used first
+    recent = []
+    expected_hits = 0
+    descriptors = {}
+    for shape in shapes:
+        a = TestTensor(shape, None, dtype, device)
+        b = TestTensor(shape, None, dtype, device)
+        c = TestTensor(shape, None, dtype, device, mode="zeros")
+
+        if sync is not None:
+            sync()
+
+        descriptor = infiniopOperatorDescriptor_t()
+        check_error(
+            LIBINFINIOP.infiniopCreateAddDescriptor(
+                handle, ctypes.byref(descriptor), c.descriptor, a.descriptor, b.descriptor
+            )
+        )
+        for tensor in [a, b, c]:
+            tensor.destroy_desc()
+
+        if shape in recent:
+            expected_hits += 1
+            # a hit returns the very descriptor created for this shape before
+            assert ctypes.addressof(descriptor.contents) == descriptors[shape]
+            recent.remove(shape)
+        recent = [shape] + recent[: capacity - 1]
+        descriptors[shape] = ctypes.addressof(descriptor.contents)
+
+        check_error(
+            LIBINFINIOP.infiniopAdd(
+                descriptor, None, 0, c.data(), a.data(), b.data(), None
+            )
+        )
+        expected = a.torch_tensor() + b.torch_tensor()
+        atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+        if DEBUG:
+            debug(c.actual_tensor(), expected, atol=atol, rtol=rtol)
+        assert torch.allclose(c.actual_tensor(), expected, atol=atol, rtol=rtol)
+
+        # destroying a cached descriptor leaves it to the cache
+        check_error(LIBINFINIOP.infiniopDestroyAddDescriptor(descriptor))
+
+    hits, misses, size = cache_stats(handle)
+    assert hits == expected_hits
+    assert misses == len(shapes) - expected_hits
+    assert size == len(recent)
+
+    check_error(LIBINFINIOP.infiniopSetDescriptorCacheCapacity(handle, 0))
+    assert cache_stats(handle) == (0, 0, 0)
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES_, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
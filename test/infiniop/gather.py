@@ -12,6 +12,7 @@ from libinfiniop import (
     profile_operation,
     InfiniDtype,
     InfiniDtypeNames,
+    InfiniDeviceEnum,
     InfiniDeviceNames,
     infiniopOperatorDescriptor_t,
 )
@@ -61,6 +62,17 @@ _TEST_CASES = [
     ((3, 4, 5), 2, (3, 4, 3), None, None),  # 3D张量在第2维进行gather
 ]
 
+# Embedding lookups: (vocab, hidden, num_tokens, dequantize)
+# index 在 hidden 维上广播 (stride 0)，每个索引取整行；dequantize 时输出为 f32（仅 CPU）
+_EMBEDDING_TEST_CASES = [
+    (1000, 64, 1, False),
+    (32000, 512, 16, False),
+    (32000, 512, 16, True),
+    (151936, 896, 7, True),
+]
+
+_EMBEDDING_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
 # Data types used for testing - 所有合法类型
 _TENSOR_DTYPES = [
     InfiniDtype.F16, InfiniDtype.F32, InfiniDtype.F64, InfiniDtype.BF16,
@@ -170,6 +182,56 @@ def test(
     check_error(LIBINFINIOP.infiniopDestroyGatherDescriptor(descriptor))
 
 
+def test_embedding(handle, device, vocab, hidden, num_tokens, dequantize, dtype=InfiniDtype.F16, sync=None):
+    if dequantize and (device != InfiniDeviceEnum.CPU or dtype == InfiniDtype.F32):
+        return
+    out_dtype = InfiniDtype.F32 if dequantize else dtype
+    print(
+        f"Testing Gather (embedding) on {InfiniDeviceNames[device]} with vocab:{vocab} hidden:{hidden} num_tokens:{num_tokens} dtype:{InfiniDtypeNames[dtype]} out_dtype:{InfiniDtypeNames[out_dtype]}"
+    )
+
+    table = TestTensor((vocab, hidden), None, dtype, device)
+    output = TestTensor((num_tokens, hidden), None, out_dtype, device, mode="zeros")
+    ids = torch.randint(0, vocab, (num_tokens, 1), dtype=torch.int64)
+    index = TestTensor((num_tokens, hidden), (1, 0), InfiniDtype.I64, device, "manual", set_tensor=ids)
+
+    expected = torch.gather(
+        table.torch_tensor(), 0, index.torch_tensor().expand(num_tokens, hidden)
+    ).to(output.torch_tensor().dtype)
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateGatherDescriptor(
+            handle, ctypes.byref(descriptor), table.descriptor, output.descriptor, 0, index.descriptor
+        )
+    )
+
+    def lib_gather():
+        check_error(LIBINFINIOP.infiniopGather(
+            descriptor, None, 0, output.data(), table.data(), index.data(), None
+        ))
+
+    lib_gather()
+
+    if DEBUG:
+        debug(output.actual_tensor(), expected, atol=0, rtol=0)
+    assert torch.equal(output.actual_tensor(), expected)
+
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: torch.nn.functional.embedding(ids.view(-1), table.torch_tensor()), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_gather(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+
+    for tensor in [table, output, index]:
+        tensor.destroy_desc()
+
+    check_error(LIBINFINIOP.infiniopDestroyGatherDescriptor(descriptor))
+
+
 if __name__ == "__main__":
     args = get_args()
     # 配置测试选项
@@ -188,5 +250,6 @@ if __name__ == "__main__":
 
     for device in get_test_devices(args):
         test_operator(device, test, test_cases_with_inplace, _TENSOR_DTYPES)
+        test_operator(device, test_embedding, _EMBEDDING_TEST_CASES, _EMBEDDING_DTYPES)
 
     print("\033[92mTest passed!\033[0m")
\ No newline at end of file
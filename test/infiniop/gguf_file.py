@@ -0,0 +1,125 @@
+import ctypes
+import os
+import tempfile
+from ctypes import c_char_p, c_size_t, c_void_p
+
+import gguf
+import numpy as np
+import torch
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    check_error,
+    create_handle,
+    destroy_handle,
+    get_args,
+    infiniopGGUFFile_t,
+    infiniopOperatorDescriptor_t,
+    infiniopTensorDescriptor_t,
+    InfiniDtype,
+    InfiniDeviceEnum,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shapes, alignment, flags
+    ([(4,), (3, 5)], None, 0),
+    ([(2, 3, 4), (7,), (1, 1)], 64, 1),
+    ([(64, 128), (128,)], 256, 1 | 2 | 4),
+]
+
+_TENSOR_DTYPES = [np.float16, np.float32]
+
+_DTYPE_MAP = {np.float16: InfiniDtype.F16, np.float32: InfiniDtype.F32}
+
+INFINI_STATUS_BAD_PARAM = 3
+
+DEBUG = False
+
+
+def test(handle, shapes, alignment, flags, dtype=np.float16):
+    print(f"Testing GGUF with shapes:{shapes} alignment:{alignment} flags:{flags} dtype:{dtype.__name__}")
+
+    arrays = {f"blk.{i}.weight": np.random.rand(*shape).astype(dtype) for i, shape in enumerate(shapes)}
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, "model.gguf")
+        writer = gguf.GGUFWriter(path, "test")
+        if alignment is not None:
+            writer.add_custom_alignment(alignment)
+        writer.add_array("tokenizer.ggml.tokens", ["a", "bc", "def"])
+        for name, array in arrays.items():
+            writer.add_tensor(name, array)
+        writer.write_header_to_file()
+        writer.write_kv_data_to_file()
+        writer.write_tensors_to_file()
+        writer.close()
+
+        file = infiniopGGUFFile_t()
+        check_error(LIBINFINIOP.infiniopOpenGGUF(ctypes.byref(file), path.encode(), flags))
+        check_error(LIBINFINIOP.infiniopWaitGGUF(file))
+        huge_bytes = c_size_t(0)
+        check_error(LIBINFINIOP.infiniopGetGGUFHugePageBytes(file, ctypes.byref(huge_bytes)))
+        assert huge_bytes.value <= os.path.getsize(path)
+
+        count = c_size_t(0)
+        check_error(LIBINFINIOP.infiniopGetGGUFTensorCount(file, ctypes.byref(count)))
+        assert count.value == len(arrays)
+        index = c_size_t(0)
+        assert LIBINFINIOP.infiniopFindGGUFTensor(file, b"missing", ctypes.byref(index)) == INFINI_STATUS_BAD_PARAM
+
+        for name, array in arrays.items():
+            check_error(LIBINFINIOP.infiniopFindGGUFTensor(file, name.encode(), ctypes.byref(index)))
+            tensor_name = c_char_p()
+            desc = infiniopTensorDescriptor_t()
+            data = c_void_p()
+            check_error(
+                LIBINFINIOP.infiniopGetGGUFTensor(
+                    file, index, ctypes.byref(tensor_name), ctypes.byref(desc), ctypes.byref(data)
+                )
+            )
+            assert tensor_name.value == name.encode()
+            assert data.value % (alignment or 32) == 0
+
+            # the data is used in place
+            mapped = np.frombuffer(
+                (ctypes.c_char * array.nbytes).from_address(data.value), dtype=dtype
+            ).reshape(array.shape)
+            assert np.array_equal(mapped, array)
+
+            # and the descriptor describes it to operators
+            out = TestTensor(array.shape, None, _DTYPE_MAP[dtype], InfiniDeviceEnum.CPU, mode="zeros")
+            descriptor = infiniopOperatorDescriptor_t()
+            check_error(
+                LIBINFINIOP.infiniopCreateRearrangeDescriptor(
+                    handle, ctypes.byref(descriptor), out.descriptor, desc
+                )
+            )
+            check_error(LIBINFINIOP.infiniopRearrange(descriptor, out.data(), data, None))
+            check_error(LIBINFINIOP.infiniopDestroyRearrangeDescriptor(descriptor))
+            assert torch.equal(out.actual_tensor(), torch.from_numpy(array))
+            if DEBUG:
+                print(name, array.shape, hex(data.value))
+
+        check_error(LIBINFINIOP.infiniopCloseGGUF(file))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    np.random.seed(0)
+    LIBINFINIOP.infinirtSetDevice(InfiniDeviceEnum.CPU, ctypes.c_int(0))
+    handle = create_handle()
+    try:
+        for test_case in _TEST_CASES_:
+            for dtype in _TENSOR_DTYPES:
+                test(handle, *test_case, dtype)
+    finally:
+        destroy_handle(handle)
+
+    print("\033[92mTest passed!\033[0m")
@@ -0,0 +1,235 @@
+import torch
+import ctypes
+from ctypes import c_size_t
+from torch.nn import functional as F
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceEnum,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+    infiniopGraph_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape, parallel
+    ((13, 4), 0),
+    ((13, 4), 1),
+    ((64, 4096), 0),
+    ((64, 4096), 1),
+]
+
+# x_shape, w_shape, parallel; two convolutions of one input share a level and the thread team
+_CONV_TEST_CASES_ = [
+    ((2, 16, 14, 14), (32, 16, 3, 3), 0),
+    ((2, 16, 14, 14), (32, 16, 3, 3), 1),
+    ((4, 32, 28, 28), (64, 32, 1, 1), 1),
+]
+
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.F32, InfiniDtype.BF16]
+
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-3},
+    InfiniDtype.F32: {"atol": 1e-6, "rtol": 1e-6},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 1e-2},
+}
+
+_CONV_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.F32: {"atol": 1e-4, "rtol": 1e-4},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 5e-2},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def chain(a, b):
+    # c = a + b, e = a * b, f = c * e, g = a + a
+    c = a + b
+    e = a * b
+    return c * e, a + a
+
+
+def test(handle, device, shape, parallel, dtype=InfiniDtype.F16, sync=None):
+    print(
+        f"Testing Graph on {InfiniDeviceNames[device]} with shape:{shape} parallel:{parallel} "
+        f"dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    a = TestTensor(shape, None, dtype, device)
+    b = TestTensor(shape, None, dtype, device)
+    c, e, f, g = [TestTensor(shape, None, dtype, device, mode="zeros") for _ in range(4)]
+
+    add_desc = infiniopOperatorDescriptor_t()
+    mul_desc = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateAddDescriptor(
+            handle, ctypes.byref(add_desc), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+    check_error(
+        LIBINFINIOP.infiniopCreateMulDescriptor(
+            handle, ctypes.byref(mul_desc), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [a, b, c, e, f, g]:
+        tensor.destroy_desc()
+
+    if sync is not None:
+        sync()
+
+    check_error(LIBINFINIOP.infiniopBeginGraphCapture(handle))
+    calls = [
+        (LIBINFINIOP.infiniopAdd, add_desc, c, a, b),
+        (LIBINFINIOP.infiniopMul, mul_desc, e, a, b),
+        (LIBINFINIOP.infiniopMul, mul_desc, f, c, e),
+        (LIBINFINIOP.infiniopAdd, add_desc, g, a, a),
+    ]
+    for fn, desc, out, x, y in calls:
+        check_error(fn(desc, None, 0, out.data(), x.data(), y.data(), None))
+    graph = infiniopGraph_t()
+    check_error(LIBINFINIOP.infiniopEndGraphCapture(handle, ctypes.byref(graph), parallel))
+
+    # capturing records the calls without running them
+    assert torch.all(f.actual_tensor() == 0)
+
+    node_count = c_size_t(0)
+    check_error(LIBINFINIOP.infiniopGetGraphNodeCount(graph, ctypes.byref(node_count)))
+    assert node_count.value == len(calls)
+
+    workspace_size = c_size_t(0)
+    check_error(LIBINFINIOP.infiniopGetGraphWorkspaceSize(graph, ctypes.byref(workspace_size)))
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    def lib_graph():
+        check_error(
+            LIBINFINIOP.infiniopGraphLaunch(graph, workspace.data(), workspace.size(), None)
+        )
+
+    lib_graph()
+
+    expected_f, expected_g = chain(a.torch_tensor(), b.torch_tensor())
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(f.actual_tensor(), expected_f, atol=atol, rtol=rtol)
+    assert torch.allclose(f.actual_tensor(), expected_f, atol=atol, rtol=rtol)
+    assert torch.allclose(g.actual_tensor(), expected_g, atol=atol, rtol=rtol)
+
+    if PROFILE:
+        def lib_calls():
+            for fn, desc, out, x, y in calls:
+                check_error(fn(desc, None, 0, out.data(), x.data(), y.data(), None))
+
+        # fmt: off
+        profile_operation("PyTorch", lambda: chain(a.torch_tensor(), b.torch_tensor()), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("  calls", lambda: lib_calls(), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("  graph", lambda: lib_graph(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+
+    check_error(LIBINFINIOP.infiniopDestroyGraph(graph))
+    check_error(LIBINFINIOP.infiniopDestroyAddDescriptor(add_desc))
+    check_error(LIBINFINIOP.infiniopDestroyMulDescriptor(mul_desc))
+
+
+def test_conv(handle, device, x_shape, w_shape, parallel, dtype=InfiniDtype.F16, sync=None):
+    print(
+        f"Testing Graph of Conv on {InfiniDeviceNames[device]} with x_shape:{x_shape} w_shape:{w_shape} "
+        f"parallel:{parallel} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    pads = (w_shape[2] // 2, w_shape[3] // 2)
+    x = TestTensor(x_shape, None, dtype, device, scale=0.1)
+    weights = [TestTensor(w_shape, None, dtype, device, scale=0.1) for _ in range(2)]
+    y_shape = (x_shape[0], w_shape[0], x_shape[2], x_shape[3])
+    ys = [TestTensor(y_shape, None, dtype, device, mode="zeros") for _ in range(2)]
+
+    pads_array = (ctypes.c_int64 * 2)(*pads)
+    ones_array = (ctypes.c_int64 * 2)(1, 1)
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateConvDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            ys[0].descriptor,
+            x.descriptor,
+            weights[0].descriptor,
+            None,
+            ctypes.cast(pads_array, ctypes.c_void_p),
+            ctypes.cast(ones_array, ctypes.c_void_p),
+            ctypes.cast(ones_array, ctypes.c_void_p),
+            2,
+            1,
+        )
+    )
+    conv_workspace_size = c_size_t(0)
+    check_error(LIBINFINIOP.infiniopGetConvWorkspaceSize(descriptor, ctypes.byref(conv_workspace_size)))
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [x, *weights, *ys]:
+        tensor.destroy_desc()
+
+    if sync is not None:
+        sync()
+
+    # on CPU each node runs on its share of the team, below the thread count the descriptor was made for
+    check_error(LIBINFINIOP.infiniopBeginGraphCapture(handle))
+    for w, y in zip(weights, ys):
+        check_error(
+            LIBINFINIOP.infiniopConv(
+                descriptor, None, conv_workspace_size.value, y.data(), x.data(), w.data(), None, None
+            )
+        )
+    graph = infiniopGraph_t()
+    check_error(LIBINFINIOP.infiniopEndGraphCapture(handle, ctypes.byref(graph), parallel))
+
+    workspace_size = c_size_t(0)
+    check_error(LIBINFINIOP.infiniopGetGraphWorkspaceSize(graph, ctypes.byref(workspace_size)))
+    # the two convolutions get disjoint workspaces when they share a level
+    assert workspace_size.value >= conv_workspace_size.value * (2 if parallel else 1)
+    workspace = TestWorkspace(workspace_size.value, device)
+    check_error(LIBINFINIOP.infiniopGraphLaunch(graph, workspace.data(), workspace.size(), None))
+
+    atol, rtol = get_tolerance(_CONV_TOLERANCE_MAP, dtype)
+    for w, y in zip(weights, ys):
+        ans = F.conv2d(x.torch_tensor().float(), w.torch_tensor().float(), padding=pads).to(y.actual_tensor().dtype)
+        if DEBUG:
+            debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+        assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+
+    check_error(LIBINFINIOP.infiniopDestroyGraph(graph))
+    check_error(LIBINFINIOP.infiniopDestroyConvDescriptor(descriptor))
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES_, _TENSOR_DTYPES)
+        if device == InfiniDeviceEnum.CPU:
+            test_operator(device, test_conv, _CONV_TEST_CASES_, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
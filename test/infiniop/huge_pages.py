@@ -0,0 +1,83 @@
+import ctypes
+from ctypes import c_uint64, c_void_p
+
+import torch
+from libinfiniop import (
+    LIBINFINIOP,
+    check_error,
+    get_args,
+    InfiniDeviceEnum,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # size in bytes
+    1000,
+    (2 << 20) + 4096,
+    64 << 20,
+]
+
+# infinirtHugePages_t
+INFINIRT_HUGE_PAGES_NONE = 0
+INFINIRT_HUGE_PAGES_TRANSPARENT = 1
+INFINIRT_HUGE_PAGES_2M = 2
+INFINIRT_HUGE_PAGES_1G = 3
+
+INFINI_STATUS_BAD_PARAM = 3
+
+DEBUG = False
+
+
+def huge_page_bytes(ptr=None, size=0):
+    count = c_uint64(0)
+    check_error(LIBINFINIOP.infinirtGetHugePageBytes(ptr, size, ctypes.byref(count)))
+    return count.value
+
+
+def test(mode, size):
+    print(f"Testing huge pages with mode:{mode} size:{size}")
+
+    check_error(LIBINFINIOP.infinirtSetHugePages(mode))
+    ptr = c_void_p()
+    check_error(LIBINFINIOP.infinirtMalloc(ctypes.byref(ptr), size))
+    # every mode falls back to smaller pages, an allocation always succeeds
+    data = torch.frombuffer((ctypes.c_uint8 * size).from_address(ptr.value), dtype=torch.uint8)
+    data.fill_(7)
+    assert torch.all(data == 7)
+
+    huge = huge_page_bytes(ptr, size)
+    if DEBUG:
+        print(f"{huge} of {size} bytes backed by huge pages")
+    # an allocation smaller than a huge page is never backed by one
+    assert huge <= size and (huge == 0 or size >= 2 << 20)
+    if mode == INFINIRT_HUGE_PAGES_NONE:
+        assert huge == 0
+    assert huge_page_bytes() >= huge
+
+    check_error(LIBINFINIOP.infinirtFree(ptr))
+    check_error(LIBINFINIOP.infinirtSetHugePages(INFINIRT_HUGE_PAGES_NONE))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    LIBINFINIOP.infinirtSetDevice(InfiniDeviceEnum.CPU, ctypes.c_int(0))
+    assert LIBINFINIOP.infinirtSetHugePages(7) == INFINI_STATUS_BAD_PARAM
+    for mode in [
+        INFINIRT_HUGE_PAGES_NONE,
+        INFINIRT_HUGE_PAGES_TRANSPARENT,
+        INFINIRT_HUGE_PAGES_2M,
+        INFINIRT_HUGE_PAGES_1G,
+    ]:
+        for size in _TEST_CASES_:
+            test(mode, size)
+    # every allocation is freed
+    assert huge_page_bytes() == 0
+
+    print("\033[92mTest passed!\033[0m")
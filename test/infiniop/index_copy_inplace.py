@@ -65,6 +65,15 @@ _TEST_CASES_ = [
     # Edge cases with minimal strides
     ((4, 2), (2, 2), (2,), 0, (4, 2), None, None),  # minimal stride case
     ((2, 4), (2, 2), (2,), 1, (8, 2), None, None),  # minimal stride case dim=1
+
+    # Duplicate indices, the last source slice wins
+    ((4, 3), (10, 3), (10,), 0, None, None, None),
+    ((3, 4), (3, 9), (9,), 1, None, None, None),
+
+    # KV-cache slot writes: (slots, heads, head_dim)
+    ((256, 8, 64), (1, 8, 64), (1,), 0, None, None, None),  # decode
+    ((256, 8, 64), (32, 8, 64), (32,), 0, None, None, None),  # prefill
+    ((8, 256, 64), (8, 16, 64), (16,), 1, None, None, None),  # head-major cache
 ]
 
 # Data types used for testing
@@ -1,7 +1,7 @@
 import os
 import platform
 import ctypes
-from ctypes import c_int, c_int64, c_uint64, POINTER
+from ctypes import c_int, c_int64, c_uint64, c_void_p, POINTER
 from .datatypes import *
 from .devices import *
 from .op_register import OpRegister
@@ -69,8 +69,35 @@ def open_lib():
     lib.infiniopCreateHandle.restype = c_int
     lib.infiniopDestroyHandle.argtypes = [infiniopHandle_t]
     lib.infiniopDestroyHandle.restype = c_int
+    lib.infiniopSetDescriptorCacheCapacity.argtypes = [infiniopHandle_t, c_uint64]
+    lib.infiniopSetDescriptorCacheCapacity.restype = c_int
+    lib.infiniopGetDescriptorCacheStats.argtypes = [
+        infiniopHandle_t,
+        POINTER(c_uint64),
+        POINTER(c_uint64),
+        POINTER(c_uint64),
+    ]
+    lib.infiniopGetDescriptorCacheStats.restype = c_int
     lib.infinirtSetDevice.argtypes = [c_int, c_int]
     lib.infinirtSetDevice.restype = c_int
+    lib.infiniopSetHandleNumaNode.argtypes = [infiniopHandle_t, c_int]
+    lib.infiniopSetHandleNumaNode.restype = c_int
+    lib.infiniopGetHandleNumaNode.argtypes = [infiniopHandle_t, POINTER(c_int)]
+    lib.infiniopGetHandleNumaNode.restype = c_int
+    lib.infinirtGetNumaNodeCount.argtypes = [POINTER(c_int)]
+    lib.infinirtGetNumaNodeCount.restype = c_int
+    lib.infinirtGetNumaNodeCpuCount.argtypes = [c_int, POINTER(c_int)]
+    lib.infinirtGetNumaNodeCpuCount.restype = c_int
+    lib.infinirtSetMemPolicy.argtypes = [c_int, c_int]
+    lib.infinirtSetMemPolicy.restype = c_int
+    lib.infinirtSetHugePages.argtypes = [c_int]
+    lib.infinirtSetHugePages.restype = c_int
+    lib.infinirtGetHugePageBytes.argtypes = [c_void_p, c_uint64, POINTER(c_uint64)]
+    lib.infinirtGetHugePageBytes.restype = c_int
+    lib.infinirtMalloc.argtypes = [POINTER(c_void_p), c_uint64]
+    lib.infinirtMalloc.restype = c_int
+    lib.infinirtFree.argtypes = [c_void_p]
+    lib.infinirtFree.restype = c_int
 
     OpRegister.register_lib(lib)
 
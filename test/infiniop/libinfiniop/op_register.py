@@ -2,9 +2,13 @@ from .structs import (
     infiniopHandle_t,
     infiniopTensorDescriptor_t,
     infiniopOperatorDescriptor_t,
+    infiniopGraph_t,
+    infiniopMemoryPlanner_t,
+    infiniopGGUFFile_t,
+    TraceSummary,
 )
 
-from ctypes import c_int32, c_void_p, c_size_t, POINTER, c_float
+from ctypes import c_char_p, c_int32, c_int64, c_void_p, c_size_t, POINTER, c_float
 
 
 class OpRegister:
@@ -266,6 +270,23 @@ def random_sample_(lib):
         c_void_p,
     ]
 
+    lib.infiniopRandomSampleBatch.restype = c_int32
+    lib.infiniopRandomSampleBatch.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        POINTER(c_float),
+        c_float,
+        c_int32,
+        c_float,
+        c_float,
+        c_float,
+        POINTER(c_int32),
+        c_void_p,
+    ]
+
     lib.infiniopDestroyRandomSampleDescriptor.restype = c_int32
     lib.infiniopDestroyRandomSampleDescriptor.argtypes = [
         infiniopOperatorDescriptor_t,
@@ -660,6 +681,7 @@ def conv_(lib):
         c_void_p,
         c_void_p,
         c_size_t,
+        c_size_t,
     ]
     lib.infiniopGetConvWorkspaceSize.restype = c_int32
     lib.infiniopGetConvWorkspaceSize.argtypes = [
@@ -677,6 +699,27 @@ def conv_(lib):
         c_void_p,
         c_void_p,
     ]
+    lib.infiniopCreateConvPackedWeights.restype = c_int32
+    lib.infiniopCreateConvPackedWeights.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_void_p),
+        c_void_p,
+    ]
+    lib.infiniopDestroyConvPackedWeights.restype = c_int32
+    lib.infiniopDestroyConvPackedWeights.argtypes = [
+        c_void_p,
+    ]
+    lib.infiniopConvPacked.restype = c_int32
+    lib.infiniopConvPacked.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
     lib.infiniopDestroyConvDescriptor.restype = c_int32
     lib.infiniopDestroyConvDescriptor.argtypes = [
         infiniopOperatorDescriptor_t,
@@ -1004,6 +1047,45 @@ def equal_(lib):
     lib.infiniopDestroyEqualDescriptor.argtypes = [infiniopOperatorDescriptor_t]
 
 
+@OpRegister.operator
+def cross_entropy_(lib):
+    lib.infiniopCreateCrossEntropyDescriptor.restype = c_int32
+    lib.infiniopCreateCrossEntropyDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        c_int32,
+        c_int64,
+        c_float,
+    ]
+
+    lib.infiniopGetCrossEntropyWorkspaceSize.restype = c_int32
+    lib.infiniopGetCrossEntropyWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopCrossEntropy.restype = c_int32
+    lib.infiniopCrossEntropy.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyCrossEntropyDescriptor.restype = c_int32
+    lib.infiniopDestroyCrossEntropyDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
 @OpRegister.operator
 def crossentropyloss_backward_(lib):
     lib.infiniopCreateCrossEntropyLossBackwardDescriptor.restype = c_int32
@@ -1261,6 +1343,18 @@ def scatter_(lib):
         c_int32,
     ]
 
+    lib.infiniopCreateScatterReduceDescriptor.restype = c_int32
+    lib.infiniopCreateScatterReduceDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        c_int32,
+        c_int32,
+    ]
+
     lib.infiniopGetScatterWorkspaceSize.restype = c_int32
     lib.infiniopGetScatterWorkspaceSize.argtypes = [
         infiniopOperatorDescriptor_t,
@@ -1276,6 +1370,7 @@ def scatter_(lib):
         c_void_p,
         c_void_p,
         c_void_p,
+        c_void_p,
     ]
 
     lib.infiniopDestroyScatterDescriptor.restype = c_int32
@@ -1284,6 +1379,42 @@ def scatter_(lib):
     ]
 
 
+@OpRegister.operator
+def reduce_(lib):
+    lib.infiniopCreateReduceDescriptor.restype = c_int32
+    lib.infiniopCreateReduceDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        POINTER(c_size_t),
+        c_size_t,
+        c_int32,
+        c_int32,
+    ]
+
+    lib.infiniopGetReduceWorkspaceSize.restype = c_int32
+    lib.infiniopGetReduceWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopReduce.restype = c_int32
+    lib.infiniopReduce.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyReduceDescriptor.restype = c_int32
+    lib.infiniopDestroyReduceDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
 @OpRegister.operator
 def reduce_max_(lib):
     lib.infiniopCreateReduceMaxDescriptor.restype = c_int32
@@ -1591,4 +1722,229 @@ def logsoftmax_(lib):
     lib.infiniopDestroyLogSoftmaxDescriptor.restype = c_int32
     lib.infiniopDestroyLogSoftmaxDescriptor.argtypes = [
         infiniopOperatorDescriptor_t,
-    ]
\ No newline at end of file
+    ]
+
+@OpRegister.operator
+def mlp_(lib):
+    lib.infiniopCreateMLPDescriptor.restype = c_int32
+    lib.infiniopCreateMLPDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+    ]
+
+    lib.infiniopGetMLPWorkspaceSize.restype = c_int32
+    lib.infiniopGetMLPWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopMLP.restype = c_int32
+    lib.infiniopMLP.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyMLPDescriptor.restype = c_int32
+    lib.infiniopDestroyMLPDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def qkv_rope_(lib):
+    lib.infiniopCreateQKVRoPEDescriptor.restype = c_int32
+    lib.infiniopCreateQKVRoPEDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+    ]
+
+    lib.infiniopGetQKVRoPEWorkspaceSize.restype = c_int32
+    lib.infiniopGetQKVRoPEWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopQKVRoPE.restype = c_int32
+    lib.infiniopQKVRoPE.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyQKVRoPEDescriptor.restype = c_int32
+    lib.infiniopDestroyQKVRoPEDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def rope_theta_(lib):
+    lib.infiniopCreateRoPEThetaDescriptor.restype = c_int32
+    lib.infiniopCreateRoPEThetaDescriptor.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopOperatorDescriptor_t),
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        infiniopTensorDescriptor_t,
+        c_float,
+        c_size_t,
+        c_int32,
+    ]
+
+    lib.infiniopGetRoPEThetaWorkspaceSize.restype = c_int32
+    lib.infiniopGetRoPEThetaWorkspaceSize.argtypes = [
+        infiniopOperatorDescriptor_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopRoPETheta.restype = c_int32
+    lib.infiniopRoPETheta.argtypes = [
+        infiniopOperatorDescriptor_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyRoPEThetaDescriptor.restype = c_int32
+    lib.infiniopDestroyRoPEThetaDescriptor.argtypes = [
+        infiniopOperatorDescriptor_t,
+    ]
+
+
+@OpRegister.operator
+def graph_(lib):
+    lib.infiniopBeginGraphCapture.restype = c_int32
+    lib.infiniopBeginGraphCapture.argtypes = [infiniopHandle_t]
+
+    lib.infiniopEndGraphCapture.restype = c_int32
+    lib.infiniopEndGraphCapture.argtypes = [
+        infiniopHandle_t,
+        POINTER(infiniopGraph_t),
+        c_int32,
+    ]
+
+    lib.infiniopGetGraphNodeCount.restype = c_int32
+    lib.infiniopGetGraphNodeCount.argtypes = [infiniopGraph_t, POINTER(c_size_t)]
+
+    lib.infiniopGetGraphWorkspaceSize.restype = c_int32
+    lib.infiniopGetGraphWorkspaceSize.argtypes = [infiniopGraph_t, POINTER(c_size_t)]
+
+    lib.infiniopGraphLaunch.restype = c_int32
+    lib.infiniopGraphLaunch.argtypes = [
+        infiniopGraph_t,
+        c_void_p,
+        c_size_t,
+        c_void_p,
+    ]
+
+    lib.infiniopDestroyGraph.restype = c_int32
+    lib.infiniopDestroyGraph.argtypes = [infiniopGraph_t]
+
+
+@OpRegister.operator
+def memory_planner_(lib):
+    lib.infiniopCreateMemoryPlanner.restype = c_int32
+    lib.infiniopCreateMemoryPlanner.argtypes = [
+        POINTER(infiniopMemoryPlanner_t),
+        c_size_t,
+    ]
+
+    lib.infiniopMemoryPlannerAddBuffer.restype = c_int32
+    lib.infiniopMemoryPlannerAddBuffer.argtypes = [
+        infiniopMemoryPlanner_t,
+        c_size_t,
+        c_size_t,
+        c_size_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopMemoryPlannerPlan.restype = c_int32
+    lib.infiniopMemoryPlannerPlan.argtypes = [infiniopMemoryPlanner_t, POINTER(c_size_t)]
+
+    lib.infiniopMemoryPlannerGetOffset.restype = c_int32
+    lib.infiniopMemoryPlannerGetOffset.argtypes = [
+        infiniopMemoryPlanner_t,
+        c_size_t,
+        POINTER(c_size_t),
+    ]
+
+    lib.infiniopDestroyMemoryPlanner.restype = c_int32
+    lib.infiniopDestroyMemoryPlanner.argtypes = [infiniopMemoryPlanner_t]
+
+
+@OpRegister.operator
+def gguf_(lib):
+    lib.infiniopOpenGGUF.restype = c_int32
+    lib.infiniopOpenGGUF.argtypes = [POINTER(infiniopGGUFFile_t), c_char_p, c_int32]
+
+    lib.infiniopGetGGUFTensorCount.restype = c_int32
+    lib.infiniopGetGGUFTensorCount.argtypes = [infiniopGGUFFile_t, POINTER(c_size_t)]
+
+    lib.infiniopFindGGUFTensor.restype = c_int32
+    lib.infiniopFindGGUFTensor.argtypes = [infiniopGGUFFile_t, c_char_p, POINTER(c_size_t)]
+
+    lib.infiniopGetGGUFTensor.restype = c_int32
+    lib.infiniopGetGGUFTensor.argtypes = [
+        infiniopGGUFFile_t,
+        c_size_t,
+        POINTER(c_char_p),
+        POINTER(infiniopTensorDescriptor_t),
+        POINTER(c_void_p),
+    ]
+
+    lib.infiniopGetGGUFHugePageBytes.restype = c_int32
+    lib.infiniopGetGGUFHugePageBytes.argtypes = [infiniopGGUFFile_t, POINTER(c_size_t)]
+
+    lib.infiniopWaitGGUF.restype = c_int32
+    lib.infiniopWaitGGUF.argtypes = [infiniopGGUFFile_t]
+
+    lib.infiniopCloseGGUF.restype = c_int32
+    lib.infiniopCloseGGUF.argtypes = [infiniopGGUFFile_t]
+
+
+@OpRegister.operator
+def trace_(lib):
+    lib.infiniopStartTrace.restype = c_int32
+    lib.infiniopStartTrace.argtypes = [c_size_t]
+
+    lib.infiniopStopTrace.restype = c_int32
+    lib.infiniopStopTrace.argtypes = []
+
+    lib.infiniopExportTrace.restype = c_int32
+    lib.infiniopExportTrace.argtypes = [c_char_p]
+
+    lib.infiniopGetTraceSummary.restype = c_int32
+    lib.infiniopGetTraceSummary.argtypes = [POINTER(TraceSummary), POINTER(c_size_t)]
@@ -1,4 +1,4 @@
-from ctypes import c_int, Structure, POINTER
+from ctypes import c_char, c_double, c_int, c_size_t, Structure, POINTER
 
 
 class TensorDescriptor(Structure):
@@ -20,3 +20,33 @@ class OpDescriptor(Structure):
 
 
 infiniopOperatorDescriptor_t = POINTER(OpDescriptor)
+
+
+class Graph(Structure):
+    _fields_ = []
+
+
+infiniopGraph_t = POINTER(Graph)
+
+
+class GGUFFile(Structure):
+    _fields_ = []
+
+
+infiniopGGUFFile_t = POINTER(GGUFFile)
+
+
+class MemoryPlanner(Structure):
+    _fields_ = []
+
+
+infiniopMemoryPlanner_t = POINTER(MemoryPlanner)
+
+
+class TraceSummary(Structure):
+    _fields_ = [
+        ("op", c_char * 32),
+        ("count", c_size_t),
+        ("total_us", c_double),
+        ("bytes", c_size_t),
+    ]
@@ -1,5 +1,6 @@
 import torch
 import ctypes
+import functools
 from ctypes import c_uint64
 from libinfiniop import (
     LIBINFINIOP,
@@ -36,6 +37,7 @@ _TEST_CASES_ = [
     ((16, 50257), None, None),
     ((4, 8, 256), None, None),
     ((2, 16, 1024), None, None),
+    ((2, 100000), None, None),
 ]
 
 # Data types used for testing
@@ -74,6 +76,12 @@ _TEST_CASES = [
     for inplace_item in _INPLACE
 ]
 
+# a NaN in the last row turns the whole row into NaN
+_NAN_TEST_CASES = [
+    ((4, 9), None, None, Inplace.OUT_OF_PLACE),
+    ((3, 100000), None, None, Inplace.INPLACE_X),
+]
+
 DEBUG = False
 PROFILE = False
 NUM_PRERUN = 10
@@ -94,12 +102,17 @@ def test(
     inplace=Inplace.OUT_OF_PLACE,
     dtype=InfiniDtype.F16,
     sync=None,
+    nan_row=False,
 ):
     print(
-        f"Testing LogSoftmax on {InfiniDeviceNames[device]} with shape:{shape} x_stride:{x_stride} y_stride:{y_stride} dtype:{InfiniDtypeNames[dtype]} inplace:{inplace}"
+        f"Testing LogSoftmax on {InfiniDeviceNames[device]} with shape:{shape} x_stride:{x_stride} y_stride:{y_stride} dtype:{InfiniDtypeNames[dtype]} inplace:{inplace} nan_row:{nan_row}"
     )
 
     x = TestTensor(shape, x_stride, dtype, device)
+    if nan_row:
+        torch_x = x.torch_tensor().clone()
+        torch_x[..., -1, 1] = torch.nan
+        x = TestTensor.from_torch(torch_x, dtype, device)
     ans = logsoftmax(x.actual_tensor())
 
     # Convert answer to match input dtype for default behavior
@@ -158,7 +171,9 @@ def test(
     # Always print debug info for failed cases
     actual = y.actual_tensor()
     max_diff = torch.max(torch.abs(actual - ans))
-    is_close = torch.allclose(actual, ans, atol=atol, rtol=rtol)
+    is_close = torch.allclose(actual, ans, atol=atol, rtol=rtol, equal_nan=nan_row)
+    if nan_row:
+        assert torch.isnan(actual[..., -1, :]).all()
 
     if DEBUG or not is_close:
         print(f"\n=== Debug Info ===")
@@ -296,6 +311,7 @@ if __name__ == "__main__":
     for device in get_test_devices(args):
         # Test standard cases (fp32 output)
         test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+        test_operator(device, functools.partial(test, nan_row=True), _NAN_TEST_CASES, _TENSOR_DTYPES)
 
         # Test mixed precision cases
         from libinfiniop import create_handle, destroy_handle, get_sync_func
@@ -0,0 +1,100 @@
+import ctypes
+import random
+from ctypes import c_size_t
+from libinfiniop import (
+    LIBINFINIOP,
+    check_error,
+    get_args,
+    infiniopMemoryPlanner_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # buffer count, step count, max size, alignment
+    (1, 1, 1000, 256),
+    (8, 4, 4096, 256),
+    (64, 32, 1 << 20, 256),
+    (200, 50, 1 << 16, 64),
+]
+
+DEBUG = False
+
+
+def align(size, alignment):
+    return (size + alignment - 1) // alignment * alignment
+
+
+def test(count, steps, max_size, alignment):
+    print(
+        f"Testing MemoryPlanner with count:{count} steps:{steps} max_size:{max_size} alignment:{alignment}"
+    )
+
+    buffers = []
+    for _ in range(count):
+        first = random.randrange(steps)
+        last = random.randrange(first, min(first + 8, steps + 1))
+        buffers.append((random.randrange(max_size), first, min(last, steps - 1)))
+
+    planner = infiniopMemoryPlanner_t()
+    check_error(LIBINFINIOP.infiniopCreateMemoryPlanner(ctypes.byref(planner), alignment))
+    ids = []
+    for size, first, last in buffers:
+        buffer_id = c_size_t(0)
+        check_error(
+            LIBINFINIOP.infiniopMemoryPlannerAddBuffer(
+                planner, size, first, last, ctypes.byref(buffer_id)
+            )
+        )
+        ids.append(buffer_id.value)
+
+    arena_size = c_size_t(0)
+    check_error(LIBINFINIOP.infiniopMemoryPlannerPlan(planner, ctypes.byref(arena_size)))
+
+    offsets = []
+    for buffer_id in ids:
+        offset = c_size_t(0)
+        check_error(
+            LIBINFINIOP.infiniopMemoryPlannerGetOffset(planner, buffer_id, ctypes.byref(offset))
+        )
+        offsets.append(offset.value)
+    check_error(LIBINFINIOP.infiniopDestroyMemoryPlanner(planner))
+
+    for (size, first, last), offset in zip(buffers, offsets):
+        assert offset % alignment == 0
+        assert offset + size <= arena_size.value
+
+    # buffers live at the same step never overlap
+    for i, (size_i, first_i, last_i) in enumerate(buffers):
+        for j in range(i + 1, count):
+            size_j, first_j, last_j = buffers[j]
+            if size_i == 0 or size_j == 0 or last_i < first_j or last_j < first_i:
+                continue
+            assert (
+                offsets[i] + size_i <= offsets[j] or offsets[j] + size_j <= offsets[i]
+            )
+
+    # the arena holds at least the buffers live at the busiest step, at most all of them
+    live = max(
+        sum(align(size, alignment) for size, first, last in buffers if first <= s <= last)
+        for s in range(steps)
+    )
+    total = sum(align(size, alignment) for size, _, _ in buffers)
+    if DEBUG:
+        print(f"arena:{arena_size.value} busiest step:{live} unshared:{total}")
+    assert live <= arena_size.value <= total
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    random.seed(0)
+    for test_case in _TEST_CASES_:
+        test(*test_case)
+
+    print("\033[92mTest passed!\033[0m")
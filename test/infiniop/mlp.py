@@ -0,0 +1,149 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES = [
+    # ntok, hidden, inter, w_gate_up_stride, w_down_stride
+    (1, 64, 128, None, None),
+    (7, 96, 200, None, None),
+    (33, 128, 352, None, None),
+    (16, 64, 128, (1, 64), (1, 128)),
+    (100, 256, 688, None, None),
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 5e-3, "rtol": 5e-2},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-4},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def mlp(x, w_gate_up, w_down):
+    inter = w_down.shape[0]
+    gate = x.float() @ w_gate_up[:, :inter].float()
+    up = x.float() @ w_gate_up[:, inter:].float()
+    return ((torch.nn.functional.silu(gate) * up) @ w_down.float()).to(x.dtype)
+
+
+def test(
+    handle,
+    device,
+    ntok,
+    hidden,
+    inter,
+    w_gate_up_stride=None,
+    w_down_stride=None,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    print(
+        f"Testing MLP on {InfiniDeviceNames[device]} with ntok:{ntok} hidden:{hidden} inter:{inter} "
+        f"w_gate_up_stride:{w_gate_up_stride} w_down_stride:{w_down_stride} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    x = TestTensor((ntok, hidden), None, dtype, device, scale=2, bias=-1)
+    w_gate_up = TestTensor((hidden, 2 * inter), w_gate_up_stride, dtype, device, scale=0.2, bias=-0.1)
+    w_down = TestTensor((inter, hidden), w_down_stride, dtype, device, scale=0.2, bias=-0.1)
+    y = TestTensor((ntok, hidden), None, dtype, device, mode="zeros")
+
+    ans = mlp(x.torch_tensor(), w_gate_up.torch_tensor(), w_down.torch_tensor())
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateMLPDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            y.descriptor,
+            x.descriptor,
+            w_gate_up.descriptor,
+            w_down.descriptor,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [x, w_gate_up, w_down, y]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetMLPWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, y.device)
+
+    def lib_mlp():
+        check_error(
+            LIBINFINIOP.infiniopMLP(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x.data(),
+                w_gate_up.data(),
+                w_down.data(),
+                None,
+            )
+        )
+
+    lib_mlp()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+    assert torch.allclose(y.actual_tensor(), ans, atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("PyTorch", lambda: mlp(x.torch_tensor(), w_gate_up.torch_tensor(), w_down.torch_tensor()), device, NUM_PRERUN, NUM_ITERATIONS)
+        profile_operation("    lib", lambda: lib_mlp(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyMLPDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
@@ -0,0 +1,107 @@
+import ctypes
+from ctypes import c_int, c_void_p
+
+import torch
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    check_error,
+    create_handle,
+    destroy_handle,
+    get_args,
+    infiniopOperatorDescriptor_t,
+    InfiniDtype,
+    InfiniDeviceEnum,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape
+    (13, 4),
+    (257, 4097),
+]
+
+# infinirtMemPolicy_t
+INFINIRT_MEM_POLICY_DEFAULT = 0
+INFINIRT_MEM_POLICY_LOCAL = 1
+INFINIRT_MEM_POLICY_INTERLEAVE = 2
+INFINIRT_MEM_POLICY_BIND = 3
+INFINIRT_MEM_POLICY_PARTITION = 4
+
+INFINI_STATUS_BAD_PARAM = 3
+
+DEBUG = False
+
+
+def malloc_tensor(shape):
+    """A float32 tensor in memory from infinirtMalloc, with its pointer."""
+    numel = shape[0] * shape[1]
+    ptr = c_void_p()
+    check_error(LIBINFINIOP.infinirtMalloc(ctypes.byref(ptr), numel * 4))
+    buffer = (ctypes.c_float * numel).from_address(ptr.value)
+    return torch.frombuffer(buffer, dtype=torch.float32).view(shape), ptr
+
+
+def test(handle, node, policy, shape):
+    print(f"Testing NUMA on node:{node} with policy:{policy} shape:{shape}")
+
+    check_error(LIBINFINIOP.infinirtSetMemPolicy(policy, node))
+    check_error(LIBINFINIOP.infiniopSetHandleNumaNode(handle, node))
+    bound = c_int(-2)
+    check_error(LIBINFINIOP.infiniopGetHandleNumaNode(handle, ctypes.byref(bound)))
+    assert bound.value == node
+
+    (a, a_ptr), (b, b_ptr), (c, c_ptr) = [malloc_tensor(shape) for _ in range(3)]
+    # allocations made under a policy are zero-filled by their first touch
+    if policy != INFINIRT_MEM_POLICY_DEFAULT:
+        assert not c.any()
+    a.copy_(torch.rand(shape))
+    b.copy_(torch.rand(shape))
+
+    desc = TestTensor(shape, None, InfiniDtype.F32, InfiniDeviceEnum.CPU).descriptor
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(LIBINFINIOP.infiniopCreateAddDescriptor(handle, ctypes.byref(descriptor), desc, desc, desc))
+    check_error(LIBINFINIOP.infiniopAdd(descriptor, None, 0, c_ptr, a_ptr, b_ptr, None))
+    check_error(LIBINFINIOP.infiniopDestroyAddDescriptor(descriptor))
+    assert torch.equal(c, a + b)
+
+    for ptr in [a_ptr, b_ptr, c_ptr]:
+        check_error(LIBINFINIOP.infinirtFree(ptr))
+    check_error(LIBINFINIOP.infinirtSetMemPolicy(INFINIRT_MEM_POLICY_DEFAULT, 0))
+    check_error(LIBINFINIOP.infiniopSetHandleNumaNode(handle, -1))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    LIBINFINIOP.infinirtSetDevice(InfiniDeviceEnum.CPU, ctypes.c_int(0))
+    handle = create_handle()
+    try:
+        count = c_int(0)
+        check_error(LIBINFINIOP.infinirtGetNumaNodeCount(ctypes.byref(count)))
+        assert LIBINFINIOP.infinirtSetMemPolicy(INFINIRT_MEM_POLICY_BIND, count.value) == INFINI_STATUS_BAD_PARAM
+        assert LIBINFINIOP.infiniopSetHandleNumaNode(handle, count.value) == INFINI_STATUS_BAD_PARAM
+        for node in range(count.value):
+            cpus = c_int(0)
+            check_error(LIBINFINIOP.infinirtGetNumaNodeCpuCount(node, ctypes.byref(cpus)))
+            if cpus.value == 0:
+                continue
+            for policy in [
+                INFINIRT_MEM_POLICY_DEFAULT,
+                INFINIRT_MEM_POLICY_LOCAL,
+                INFINIRT_MEM_POLICY_INTERLEAVE,
+                INFINIRT_MEM_POLICY_BIND,
+                INFINIRT_MEM_POLICY_PARTITION,
+            ]:
+                for shape in _TEST_CASES_:
+                    test(handle, node, policy, shape)
+    finally:
+        destroy_handle(handle)
+
+    print("\033[92mTest passed!\033[0m")
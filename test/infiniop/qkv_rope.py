@@ -0,0 +1,206 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES = [
+    # ntok, hidden, n_q_head, n_kv_head, head_dim, cache_len, pos, has_bias
+    (1, 64, 4, 4, 16, 32, 0, False),
+    (1, 128, 8, 2, 32, 64, 17, True),
+    (7, 96, 6, 2, 16, 16, 9, True),
+    (20, 256, 4, 1, 128, 40, 0, False),
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 5e-3, "rtol": 5e-2},
+    InfiniDtype.F32: {"atol": 1e-5, "rtol": 1e-4},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def rotary_embedding(t, sin, cos):
+    # t: [ntok, n_head, head_dim], sin/cos: [ntok, head_dim // 2]
+    t_even, t_odd = t[..., 0::2], t[..., 1::2]
+    cos, sin = cos.unsqueeze(1), sin.unsqueeze(1)
+    out = torch.empty_like(t)
+    out[..., 0::2] = t_even * cos - t_odd * sin
+    out[..., 1::2] = t_even * sin + t_odd * cos
+    return out
+
+
+def qkv_rope(q, k_cache, v_cache, x, w_qkv, b_qkv, pos_ids, sin_table, cos_table, pos):
+    ntok, n_q_head, head_dim = q.shape
+    n_kv_head = k_cache.shape[0]
+    qkv = x.float() @ w_qkv.float()
+    if b_qkv is not None:
+        qkv += b_qkv.float()
+    qkv = qkv.reshape(ntok, n_q_head + 2 * n_kv_head, head_dim)
+    sin, cos = sin_table[pos_ids].float(), cos_table[pos_ids].float()
+    q_, k_, v_ = qkv.split([n_q_head, n_kv_head, n_kv_head], dim=1)
+    q.copy_(rotary_embedding(q_, sin, cos).to(q.dtype))
+    k_cache[:, pos : pos + ntok, :] = rotary_embedding(k_, sin, cos).permute(1, 0, 2).to(k_cache.dtype)
+    v_cache[:, pos : pos + ntok, :] = v_.permute(1, 0, 2).to(v_cache.dtype)
+
+
+def sin_cos_table(table_len, dim, theta=1e4):
+    freqs = 1.0 / (theta ** (torch.arange(0, dim, 2)[: (dim // 2)].float() / dim))
+    angles = torch.outer(torch.arange(table_len).float(), freqs)
+    return torch.sin(angles), torch.cos(angles)
+
+
+def test(
+    handle,
+    device,
+    ntok,
+    hidden,
+    n_q_head,
+    n_kv_head,
+    head_dim,
+    cache_len,
+    pos,
+    has_bias,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    print(
+        f"Testing QKVRoPE on {InfiniDeviceNames[device]} with ntok:{ntok} hidden:{hidden} n_q_head:{n_q_head} "
+        f"n_kv_head:{n_kv_head} head_dim:{head_dim} cache_len:{cache_len} pos:{pos} has_bias:{has_bias} "
+        f"dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    qkv_dim = (n_q_head + 2 * n_kv_head) * head_dim
+    x = TestTensor((ntok, hidden), None, dtype, device, scale=2, bias=-1)
+    w_qkv = TestTensor((hidden, qkv_dim), None, dtype, device, scale=0.2, bias=-0.1)
+    b_qkv = TestTensor((qkv_dim,), None, dtype, device) if has_bias else None
+    pos_ids = TestTensor.from_torch(torch.arange(pos, pos + ntok, dtype=torch.int32), InfiniDtype.I32, device)
+    sin, cos = sin_cos_table(pos + ntok, head_dim)
+    sin_table = TestTensor.from_torch(sin, dtype, device)
+    cos_table = TestTensor.from_torch(cos, dtype, device)
+    q = TestTensor((ntok, n_q_head, head_dim), None, dtype, device, mode="zeros")
+    k_cache = TestTensor((n_kv_head, cache_len, head_dim), None, dtype, device)
+    v_cache = TestTensor((n_kv_head, cache_len, head_dim), None, dtype, device)
+
+    ans_q = q.torch_tensor().clone()
+    ans_k_cache = k_cache.torch_tensor().clone()
+    ans_v_cache = v_cache.torch_tensor().clone()
+    qkv_rope(
+        ans_q, ans_k_cache, ans_v_cache,
+        x.torch_tensor(), w_qkv.torch_tensor(),
+        b_qkv.torch_tensor() if has_bias else None,
+        pos_ids.torch_tensor().long(), sin_table.torch_tensor(), cos_table.torch_tensor(),
+        pos,
+    )
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateQKVRoPEDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            q.descriptor,
+            k_cache.descriptor,
+            v_cache.descriptor,
+            x.descriptor,
+            w_qkv.descriptor,
+            b_qkv.descriptor if has_bias else None,
+            pos_ids.descriptor,
+            sin_table.descriptor,
+            cos_table.descriptor,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [q, k_cache, v_cache, x, w_qkv, b_qkv, pos_ids, sin_table, cos_table]:
+        if tensor is not None:
+            tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetQKVRoPEWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, q.device)
+
+    def lib_qkv_rope(pos=pos):
+        return LIBINFINIOP.infiniopQKVRoPE(
+            descriptor,
+            workspace.data(),
+            workspace_size.value,
+            q.data(),
+            k_cache.data(),
+            v_cache.data(),
+            x.data(),
+            w_qkv.data(),
+            b_qkv.data() if has_bias else None,
+            pos_ids.data(),
+            sin_table.data(),
+            cos_table.data(),
+            pos,
+            None,
+        )
+
+    # a position leaving too few cache slots for the tokens is rejected before anything is written
+    assert lib_qkv_rope(cache_len - ntok + 1) != 0
+    check_error(lib_qkv_rope())
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(q.actual_tensor(), ans_q, atol=atol, rtol=rtol)
+        debug(k_cache.actual_tensor(), ans_k_cache, atol=atol, rtol=rtol)
+        debug(v_cache.actual_tensor(), ans_v_cache, atol=atol, rtol=rtol)
+    assert torch.allclose(q.actual_tensor(), ans_q, atol=atol, rtol=rtol)
+    assert torch.allclose(k_cache.actual_tensor(), ans_k_cache, atol=atol, rtol=rtol)
+    assert torch.allclose(v_cache.actual_tensor(), ans_v_cache, atol=atol, rtol=rtol)
+
+    # Profiling workflow
+    if PROFILE:
+        # fmt: off
+        profile_operation("    lib", lambda: lib_qkv_rope(), device, NUM_PRERUN, NUM_ITERATIONS)
+        # fmt: on
+    check_error(LIBINFINIOP.infiniopDestroyQKVRoPEDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
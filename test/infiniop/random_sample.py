@@ -14,6 +14,7 @@ from libinfiniop import (
     TestWorkspace,
     InfiniDtype,
     InfiniDtypeNames,
+    InfiniDeviceEnum,
     InfiniDeviceNames,
     infiniopOperatorDescriptor_t,
 )
@@ -36,6 +37,20 @@ _TEST_CASES = [
     # (119696, 0.01, 1.0, 100, 1.0),
 ]
 
+# Batched requests with penalties, only supported on CPU
+_BATCH_TEST_CASES = [
+    # batch, voc, topp, topk, temperature, repetition_penalty, frequency_penalty
+    (4, 512, 0.8, 3, 0.5, 1.0, 0.0),
+    (3, 4096, 0.9, 1, 1.0, 1.2, 0.5),
+    (8, 32000, 0.8, 50, 1.0, 1.1, 0.1),
+    # a top-k below 1 takes the most probable token, one covering the vocabulary only limits top-p
+    (2, 32000, 0.95, 0, 1.0, 1.3, 0.0),
+    (2, 32000, 0.95, 32000, 1.0, 1.3, 0.0),
+    # argmax over rows long enough to be split between threads
+    (1, 151936, 0.9, 1, 1.0, 1.0, 0.0),
+    (3, 262144, 0.9, 1, 1.0, 1.2, 0.3),
+]
+
 # Data types used for testing
 _TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16]
 
@@ -77,6 +92,15 @@ def random_sample(data, random_val, topp, topk, voc, temperature):
     return torch.argmax(data)
 
 
+def penalize(data, counts, repetition_penalty, frequency_penalty):
+    data = data.float()
+    penalized = torch.where(
+        data > 0, data / repetition_penalty, data * repetition_penalty
+    )
+    penalized = penalized - frequency_penalty * counts.float()
+    return torch.where(counts > 0, penalized, data)
+
+
 def test(
     handle,
     device,
@@ -176,6 +200,92 @@ def test(
     check_error(LIBINFINIOP.infiniopDestroyRandomSampleDescriptor(descriptor))
 
 
+def test_batch(
+    handle,
+    device,
+    batch,
+    voc,
+    topp,
+    topk,
+    temperature,
+    repetition_penalty,
+    frequency_penalty,
+    dtype=InfiniDtype.F16,
+    sync=None,
+):
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing batched RandomSample on {InfiniDeviceNames[device]} with batch:{batch} voc:{voc} topp:{topp} topk:{topk} "
+        f"temperature:{temperature} repetition_penalty:{repetition_penalty} frequency_penalty:{frequency_penalty} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    logits = TestTensor.from_torch(
+        torch.stack([torch.arange(voc)[torch.randperm(voc)] for _ in range(batch)]).float() * 0.0001,
+        dtype,
+        device,
+    )
+    counts = (torch.rand(batch, voc) < 0.05).to(torch.int32) * torch.randint(1, 4, (batch, voc), dtype=torch.int32)
+    random_vals = torch.rand(batch, dtype=torch.float32)
+
+    ans = []
+    for row in range(batch):
+        data = penalize(logits.torch_tensor()[row].cpu(), counts[row], repetition_penalty, frequency_penalty)
+        ans.append(random_sample(data, random_vals[row].item(), topp, topk, voc, temperature).to(torch.int32))
+
+    indices = TestTensor([batch], None, InfiniDtype.I32, device, mode="zeros")
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateRandomSampleDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            indices.descriptor,
+            logits.descriptor,
+        )
+    )
+
+    for tensor in [logits, indices]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetRandomSampleWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, device)
+
+    check_error(
+        LIBINFINIOP.infiniopRandomSampleBatch(
+            descriptor,
+            workspace.data(),
+            workspace_size.value,
+            indices.data(),
+            logits.data(),
+            random_vals.numpy().ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+            topp,
+            topk,
+            temperature,
+            repetition_penalty,
+            frequency_penalty,
+            counts.numpy().ctypes.data_as(ctypes.POINTER(ctypes.c_int32)),
+            None,
+        )
+    )
+
+    actual = indices.actual_tensor()
+    for row in range(batch):
+        assert actual[row] == ans[row] or penalize(
+            logits.torch_tensor()[row].cpu(), counts[row], repetition_penalty, frequency_penalty
+        )[actual[row]] == penalize(
+            logits.torch_tensor()[row].cpu(), counts[row], repetition_penalty, frequency_penalty
+        )[ans[row]]
+
+    check_error(LIBINFINIOP.infiniopDestroyRandomSampleDescriptor(descriptor))
+
+
 if __name__ == "__main__":
     args = get_args()
 
@@ -187,5 +297,6 @@ if __name__ == "__main__":
     # Execute tests
     for device in get_test_devices(args):
         test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+        test_operator(device, test_batch, _BATCH_TEST_CASES, _TENSOR_DTYPES)
 
     print("\033[92mTest passed!\033[0m")
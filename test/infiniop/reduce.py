@@ -0,0 +1,202 @@
+import torch
+import ctypes
+from ctypes import c_uint64, c_size_t
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceEnum,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape, strides, axes (empty reduces everything), keepdim
+    ((64, 1000), None, (1,), True),
+    ((64, 1000), None, (0,), False),
+    ((64, 100), None, (), False),
+    ((8, 16, 32), None, (0, 2), True),
+    ((8, 16, 32), (1, 256, 8), (1,), False),
+    ((8, 16, 32), (1, 256, 8), (2, 0), True),
+    ((4, 8, 16, 32), None, (1, 2), False),
+    ((1, 100000), None, (1,), False),
+    ((100000, 8), None, (0,), True),
+]
+
+# Values match infiniopReduceMode_t
+_MODES = {
+    "sum": 0,
+    "mean": 1,
+    "max": 2,
+    "min": 3,
+    "argmax": 4,
+    "prod": 5,
+    "norm2": 6,
+}
+
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32, InfiniDtype.F64]
+
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 1e-2, "rtol": 5e-2},
+    InfiniDtype.F32: {"atol": 1e-3, "rtol": 1e-3},
+    InfiniDtype.F64: {"atol": 1e-10, "rtol": 1e-10},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def reduce_torch(x, mode, axes, keepdim):
+    axes = sorted(axes) if axes else list(range(x.dim()))
+    if mode == "argmax":
+        # index over the reduced axes flattened in row-major order
+        kept = [d for d in range(x.dim()) if d not in axes]
+        y = x.permute(kept + axes).reshape([x.shape[d] for d in kept] + [-1]).argmax(-1)
+        if keepdim:
+            y = y.reshape([1 if d in axes else x.shape[d] for d in range(x.dim())])
+        return y
+    xf = x.double()
+    if mode == "sum":
+        y = xf.sum(dim=axes, keepdim=keepdim)
+    elif mode == "mean":
+        y = xf.mean(dim=axes, keepdim=keepdim)
+    elif mode == "max":
+        y = xf.amax(dim=axes, keepdim=keepdim)
+    elif mode == "min":
+        y = xf.amin(dim=axes, keepdim=keepdim)
+    elif mode == "prod":
+        y = xf
+        for d in reversed(axes):
+            y = y.prod(dim=d, keepdim=keepdim)
+    else:
+        y = torch.linalg.vector_norm(xf, dim=axes, keepdim=keepdim)
+    return y.to(x.dtype)
+
+
+def test(
+    handle,
+    device,
+    shape,
+    strides,
+    axes,
+    keepdim,
+    dtype=InfiniDtype.F32,
+    sync=None,
+):
+    # only the CPU backend implements the multi-axis reduction
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    reduce_count = 1
+    for d in axes if axes else range(len(shape)):
+        reduce_count *= shape[d]
+
+    for mode, mode_value in _MODES.items():
+        # products of many elements leave the half-precision range
+        if mode == "prod" and reduce_count > 256:
+            continue
+        print(
+            f"Testing Reduce on {InfiniDeviceNames[device]} with shape:{shape} strides:{strides} axes:{axes} "
+            f"keepdim:{keepdim} mode:{mode} dtype:{InfiniDtypeNames[dtype]}"
+        )
+
+        # values near 1 keep products finite
+        scale, bias = (0.5, 0.75) if mode == "prod" else (2, -1)
+        input_tensor = TestTensor(shape, strides, dtype, device, scale=scale, bias=bias)
+
+        expected = reduce_torch(input_tensor.torch_tensor(), mode, axes, keepdim)
+        out_dtype = InfiniDtype.I64 if mode == "argmax" else dtype
+        output_tensor = TestTensor(tuple(expected.shape), None, out_dtype, device, mode="zeros")
+
+        if sync is not None:
+            sync()
+
+        axes_array = (c_size_t * max(len(axes), 1))(*axes)
+        descriptor = infiniopOperatorDescriptor_t()
+        check_error(
+            LIBINFINIOP.infiniopCreateReduceDescriptor(
+                handle,
+                ctypes.byref(descriptor),
+                output_tensor.descriptor,
+                input_tensor.descriptor,
+                axes_array,
+                len(axes),
+                int(keepdim),
+                mode_value,
+            )
+        )
+
+        # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+        for tensor in [input_tensor, output_tensor]:
+            tensor.destroy_desc()
+
+        workspace_size = c_uint64(0)
+        check_error(
+            LIBINFINIOP.infiniopGetReduceWorkspaceSize(
+                descriptor, ctypes.byref(workspace_size)
+            )
+        )
+        workspace = TestWorkspace(workspace_size.value, device)
+
+        def lib_reduce():
+            check_error(
+                LIBINFINIOP.infiniopReduce(
+                    descriptor,
+                    workspace.data(),
+                    workspace.size(),
+                    output_tensor.data(),
+                    input_tensor.data(),
+                    None,
+                )
+            )
+
+        lib_reduce()
+
+        if mode == "argmax":
+            if DEBUG:
+                debug(output_tensor.actual_tensor(), expected, atol=0, rtol=0)
+            assert torch.equal(output_tensor.actual_tensor(), expected)
+        else:
+            atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+            if DEBUG:
+                debug(output_tensor.actual_tensor(), expected, atol=atol, rtol=rtol)
+            assert torch.allclose(output_tensor.actual_tensor(), expected, atol=atol, rtol=rtol)
+
+        if PROFILE:
+            # fmt: off
+            profile_operation("PyTorch", lambda: reduce_torch(input_tensor.torch_tensor(), mode, axes, keepdim), device, NUM_PRERUN, NUM_ITERATIONS)
+            profile_operation("    lib", lambda: lib_reduce(), device, NUM_PRERUN, NUM_ITERATIONS)
+            # fmt: on
+
+        check_error(LIBINFINIOP.infiniopDestroyReduceDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES_, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
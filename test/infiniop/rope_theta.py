@@ -0,0 +1,198 @@
+import torch
+import ctypes
+from ctypes import c_uint64
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    debug,
+    get_tolerance,
+    profile_operation,
+    TestWorkspace,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+)
+from enum import Enum
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+
+
+class Algo(Enum):
+    GPT_J = 0
+    GPT_NEOX = 1
+
+
+_TEST_CASES_ = [
+    # (shape, x_strides, y_strides, rotary_dim)
+    ((1, 32, 128), None, None, 0),
+    ((10, 32, 64), None, None, 0),
+    ((4, 1, 32), (64, 64, 1), None, 0),
+    ((11, 33, 128), None, (8000, 200, 1), 64),
+    ((3, 32, 128), (8000, 200, 1), (7000, 128, 1), 32),
+    # [batch, seqlen, nhead, dhead] with [batch, seqlen] positions
+    ((2, 5, 8, 64), None, None, 0),
+    ((3, 1, 4, 128), None, None, 96),
+]
+
+_TEST_CASES = [
+    test_case + (algo,)
+    for test_case in _TEST_CASES_
+    for algo in [Algo.GPT_J, Algo.GPT_NEOX]
+]
+
+# Data types used for testing
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.BF16, InfiniDtype.F32]
+
+# Tolerance map for different data types
+_TOLERANCE_MAP = {
+    InfiniDtype.F16: {"atol": 1e-3, "rtol": 1e-2},
+    InfiniDtype.BF16: {"atol": 5e-3, "rtol": 5e-2},
+    InfiniDtype.F32: {"atol": 1e-4, "rtol": 1e-3},
+}
+
+DEBUG = False
+PROFILE = False
+NUM_PRERUN = 10
+NUM_ITERATIONS = 1000
+
+
+def rotary_embedding(ans, t, pos, theta, rotary_dim, algo):
+    half = rotary_dim // 2
+    freqs = 1.0 / (
+        theta ** (torch.arange(0, rotary_dim, 2, dtype=torch.float64) / rotary_dim)
+    )
+    angles = pos.cpu().double().unsqueeze(-1) * freqs  # [..., seqlen, half]
+    sin = torch.sin(angles).float().unsqueeze(-2).to(t.device)  # [..., seqlen, 1, half]
+    cos = torch.cos(angles).float().unsqueeze(-2).to(t.device)
+
+    t = t.float()
+    if algo == Algo.GPT_J:
+        t0, t1 = t[..., 0:rotary_dim:2], t[..., 1:rotary_dim:2]
+    else:
+        t0, t1 = t[..., :half], t[..., half:rotary_dim]
+    out = t.clone()
+    if algo == Algo.GPT_J:
+        out[..., 0:rotary_dim:2] = t0 * cos - t1 * sin
+        out[..., 1:rotary_dim:2] = t0 * sin + t1 * cos
+    else:
+        out[..., :half] = t0 * cos - t1 * sin
+        out[..., half:rotary_dim] = t0 * sin + t1 * cos
+    ans.copy_(out.to(ans.dtype))
+
+
+def test(
+    handle,
+    device,
+    shape,
+    x_strides=None,
+    y_strides=None,
+    rotary_dim=0,
+    algo=Algo.GPT_J,
+    dtype=torch.float32,
+    sync=None,
+):
+    x = TestTensor(shape, x_strides, dtype, device)
+    y = TestTensor(shape, y_strides, dtype, device)
+
+    print(
+        f"Testing RoPETheta on {InfiniDeviceNames[device]} with shape:{shape} x_strides:{x_strides} y_strides:{y_strides} "
+        f"rotary_dim:{rotary_dim} algo:{algo.name} dtype:{InfiniDtypeNames[dtype]}"
+    )
+    theta = 1e4
+    pos_shape = shape[:-2]
+    pos = TestTensor.from_torch(
+        torch.randint(0, 32768, pos_shape, dtype=torch.int64), InfiniDtype.I64, device
+    )
+
+    rotary_embedding(
+        y.torch_tensor(),
+        x.torch_tensor(),
+        pos.torch_tensor(),
+        theta,
+        rotary_dim if rotary_dim != 0 else shape[-1],
+        algo,
+    )
+
+    descriptor = infiniopOperatorDescriptor_t()
+
+    if sync is not None:
+        sync()
+
+    check_error(
+        LIBINFINIOP.infiniopCreateRoPEThetaDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            y.descriptor,
+            x.descriptor,
+            pos.descriptor,
+            theta,
+            rotary_dim,
+            algo.value,
+        )
+    )
+
+    # Invalidate the shape and strides in the descriptor to prevent them from being directly used by the kernel
+    for tensor in [y, x, pos]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetRoPEThetaWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, x.device)
+
+    def lib_rope_theta():
+        check_error(
+            LIBINFINIOP.infiniopRoPETheta(
+                descriptor,
+                workspace.data(),
+                workspace_size.value,
+                y.data(),
+                x.data(),
+                pos.data(),
+                None,
+            )
+        )
+
+    lib_rope_theta()
+
+    if sync is not None:
+        sync()
+
+    atol, rtol = get_tolerance(_TOLERANCE_MAP, dtype)
+    if DEBUG:
+        debug(y.actual_tensor(), y.torch_tensor(), atol=atol, rtol=rtol)
+    assert torch.allclose(y.actual_tensor(), y.torch_tensor(), atol=atol, rtol=rtol)
+
+    if PROFILE:
+        profile_operation(
+            "    lib", lambda: lib_rope_theta(), device, NUM_PRERUN, NUM_ITERATIONS
+        )
+
+    check_error(LIBINFINIOP.infiniopDestroyRoPEThetaDescriptor(descriptor))
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+    PROFILE = args.profile
+    NUM_PRERUN = args.num_prerun
+    NUM_ITERATIONS = args.num_iterations
+
+    # Execute tests
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
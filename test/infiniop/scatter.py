@@ -14,6 +14,7 @@ from libinfiniop import (
     TestWorkspace,
     InfiniDtype,
     InfiniDtypeNames,
+    InfiniDeviceEnum,
     InfiniDeviceNames,
     infiniopOperatorDescriptor_t,
 )
@@ -97,6 +98,28 @@ _TEST_CASES = [
 ]
 
 
+# Reduce modes, values of infiniopScatterReduce_t and the matching torch.scatter_reduce names
+_REDUCE_MODES = {
+    1: "sum",
+    2: "prod",
+    3: "amax",
+    4: "amin",
+}
+
+# Test cases for scatter with reduction (CPU only): (input_shape, index_shape, dim, input_strides)
+_REDUCE_TEST_CASES = [
+    ((4, 6), (3, 6), 0, None),
+    ((5, 8), (5, 12), 1, None),
+    ((3, 4, 5), (3, 4, 7), 2, None),
+    ((4, 3, 6), (4, 2, 6), 1, None),
+    ((5, 6), (3, 6), 0, (1, 5)),
+    ((1000,), (50000,), 0, None),  # 重复索引多，按 dim 划分并行
+    ((64, 512), (256, 512), 0, None),  # embedding 梯度累加
+]
+
+_REDUCE_DTYPES = [InfiniDtype.F32, InfiniDtype.F64, InfiniDtype.I32, InfiniDtype.I64]
+
+
 # Data types used for testing - 所有合法类型
 _TENSOR_DTYPES = [
     InfiniDtype.F16, InfiniDtype.F32, InfiniDtype.F64, InfiniDtype.BF16,
@@ -432,6 +455,77 @@ def test(
     check_error(LIBINFINIOP.infiniopDestroyScatterDescriptor(descriptor))
 
 
+def test_reduce(handle, device, input_shape, index_shape, dim, input_strides, reduce, dtype, sync=None):
+    if device != InfiniDeviceEnum.CPU:
+        return
+
+    print(
+        f"Testing ScatterReduce on {InfiniDeviceNames[device]} with input_shape:{input_shape} index_shape:{index_shape} dim:{dim} input_strides:{input_strides} reduce:{_REDUCE_MODES[reduce]} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    output = TestTensor(input_shape, input_strides, dtype, device)
+    src = TestTensor(index_shape, None, dtype, device)
+    torch_index = torch.randint(0, input_shape[dim], index_shape, dtype=torch.int64)
+    index = TestTensor.from_torch(torch_index, InfiniDtype.I64, device)
+
+    if dtype in [InfiniDtype.I32, InfiniDtype.I64] and reduce == 2:
+        # keep integer products from overflowing
+        src.torch_tensor().clamp_(0, 1)
+
+    expected = output.torch_tensor().scatter_reduce(
+        dim, index.torch_tensor(), src.torch_tensor(), _REDUCE_MODES[reduce]
+    )
+
+    if sync is not None:
+        sync()
+
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateScatterReduceDescriptor(
+            handle,
+            ctypes.byref(descriptor),
+            output.descriptor,
+            output.descriptor,
+            index.descriptor,
+            src.descriptor,
+            dim,
+            reduce,
+        )
+    )
+
+    for tensor in [output, index, src]:
+        tensor.destroy_desc()
+
+    workspace_size = c_uint64(0)
+    check_error(
+        LIBINFINIOP.infiniopGetScatterWorkspaceSize(
+            descriptor, ctypes.byref(workspace_size)
+        )
+    )
+    workspace = TestWorkspace(workspace_size.value, output.device)
+
+    # in place, the output is the input
+    check_error(
+        LIBINFINIOP.infiniopScatter(
+            descriptor,
+            workspace.data(),
+            workspace_size.value,
+            output.data(),
+            output.data(),
+            index.data(),
+            src.data(),
+            None,
+        )
+    )
+
+    atol, rtol = 1e-5, 1e-5
+    if DEBUG:
+        debug(output.actual_tensor(), expected, atol=atol, rtol=rtol)
+    assert torch.allclose(output.actual_tensor(), expected, atol=atol, rtol=rtol)
+
+    check_error(LIBINFINIOP.infiniopDestroyScatterDescriptor(descriptor))
+
+
 if __name__ == "__main__":
     args = get_args()
     
@@ -452,5 +546,11 @@ if __name__ == "__main__":
 
     for device in get_test_devices(args):
         test_operator(device, test, test_cases_with_inplace, _TENSOR_DTYPES)
+        test_operator(
+            device,
+            test_reduce,
+            [case + (reduce,) for case in _REDUCE_TEST_CASES for reduce in _REDUCE_MODES],
+            _REDUCE_DTYPES,
+        )
 
     print("\033[92mTest passed!\033[0m")
\ No newline at end of file
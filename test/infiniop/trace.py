@@ -0,0 +1,121 @@
+import json
+import os
+import tempfile
+import ctypes
+from ctypes import c_size_t
+from libinfiniop import (
+    LIBINFINIOP,
+    TestTensor,
+    get_test_devices,
+    check_error,
+    test_operator,
+    get_args,
+    InfiniDtype,
+    InfiniDtypeNames,
+    InfiniDeviceNames,
+    infiniopOperatorDescriptor_t,
+    TraceSummary,
+)
+
+# ==============================================================================
+#  Configuration (Internal Use Only)
+# ==============================================================================
+# These are not meant to be imported from other modules
+_TEST_CASES_ = [
+    # shape, calls, events per thread
+    ((13, 4), 3, 0),
+    ((64, 4096), 10, 0),
+    ((64, 4096), 10, 4),
+]
+
+_TENSOR_DTYPES = [InfiniDtype.F16, InfiniDtype.F32]
+
+DEBUG = False
+
+
+def test(handle, device, shape, calls, events_per_thread, dtype=InfiniDtype.F16, sync=None):
+    print(
+        f"Testing Trace on {InfiniDeviceNames[device]} with shape:{shape} calls:{calls} "
+        f"events_per_thread:{events_per_thread} dtype:{InfiniDtypeNames[dtype]}"
+    )
+
+    a = TestTensor(shape, None, dtype, device)
+    b = TestTensor(shape, None, dtype, device)
+    c = TestTensor(shape, None, dtype, device, mode="zeros")
+
+    if sync is not None:
+        sync()
+
+    # created before the trace starts, its calls carry the tensor bytes but not the shapes
+    descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateAddDescriptor(
+            handle, ctypes.byref(descriptor), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+
+    check_error(LIBINFINIOP.infiniopStartTrace(events_per_thread))
+
+    # created while tracing, its calls carry the shapes too
+    traced_descriptor = infiniopOperatorDescriptor_t()
+    check_error(
+        LIBINFINIOP.infiniopCreateMulDescriptor(
+            handle, ctypes.byref(traced_descriptor), c.descriptor, a.descriptor, b.descriptor
+        )
+    )
+    for tensor in [a, b, c]:
+        tensor.destroy_desc()
+
+    for _ in range(calls):
+        check_error(
+            LIBINFINIOP.infiniopAdd(descriptor, None, 0, c.data(), a.data(), b.data(), None)
+        )
+    check_error(
+        LIBINFINIOP.infiniopMul(traced_descriptor, None, 0, c.data(), a.data(), b.data(), None)
+    )
+    check_error(LIBINFINIOP.infiniopStopTrace())
+    # calls after the trace stopped are not recorded
+    check_error(LIBINFINIOP.infiniopAdd(descriptor, None, 0, c.data(), a.data(), b.data(), None))
+    check_error(LIBINFINIOP.infiniopDestroyAddDescriptor(descriptor))
+    check_error(LIBINFINIOP.infiniopDestroyMulDescriptor(traced_descriptor))
+
+    # the ring keeps the last calls, the Mul and the Adds before it
+    recorded = calls if events_per_thread == 0 else min(calls, events_per_thread - 1)
+
+    count = c_size_t(0)
+    check_error(LIBINFINIOP.infiniopGetTraceSummary(None, ctypes.byref(count)))
+    assert count.value == 2
+    summary = (TraceSummary * count.value)()
+    check_error(LIBINFINIOP.infiniopGetTraceSummary(summary, ctypes.byref(count)))
+    summary = {entry.op: entry for entry in summary}
+    assert summary[b"Add"].count == recorded and summary[b"Mul"].count == 1
+    tensor_bytes = 3 * a.torch_tensor().numel() * a.torch_tensor().element_size()
+    assert summary[b"Add"].bytes == recorded * tensor_bytes
+    assert summary[b"Mul"].bytes == tensor_bytes
+
+    with tempfile.TemporaryDirectory() as directory:
+        path = os.path.join(directory, "trace.json")
+        check_error(LIBINFINIOP.infiniopExportTrace(path.encode()))
+        with open(path) as f:
+            events = json.load(f)["traceEvents"]
+    if DEBUG:
+        print(events[-1])
+    assert len(events) == recorded + 1
+    shapes = " ".join([f"{InfiniDtypeNames[dtype]}({','.join(map(str, shape))})"] * 3)
+    for event in events:
+        assert event["name"] in ("Add", "Mul") and event["ph"] == "X" and event["dur"] >= 0
+        assert event["args"]["device"] == device
+        assert event["args"]["bytes"] == tensor_bytes
+        assert event["args"].get("tensors") == (shapes if event["name"] == "Mul" else None)
+
+
+if __name__ == "__main__":
+    args = get_args()
+
+    # Configure testing options
+    DEBUG = args.debug
+
+    for device in get_test_devices(args):
+        test_operator(device, test, _TEST_CASES_, _TENSOR_DTYPES)
+
+    print("\033[92mTest passed!\033[0m")
@@ -269,6 +269,15 @@ target("infiniop")
         add_deps("infiniop-kunlun")
     end
     set_languages("cxx17")
+    -- graph launches run independent nodes in parallel
+    if has_config("omp") then
+        if is_plat("windows") then
+            add_cxflags("/openmp")
+        else
+            add_cxflags("-fopenmp")
+            add_ldflags("-fopenmp", {force = true})
+        end
+    end
     add_files("src/infiniop/devices/handle.cc")
     add_files("src/infiniop/ops/*/operator.cc")
     add_files("src/infiniop/*.cc")